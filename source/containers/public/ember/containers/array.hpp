@@ -2,7 +2,9 @@
 
 #include <concepts>
 #include <cstddef>
+#include <ember/memory/allocator.hpp>
 #include <iterator>
+#include <type_traits>
 
 namespace ember::inline containers::internal {
     template<typename array_type>
@@ -147,21 +149,67 @@ namespace ember::inline containers::internal {
 
 namespace ember::inline containers {
     /**
-     * @brief Dynamically sized contiguous array of type T.
+     * @brief Whether objects of T can be moved to a new address by copying their bytes, without
+     * running a move constructor on the new address or a destructor on the old one.
+     * @details Defaults to trivially copyable types. Specialise this for types that own resources
+     * but hold no pointers into themselves (unique_ptr, array) to let containers memcpy them when
+     * growing, inserting and erasing.
      * @tparam T 
      */
     template<typename T>
+    struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+    template<typename T>
+    inline constexpr bool is_trivially_relocatable_v{ is_trivially_relocatable<T>::value };
+}
+
+namespace ember::inline containers::internal {
+    /**
+     * @brief Iterators whose items are laid out next to each other in memory. Covers the array
+     * iterators, which don't model std::contiguous_iterator.
+     */
+    template<typename iterator_type>
+    concept contiguous_iterator = std::contiguous_iterator<iterator_type> || requires(iterator_type iterator) {
+        { iterator.get() } -> std::convertible_to<std::add_pointer_t<typename iterator_type::value_type const>>;
+    };
+
+    template<typename iterator_type>
+    auto to_address(iterator_type iterator);
+
+    /**
+     * @brief Moves count items from source into the uninitialised memory at destination, leaving
+     * source uninitialised. The ranges can overlap.
+     */
+    template<typename T>
+    void relocate_items(T *source, T *destination, std::size_t const count);
+    /**
+     * @brief Copy constructs the items in [begin, end) into the uninitialised memory at destination.
+     */
+    template<typename T, typename iterator_type>
+    void copy_construct_items(iterator_type begin, iterator_type end, T *destination);
+}
+
+namespace ember::inline containers {
+    /**
+     * @brief Dynamically sized contiguous array of type T.
+     * @details Copy constructing an array copies it's allocator. Assigning to an array keeps the allocator
+     * the array was constructed with.
+     * @tparam T 
+     * @tparam allocator_t Allocator used for the array's memory.
+     */
+    template<typename T, allocator allocator_t = global_allocator_ref>
     class array {
         //TYPES
     public:
         using value_type           = T;
+        using allocator_type       = allocator_t;
         using pointer_type         = T *;
         using const_pointer_type   = T const *;
         using reference_type       = T &;
         using const_reference_type = T const &;
 
-        using iterator       = internal::array_iterator<array<T>>;
-        using const_iterator = internal::const_array_iterator<array<T>>;
+        using iterator       = internal::array_iterator<array<T, allocator_t>>;
+        using const_iterator = internal::const_array_iterator<array<T, allocator_t>>;
 
         friend iterator;
         friend const_iterator;
@@ -180,19 +228,23 @@ namespace ember::inline containers {
         std::size_t elems{ 0 }; /**< How many items are currently stored in this array. */
         std::size_t cap{ 0 };   /**< Total capacity of the array. */
 
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the array's memory comes from. */
+
         //FUNCTIONS
     public:
-        array() noexcept;
-        explicit array(std::size_t const size) requires std::is_default_constructible_v<T>;
-        array(std::initializer_list<T> init);
+        array() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit array(allocator_t allocator) noexcept;
+        explicit array(std::size_t const size) requires std::is_default_constructible_v<T> && std::is_default_constructible_v<allocator_t>;
+        array(std::size_t const size, allocator_t allocator) requires std::is_default_constructible_v<T>;
+        array(std::initializer_list<T> init) requires std::is_default_constructible_v<allocator_t>;
         template<typename iterator_type>
-        array(iterator_type begin, iterator_type end);
+        array(iterator_type begin, iterator_type end) requires std::is_default_constructible_v<allocator_t>;
 
         array(array const &other);
-        array(array &&other);
+        array(array &&other) noexcept;
 
         array &operator=(array const &other);
-        array &operator=(array &&other);
+        array &operator=(array &&other) noexcept;
 
         ~array();
 
@@ -210,6 +262,34 @@ namespace ember::inline containers {
         template<typename... args_t>
         void emplace_back(args_t &&...args);
 
+        /**
+         * @brief Inserts copies of the items in [begin, end) before where.
+         * @details Trivially copyable items from contiguous ranges are copied in one go. The range must not
+         * point into this array.
+         * @param where Where to insert the items. Can be end().
+         * @param begin 
+         * @param end 
+         * @return Returns an iterator to the first inserted item.
+         */
+        template<typename iterator_type>
+        iterator insert(iterator where, iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Copies the items in [begin, end) onto the end of the array.
+         * @param begin 
+         * @param end 
+         */
+        template<typename iterator_type>
+        void append(iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Replaces the contents of the array with copies of the items in [begin, end).
+         * @param begin 
+         * @param end 
+         */
+        template<typename iterator_type>
+        void assign(iterator_type begin, iterator_type end);
+
         /**
          * @brief Removes an element from the end of this array
          */
@@ -324,13 +404,19 @@ namespace ember::inline containers {
          */
         const_iterator end() const noexcept;
 
+        /**
+         * @brief Returns the allocator this array allocates it's memory from.
+         * @return 
+         */
+        allocator_t get_allocator() const;
+
         reference_type operator[](std::size_t pos);
         const_reference_type operator[](std::size_t pos) const;
 
-        template<typename array_type_1, typename array_type_2>
-        friend bool operator==(array<array_type_1> const &lhs, array<array_type_2> const &rhs);
-        template<typename array_type_1, typename array_type_2>
-        friend bool operator!=(array<array_type_1> const &lhs, array<array_type_2> const &rhs);
+        template<typename array_type_1, typename allocator_t_1, typename array_type_2, typename allocator_t_2>
+        friend bool operator==(array<array_type_1, allocator_t_1> const &lhs, array<array_type_2, allocator_t_2> const &rhs);
+        template<typename array_type_1, typename allocator_t_1, typename array_type_2, typename allocator_t_2>
+        friend bool operator!=(array<array_type_1, allocator_t_1> const &lhs, array<array_type_2, allocator_t_2> const &rhs);
 
     private:
         void allocate_array(std::size_t const capacity);
@@ -339,27 +425,34 @@ namespace ember::inline containers {
         void destruct_items();
 
         void double_size();
+        void grow_to_fit(std::size_t const size);
     };
+
+    /**
+     * @brief Arrays only point to their memory so can be relocated if their allocator can be.
+     */
+    template<typename T, typename allocator_t>
+    struct is_trivially_relocatable<array<T, allocator_t>> : is_trivially_relocatable<allocator_t> {};
 }
 
 namespace std {
     //Specialised iterator traits for certain std algorithms.
-    template<typename T>
-    struct iterator_traits<ember::containers::internal::const_array_iterator<ember::containers::array<T>>> {
-        using iterator_category = typename ember::containers::internal::const_array_iterator<ember::containers::array<T>>::iterator_category;
+    template<typename T, typename allocator_t>
+    struct iterator_traits<ember::containers::internal::const_array_iterator<ember::containers::array<T, allocator_t>>> {
+        using iterator_category = typename ember::containers::internal::const_array_iterator<ember::containers::array<T, allocator_t>>::iterator_category;
 
-        using value_type = typename ember::containers::internal::const_array_iterator<ember::containers::array<T>>::value_type;
+        using value_type = typename ember::containers::internal::const_array_iterator<ember::containers::array<T, allocator_t>>::value_type;
 
-        using difference_type = typename ember::containers::internal::const_array_iterator<ember::containers::array<T>>::difference_type;
+        using difference_type = typename ember::containers::internal::const_array_iterator<ember::containers::array<T, allocator_t>>::difference_type;
     };
 
-    template<typename T>
-    struct iterator_traits<ember::containers::internal::array_iterator<ember::containers::array<T>>> {
-        using iterator_category = typename ember::containers::internal::array_iterator<ember::containers::array<T>>::iterator_category;
+    template<typename T, typename allocator_t>
+    struct iterator_traits<ember::containers::internal::array_iterator<ember::containers::array<T, allocator_t>>> {
+        using iterator_category = typename ember::containers::internal::array_iterator<ember::containers::array<T, allocator_t>>::iterator_category;
 
-        using value_type = typename ember::containers::internal::array_iterator<ember::containers::array<T>>::value_type;
+        using value_type = typename ember::containers::internal::array_iterator<ember::containers::array<T, allocator_t>>::value_type;
 
-        using difference_type = typename ember::containers::internal::array_iterator<ember::containers::array<T>>::difference_type;
+        using difference_type = typename ember::containers::internal::array_iterator<ember::containers::array<T, allocator_t>>::difference_type;
     };
 }
 
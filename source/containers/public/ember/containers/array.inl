@@ -1,6 +1,9 @@
+#include <algorithm>
+#include <cstring>
 #include <ember/core/exception.hpp>
 #include <ember/core/log.hpp>
 #include <ember/memory/memory.hpp>
+#include <utility>
 
 namespace ember::inline containers {
     namespace internal {
@@ -117,6 +120,62 @@ namespace ember::inline containers {
             return this->array->first + this->array->elems;
         }
 
+        template<typename iterator_type>
+        auto to_address(iterator_type iterator) {
+            if constexpr(std::contiguous_iterator<iterator_type>) {
+                return std::to_address(iterator);
+            } else {
+                return iterator.get();
+            }
+        }
+
+        template<typename T>
+        void relocate_items(T *source, T *destination, std::size_t const count) {
+            if(count == 0 || source == destination) {
+                return;
+            }
+
+            if constexpr(is_trivially_relocatable_v<T>) {
+                std::memmove(static_cast<void *>(destination), static_cast<void const *>(source), sizeof(T) * count);
+            } else {
+                auto const relocate{ [](T *from, T *to) {
+                    if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
+                        new(to) T(std::move(*from));
+                    } else {
+                        new(to) T(*from);
+                    }
+                    from->~T();//Make sure we destruct the previous item, even if we moved.
+                } };
+
+                //Walk backwards when moving up so overlapping items aren't overwritten before they're moved.
+                if(destination < source) {
+                    for(std::size_t i{ 0 }; i < count; ++i) {
+                        relocate(source + i, destination + i);
+                    }
+                } else {
+                    for(std::size_t i{ count }; i > 0; --i) {
+                        relocate(source + (i - 1), destination + (i - 1));
+                    }
+                }
+            }
+        }
+
+        template<typename T, typename iterator_type>
+        void copy_construct_items(iterator_type begin, iterator_type end, T *destination) {
+            using source_type = std::remove_cvref_t<decltype(*begin)>;
+
+            if constexpr(std::is_trivially_copyable_v<T> && std::is_same_v<source_type, T> && contiguous_iterator<iterator_type>) {
+                std::size_t const count{ static_cast<std::size_t>(end - begin) };
+                if(count > 0) {
+                    std::memcpy(static_cast<void *>(destination), static_cast<void const *>(internal::to_address(begin)), sizeof(T) * count);
+                }
+            } else {
+                for(auto iter{ begin }; iter != end; ++iter, ++destination) {
+                    new(destination) T(*iter);
+                }
+            }
+        }
+
         template<typename array_type>
         array_iterator<array_type>::array_iterator() = default;
 
@@ -243,11 +302,16 @@ namespace ember::inline containers {
         }
     }
 
-    template<typename T>
-    array<T>::array() noexcept = default;
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
 
-    template<typename T>
-    array<T>::array(std::size_t const size) requires std::is_default_constructible_v<T>
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array(std::size_t const size) requires std::is_default_constructible_v<T> && std::is_default_constructible_v<allocator_t>
         : elems{ size }, cap{ size } {
         allocate_array(cap);
         for(std::size_t i{ 0 }; i < elems; ++i) {
@@ -255,102 +319,117 @@ namespace ember::inline containers {
         }
     }
 
-    template<typename T>
-    array<T>::array(std::initializer_list<T> init)
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array(std::size_t const size, allocator_t allocator) requires std::is_default_constructible_v<T>
+        : elems{ size }
+        , cap{ size }
+        , allocator{ std::move(allocator) } {
+        allocate_array(cap);
+        for(std::size_t i{ 0 }; i < elems; ++i) {
+            new(&first[i]) value_type{};
+        }
+    }
+
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array(std::initializer_list<T> init) requires std::is_default_constructible_v<allocator_t>
         : elems{ init.size() }
         , cap{ init.size() } {
         allocate_array(cap);
-        std::size_t index{ 0 };
-        for(auto iter{ init.begin() }; iter != init.end(); ++iter, ++index) {
-            new(&first[index]) value_type{ *iter };
-        }
+        internal::copy_construct_items(init.begin(), init.end(), first);
     }
 
-    template<typename T>
+    template<typename T, allocator allocator_t>
     template<typename iterator_type>
-    array<T>::array(iterator_type begin, iterator_type end)
+    array<T, allocator_t>::array(iterator_type begin, iterator_type end) requires std::is_default_constructible_v<allocator_t>
         : elems{ static_cast<std::size_t>(std::distance(begin, end)) }
         , cap{ elems } {
         allocate_array(cap);
-        std::size_t index{ 0 };
-        for(auto iter{ begin }; iter != end; ++iter, ++index) {
-            new(&first[index]) value_type{ *iter };
-        }
+        internal::copy_construct_items(begin, end, first);
     }
 
-    template<typename T>
-    array<T>::array(array<T> const &other) {
-        destruct_items();
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array(array<T, allocator_t> const &other)
+        : allocator{ other.allocator } {
 
         elems = other.elems;
         cap   = other.cap;
         reallocate_array(cap, reallocate_type::ignore_current_items);
 
-        for(std::size_t i{ 0 }; i < elems; ++i) {
-            new(&first[i]) value_type{ other[i] };
-        }
+        internal::copy_construct_items(other.first, other.first + elems, first);
     }
 
-    template<typename T>
-    array<T>::array(array<T> &&other) {
-        destruct_items();
-
-        elems = other.elems;
-        cap   = other.cap;
-        reallocate_array(cap, reallocate_type::ignore_current_items);
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::array(array<T, allocator_t> &&other) noexcept
+        : memory{ std::exchange(other.memory, nullptr) }
+        , first{ std::exchange(other.first, nullptr) }
+        , elems{ std::exchange(other.elems, 0) }
+        , cap{ std::exchange(other.cap, 0) }
+        , allocator{ other.allocator } {
+    }
 
-        for(std::size_t i{ 0 }; i < elems; ++i) {
-            new(&first[i]) value_type{ std::move(other[i]) };
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t> &array<T, allocator_t>::operator=(array<T, allocator_t> const &other) {
+        if(this == &other) {
+            return *this;
         }
 
-        memory::free(other.memory);
-        other.memory = nullptr;
-        other.first  = nullptr;
-        other.elems  = 0;
-        other.cap    = 0;
-    }
-
-    template<typename T>
-    array<T> &array<T>::operator=(array<T> const &other) {
         destruct_items();
 
         elems = other.elems;
         cap   = other.cap;
         reallocate_array(cap, reallocate_type::ignore_current_items);
 
-        for(std::size_t i{ 0 }; i < elems; ++i) {
-            new(&first[i]) value_type{ other[i] };
-        }
+        internal::copy_construct_items(other.first, other.first + elems, first);
 
         return *this;
     }
 
-    template<typename T>
-    array<T> &array<T>::operator=(array<T> &&other) {
-        destruct_items();
-
-        elems = other.elems;
-        cap   = other.cap;
-        reallocate_array(cap, reallocate_type::ignore_current_items);
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t> &array<T, allocator_t>::operator=(array<T, allocator_t> &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
 
-        for(std::size_t i{ 0 }; i < elems; ++i) {
-            new(&first[i]) value_type{ std::move(other[i]) };
+        //The memory can only be taken if it can be freed through this array's allocator.
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
         }
 
-        memory::free(other.memory);
-        other.memory = nullptr;
-        other.first  = nullptr;
-        other.elems  = 0;
-        other.cap    = 0;
+        if(can_take_memory) {
+            destruct_items();
+            if(memory != nullptr) {
+                allocator.free(memory);
+            }
+
+            memory = std::exchange(other.memory, nullptr);
+            first  = std::exchange(other.first, nullptr);
+            elems  = std::exchange(other.elems, 0);
+            cap    = std::exchange(other.cap, 0);
+        } else {
+            destruct_items();
+
+            elems = other.elems;
+            cap   = other.cap;
+            reallocate_array(cap, reallocate_type::ignore_current_items);
+
+            internal::relocate_items(other.first, first, elems);
+
+            other.allocator.free(other.memory);
+            other.memory = nullptr;
+            other.first  = nullptr;
+            other.elems  = 0;
+            other.cap    = 0;
+        }
 
         return *this;
     }
 
-    template<typename T>
-    array<T>::~array() {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::~array() {
         if(memory != nullptr) {
             destruct_items();
-            memory::free(memory);
+            allocator.free(memory);
 
             memory = nullptr;
             first  = nullptr;
@@ -359,91 +438,112 @@ namespace ember::inline containers {
         }
     }
 
-    template<typename T>
-    void array<T>::push_back(const_reference_type val) {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::push_back(const_reference_type val) {
         if(elems + 1 > cap) {
             double_size();
         }
         new(&first[elems++]) value_type{ val };
     }
 
-    template<typename T>
+    template<typename T, allocator allocator_t>
     template<typename... args_t>
-    void array<T>::emplace_back(args_t &&...args) {
+    void array<T, allocator_t>::emplace_back(args_t &&...args) {
         if(elems + 1 > cap) {
             double_size();
         }
         new(&first[elems++]) value_type{ std::forward<args_t>(args)... };
     }
 
-    template<typename T>
-    void array<T>::pop_back() {
+    template<typename T, allocator allocator_t>
+    template<typename iterator_type>
+    array<T, allocator_t>::iterator array<T, allocator_t>::insert(iterator where, iterator_type begin, iterator_type end) {
+        EMBER_CHECK(where <= this->end());
+
+        std::size_t const index{ static_cast<std::size_t>(where - this->begin()) };
+        std::size_t const count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        if(count == 0) {
+            return this->begin() + index;
+        }
+
+        grow_to_fit(elems + count);
+
+        //Open up a gap for the new items then copy them into it.
+        internal::relocate_items(first + index, first + index + count, elems - index);
+        internal::copy_construct_items(begin, end, first + index);
+        elems += count;
+
+        return this->begin() + index;
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename iterator_type>
+    void array<T, allocator_t>::append(iterator_type begin, iterator_type end) {
+        std::size_t const count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        grow_to_fit(elems + count);
+
+        internal::copy_construct_items(begin, end, first + elems);
+        elems += count;
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename iterator_type>
+    void array<T, allocator_t>::assign(iterator_type begin, iterator_type end) {
+        clear();
+        append(begin, end);
+    }
+
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::pop_back() {
         if(elems > 0) {
             first[elems - 1].~T();
             --elems;
         }
     }
 
-    template<typename T>
-    array<T>::iterator array<T>::erase(iterator where) {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::iterator array<T, allocator_t>::erase(iterator where) {
         return erase(where, where + 1);
     }
 
-    template<typename T>
-    array<T>::iterator array<T>::erase(iterator from, iterator to) {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::iterator array<T, allocator_t>::erase(iterator from, iterator to) {
         EMBER_CHECK(to <= end());
 
         if(from == to) {
             return to;
         }
 
-        if(to == end()) {
-            std::size_t count{ 0 };
+        std::size_t const index{ static_cast<std::size_t>(from - begin()) };
+        std::size_t const count{ static_cast<std::size_t>(to - from) };
 
-            //If we're erasing until the end then we can just destruct the last elements
-            for(; from != end(); ++from, ++count) {
-                (*from).~T();
-            }
-
-            elems -= count;
-
-            return end();
-        } else {
-            std::size_t count{ 0 };
-
-            //Destruct the items we are going to remove
-            for(auto iter{ from }; iter != to; ++iter, ++count) {
-                (*from).~T();
-            }
-
-            //Shift the entire array over the removed elemends
-            for(auto iter{ to }, move_to{ from }; iter != end(); ++iter, ++move_to) {
-                *move_to = std::move(*iter);
-                (*iter).~T();
-            }
+        //Destruct the items we are going to remove then shift the rest of the array over them.
+        for(std::size_t i{ index }; i < index + count; ++i) {
+            first[i].~T();
+        }
+        internal::relocate_items(first + index + count, first + index, elems - (index + count));
 
-            elems -= count;
+        elems -= count;
 
-            return from;
-        }
+        return begin() + index;
     }
 
-    template<typename T>
-    void array<T>::erase(T const &value) {
-        erase(std::remove(begin(), end(), value));
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::erase(T const &value) {
+        erase(std::remove(begin(), end(), value), end());
     }
 
-    template<typename T>
-    void array<T>::reserve(std::size_t new_capacity) {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::reserve(std::size_t new_capacity) {
         if(cap < new_capacity) {
             cap = new_capacity;
             reallocate_array(cap, reallocate_type::preserve_current_items);
         }
     }
 
-    template<typename T>
+    template<typename T, allocator allocator_t>
     template<typename... args_t>
-    void array<T>::resize(std::size_t const size, args_t &&...args) {
+    void array<T, allocator_t>::resize(std::size_t const size, args_t &&...args) {
         if(cap < size) {
             cap = size;
             reallocate_array(cap, reallocate_type::preserve_current_items);
@@ -463,97 +563,102 @@ namespace ember::inline containers {
         elems = size;
     }
 
-    template<typename T>
-    void array<T>::clear() {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::clear() {
         for(std::size_t i{ 0 }; i < elems; ++i) {
             first[i].~T();
         }
         elems = 0;
     }
 
-    template<typename T>
-    std::size_t array<T>::size() const noexcept {
+    template<typename T, allocator allocator_t>
+    std::size_t array<T, allocator_t>::size() const noexcept {
         return elems;
     }
 
-    template<typename T>
-    std::size_t array<T>::capacity() const noexcept {
+    template<typename T, allocator allocator_t>
+    std::size_t array<T, allocator_t>::capacity() const noexcept {
         return cap;
     }
 
-    template<typename T>
-    bool array<T>::empty() const noexcept {
+    template<typename T, allocator allocator_t>
+    bool array<T, allocator_t>::empty() const noexcept {
         return elems == 0;
     }
 
-    template<typename T>
-    array<T>::reference_type array<T>::front() {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::reference_type array<T, allocator_t>::front() {
         EMBER_CHECK(elems > 0);
         return *first;
     }
 
-    template<typename T>
-    array<T>::const_reference_type array<T>::front() const {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::const_reference_type array<T, allocator_t>::front() const {
         EMBER_CHECK(elems > 0);
         return *first;
     }
 
-    template<typename T>
-    array<T>::reference_type array<T>::back() {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::reference_type array<T, allocator_t>::back() {
         EMBER_CHECK(elems > 0);
         return *(first + (elems - 1));
     }
 
-    template<typename T>
-    array<T>::const_reference_type array<T>::back() const {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::const_reference_type array<T, allocator_t>::back() const {
         EMBER_CHECK(elems > 0);
         return *(first + (elems - 1));
     }
 
-    template<typename T>
-    array<T>::pointer_type array<T>::data() {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::pointer_type array<T, allocator_t>::data() {
         return first;
     }
 
-    template<typename T>
-    array<T>::const_pointer_type array<T>::data() const {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::const_pointer_type array<T, allocator_t>::data() const {
         return first;
     }
 
-    template<typename T>
-    array<T>::iterator array<T>::begin() noexcept {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::iterator array<T, allocator_t>::begin() noexcept {
         return iterator{ this, first };
     }
 
-    template<typename T>
-    array<T>::const_iterator array<T>::begin() const noexcept {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::const_iterator array<T, allocator_t>::begin() const noexcept {
         return const_iterator{ this, first };
     }
 
-    template<typename T>
-    array<T>::iterator array<T>::end() noexcept {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::iterator array<T, allocator_t>::end() noexcept {
         return iterator{ this, first + elems };
     }
 
-    template<typename T>
-    array<T>::const_iterator array<T>::end() const noexcept {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::const_iterator array<T, allocator_t>::end() const noexcept {
         return const_iterator{ this, first + elems };
     }
 
-    template<typename T>
-    array<T>::reference_type array<T>::operator[](std::size_t pos) {
+    template<typename T, allocator allocator_t>
+    allocator_t array<T, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::reference_type array<T, allocator_t>::operator[](std::size_t pos) {
         EMBER_CHECK(pos < elems);
         return first[pos];
     }
 
-    template<typename T>
-    array<T>::const_reference_type array<T>::operator[](std::size_t pos) const {
+    template<typename T, allocator allocator_t>
+    array<T, allocator_t>::const_reference_type array<T, allocator_t>::operator[](std::size_t pos) const {
         EMBER_CHECK(pos < elems);
         return first[pos];
     }
 
-    template<typename array_type_1, typename array_type_2>
-    bool operator==(array<array_type_1> const &lhs, array<array_type_2> const &rhs) {
+    template<typename array_type_1, typename allocator_t_1, typename array_type_2, typename allocator_t_2>
+    bool operator==(array<array_type_1, allocator_t_1> const &lhs, array<array_type_2, allocator_t_2> const &rhs) {
         if(lhs.size() != rhs.size()) {
             return false;
         }
@@ -561,44 +666,46 @@ namespace ember::inline containers {
         return std::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
 
-    template<typename array_type_1, typename array_type_2>
-    bool operator!=(array<array_type_1> const &lhs, array<array_type_2> const &rhs) {
+    template<typename array_type_1, typename allocator_t_1, typename array_type_2, typename allocator_t_2>
+    bool operator!=(array<array_type_1, allocator_t_1> const &lhs, array<array_type_2, allocator_t_2> const &rhs) {
         return !(lhs == rhs);
     }
 
-    template<typename T>
-    void array<T>::allocate_array(std::size_t const capacity) {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::allocate_array(std::size_t const capacity) {
         EMBER_CHECK(memory == nullptr);
 
-        memory = memory::alloc(sizeof(value_type) * capacity, alignof(value_type));
+        memory = allocator.alloc(sizeof(value_type) * capacity, alignof(value_type));
         EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate array." });
         first = reinterpret_cast<pointer_type>(memory);
     }
 
-    template<typename T>
-    void array<T>::reallocate_array(std::size_t const new_capacity, reallocate_type const type) {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::reallocate_array(std::size_t const new_capacity, reallocate_type const type) {
         if(memory != nullptr) {
+            if constexpr(is_trivially_relocatable_v<T>) {
+                //Trivially relocatable items can be moved by the allocator which can avoid the copy entirely if it can grow in place.
+                if(type == reallocate_type::preserve_current_items) {
+                    memory = memory::reallocate(allocator, memory, sizeof(value_type) * elems, sizeof(value_type) * new_capacity, alignof(value_type));
+                    EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to reallocate array." });
+                    first = reinterpret_cast<pointer_type>(memory);
+
+                    return;
+                }
+            }
+
             if(type == reallocate_type::preserve_current_items) {
-                std::byte *new_memory{ memory::alloc(sizeof(value_type) * new_capacity, alignof(value_type)) };
-                EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to reallocate array." });
+                std::byte *new_memory{ allocator.alloc(sizeof(value_type) * new_capacity, alignof(value_type)) };
+                EMBER_THROW_IF_FAILED(new_memory != nullptr, exception{ "Failed to reallocate array." });
                 auto *new_first{ reinterpret_cast<pointer_type>(new_memory) };
 
-                if constexpr(std::is_nothrow_move_constructible_v<T> || !std::is_copy_constructible_v<T>) {
-                    for(std::size_t i{ 0 }; i < elems; ++i) {
-                        new(&new_first[i]) value_type{ std::move(first[i]) };
-                    }
-                } else {
-                    for(std::size_t i{ 0 }; i < elems; ++i) {
-                        new(&new_first[i]) value_type{ first[i] };
-                    }
-                }
-                destruct_items();//Make sure we destruct the previous items, even if we moved.
+                internal::relocate_items(first, new_first, elems);
 
-                memory::free(memory);
+                allocator.free(memory);
                 memory = new_memory;
                 first  = new_first;
             } else {
-                memory = memory::realloc(memory, sizeof(value_type) * new_capacity, alignof(value_type));
+                memory = memory::reallocate(allocator, memory, 0, sizeof(value_type) * new_capacity, alignof(value_type));
                 EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to reallocate array." });
                 first = reinterpret_cast<pointer_type>(memory);
             }
@@ -607,15 +714,15 @@ namespace ember::inline containers {
         }
     }
 
-    template<typename T>
-    void array<T>::destruct_items() {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::destruct_items() {
         for(std::size_t i{ 0 }; i < elems; ++i) {
             first[i].~T();
         }
     }
 
-    template<typename T>
-    void array<T>::double_size() {
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::double_size() {
         if(cap == 0) {
             cap = 1;
         } else {
@@ -623,4 +730,13 @@ namespace ember::inline containers {
         }
         reallocate_array(cap, reallocate_type::preserve_current_items);
     }
-}
\ No newline at end of file
+
+    template<typename T, allocator allocator_t>
+    void array<T, allocator_t>::grow_to_fit(std::size_t const size) {
+        if(cap < size) {
+            //Keep growing geometrically so repeated appends stay amortised.
+            cap = std::max(size, cap * 2);
+            reallocate_array(cap, reallocate_type::preserve_current_items);
+        }
+    }
+}
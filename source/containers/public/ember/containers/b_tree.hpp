@@ -0,0 +1,409 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/array.hpp>
+#include <ember/memory/allocator.hpp>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ember::inline containers::internal {
+    inline std::size_t constexpr b_tree_node_size{ 256 }; /**< How many bytes each node aims to take up. A few cache lines so a node is searched with few misses. */
+
+    template<typename key_t, typename mapped_t>
+    struct b_tree_value {
+        using type = std::pair<key_t const, mapped_t>;
+    };
+    template<typename key_t>
+    struct b_tree_value<key_t, void> {
+        using type = key_t;
+    };
+
+    template<typename tree_t, typename value_t>
+    class b_tree_iterator {
+        template<typename other_tree_t, typename other_value_t>
+        friend class b_tree_iterator;
+        friend tree_t;
+
+        //TYPES
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        using value_type     = std::remove_const_t<value_t>;
+        using pointer_type   = value_t *;
+        using reference_type = value_t &;
+
+        using difference_type = std::ptrdiff_t;
+
+    private:
+        using leaf_type = typename tree_t::leaf_node;
+
+        //VARIABLES
+    private:
+        leaf_type *leaf{ nullptr };
+        std::size_t index{ 0 };
+
+        //FUNCTIONS
+    public:
+        b_tree_iterator();
+        b_tree_iterator(leaf_type *leaf, std::size_t const index);
+        /**
+         * @brief Allows an iterator to be converted into a const_iterator.
+         */
+        template<typename other_value_t>
+        b_tree_iterator(b_tree_iterator<tree_t, other_value_t> const &other) requires std::same_as<value_t, other_value_t const>;
+
+        b_tree_iterator(b_tree_iterator const &other);
+        b_tree_iterator(b_tree_iterator &&other) noexcept;
+
+        b_tree_iterator &operator=(b_tree_iterator const &other);
+        b_tree_iterator &operator=(b_tree_iterator &&other) noexcept;
+
+        ~b_tree_iterator();
+
+        pointer_type operator->() const;
+        reference_type operator*() const;
+
+        b_tree_iterator &operator++();
+        b_tree_iterator operator++(int);
+
+        b_tree_iterator &operator--();
+        b_tree_iterator operator--(int);
+
+        template<typename tree_t_1, typename value_t_1, typename value_t_2>
+        friend bool operator==(b_tree_iterator<tree_t_1, value_t_1> const &lhs, b_tree_iterator<tree_t_1, value_t_2> const &rhs) noexcept;
+        template<typename tree_t_1, typename value_t_1, typename value_t_2>
+        friend bool operator!=(b_tree_iterator<tree_t_1, value_t_1> const &lhs, b_tree_iterator<tree_t_1, value_t_2> const &rhs) noexcept;
+    };
+}
+
+namespace ember::inline containers {
+    /**
+     * @brief Ordered associative container implemented as a B+-tree.
+     * @details Items are stored inline in wide leaf nodes that are linked together, so iterating in order walks
+     * contiguous memory a node at a time instead of chasing a pointer per item. Internal nodes only hold copies
+     * of keys to guide searches, which means keys must be copy constructible. Inserting and erasing can move items
+     * between nodes, invalidating any references, pointers or iterators into the tree. Backs ordered_map (when
+     * mapped_t is not void) and set (when mapped_t is void).
+     * @tparam key_t
+     * @tparam mapped_t Type of the value mapped to each key. Void if the tree only stores keys.
+     * @tparam compare_t Strict weak ordering of keys.
+     * @tparam allocator_t Allocator used for the tree's nodes.
+     */
+    template<typename key_t, typename mapped_t, typename compare_t = std::less<key_t>, allocator allocator_t = global_allocator_ref>
+    class b_tree {
+        template<typename tree_t, typename value_t>
+        friend class internal::b_tree_iterator;
+
+        //TYPES
+    private:
+        static bool constexpr is_map{ !std::is_void_v<mapped_t> };
+
+    public:
+        using key_type             = key_t;
+        using mapped_type          = mapped_t;
+        using value_type           = typename internal::b_tree_value<key_t, mapped_t>::type;
+        using key_compare          = compare_t;
+        using allocator_type       = allocator_t;
+        using pointer_type         = value_type *;
+        using const_pointer_type   = value_type const *;
+        using reference_type       = value_type &;
+        using const_reference_type = value_type const &;
+
+        using iterator               = internal::b_tree_iterator<b_tree, std::conditional_t<is_map, value_type, value_type const>>;
+        using const_iterator         = internal::b_tree_iterator<b_tree, value_type const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        //Void for sets so the functions that only make sense for maps can still be declared.
+        using mapped_reference_type       = std::conditional_t<is_map, std::add_lvalue_reference_t<mapped_t>, void>;
+        using const_mapped_reference_type = std::conditional_t<is_map, std::add_lvalue_reference_t<std::add_const_t<mapped_t>>, void>;
+
+        struct node {
+            std::uint16_t count{ 0 }; /**< Number of items in a leaf or keys in an internal node. */
+            bool is_leaf{ true };
+        };
+
+        static std::size_t constexpr leaf_capacity{ std::max<std::size_t>(4, (internal::b_tree_node_size - sizeof(node) - (sizeof(void *) * 2)) / sizeof(value_type)) };
+        static std::size_t constexpr internal_capacity{ std::max<std::size_t>(4, (internal::b_tree_node_size - sizeof(node) - sizeof(void *)) / (sizeof(key_t) + sizeof(void *))) };
+
+        static std::size_t constexpr min_leaf_count{ leaf_capacity / 2 };
+        static std::size_t constexpr min_internal_count{ (internal_capacity - 1) / 2 };
+
+        struct leaf_node : public node {
+            leaf_node *previous{ nullptr };
+            leaf_node *next{ nullptr };
+
+            alignas(value_type) std::byte storage[sizeof(value_type) * leaf_capacity];
+
+            value_type *get_items() noexcept;
+        };
+
+        struct internal_node : public node {
+            node *children[internal_capacity + 1]{}; /**< Everything in children[i] is less than keys[i] and not less than keys[i - 1]. */
+
+            alignas(key_t) std::byte storage[sizeof(key_t) * internal_capacity];
+
+            key_t *get_keys() noexcept;
+        };
+
+        /**
+         * @brief Where an item was inserted and, if the node it was inserted into had to split, the node that
+         * needs adding to the parent.
+         */
+        struct insert_result {
+            leaf_node *leaf{ nullptr };
+            std::size_t index{ 0 };
+            bool inserted{ false };
+
+            std::optional<key_t> split_key{};
+            node *split_node{ nullptr };
+        };
+
+        //VARIABLES
+    private:
+        node *root{ nullptr };
+        leaf_node *first_leaf{ nullptr };
+        leaf_node *last_leaf{ nullptr };
+
+        std::size_t elems{ 0 }; /**< How many items are currently stored in this tree. */
+
+        [[no_unique_address]] compare_t compare{};
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the tree's nodes are allocated from. */
+
+        //FUNCTIONS
+    public:
+        b_tree() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit b_tree(allocator_t allocator) noexcept;
+        b_tree(std::initializer_list<value_type> init) requires std::is_default_constructible_v<allocator_t>;
+
+        b_tree(b_tree const &other);
+        b_tree(b_tree &&other) noexcept;
+
+        b_tree &operator=(b_tree const &other);
+        b_tree &operator=(b_tree &&other) noexcept;
+
+        ~b_tree();
+
+        /**
+         * @brief Inserts item if it's key is not already in the tree.
+         * @param item
+         * @return An iterator to the item with item's key and true if the item was inserted.
+         */
+        std::pair<iterator, bool> insert(value_type const &item);
+        /**
+         * @overload insert(value_type const &item)
+         */
+        std::pair<iterator, bool> insert(value_type &&item);
+
+        /**
+         * @brief Constructs an item from args and inserts it if it's key is not already in the tree.
+         * @return An iterator to the item with the key and true if the item was inserted.
+         */
+        template<typename... args_t>
+        std::pair<iterator, bool> emplace(args_t &&...args);
+
+        /**
+         * @brief Constructs a value from args if key is not already in the tree. Unlike emplace, nothing is
+         * constructed if key already exists.
+         * @return An iterator to the item with key and true if the item was inserted.
+         */
+        template<typename... args_t>
+        std::pair<iterator, bool> try_emplace(key_t const &key, args_t &&...args) requires is_map;
+
+        /**
+         * @brief Replaces the contents of the tree with copies of the items in [begin, end).
+         * @details The items must be sorted and have unique keys. Builds the tree bottom up with every node
+         * close to full, which is much faster than inserting each item and leaves the tree denser.
+         * @param begin
+         * @param end
+         */
+        template<typename iterator_type>
+        void bulk_load(iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Erases the item with key if it exists.
+         * @param key
+         * @return How many items were erased.
+         */
+        std::size_t erase(key_t const &key);
+        /**
+         * @brief Erases the item at where.
+         * @param where
+         * @return An iterator to the item after where.
+         */
+        iterator erase(const_iterator where);
+
+        /**
+         * @brief Destructs every item in the tree and frees all of it's nodes.
+         */
+        void clear();
+
+        /**
+         * @brief Returns the number of items.
+         * @return
+         */
+        std::size_t size() const noexcept;
+
+        /**
+         * @brief Returns true if this tree contains no items.
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the item with key or end() if it doesn't exist.
+         * @param key
+         * @return
+         */
+        iterator find(key_t const &key);
+        /**
+         * @overload find(key_t const &key)
+         */
+        const_iterator find(key_t const &key) const;
+
+        bool contains(key_t const &key) const;
+        std::size_t count(key_t const &key) const;
+
+        /**
+         * @brief Returns an iterator to the first item with a key that is not less than key.
+         * @param key
+         * @return
+         */
+        iterator lower_bound(key_t const &key);
+        /**
+         * @overload lower_bound(key_t const &key)
+         */
+        const_iterator lower_bound(key_t const &key) const;
+        /**
+         * @brief Returns an iterator to the first item with a key that is greater than key.
+         * @param key
+         * @return
+         */
+        iterator upper_bound(key_t const &key);
+        /**
+         * @overload upper_bound(key_t const &key)
+         */
+        const_iterator upper_bound(key_t const &key) const;
+
+        /**
+         * @brief Returns the value of the item with key. Throws if key doesn't exist.
+         * @param key
+         * @return
+         */
+        mapped_reference_type at(key_t const &key) requires is_map;
+        /**
+         * @overload at(key_t const &key)
+         */
+        const_mapped_reference_type at(key_t const &key) const requires is_map;
+
+        /**
+         * @brief Returns an iterator to the smallest item in this tree.
+         * @return
+         */
+        iterator begin() noexcept;
+        /**
+         * @overload begin()
+         */
+        const_iterator begin() const noexcept;
+        /**
+         * @brief Returns an iterator to the end of this tree.
+         * @return
+         */
+        iterator end() noexcept;
+        /**
+         * @overload end()
+         */
+        const_iterator end() const noexcept;
+
+        reverse_iterator rbegin() noexcept;
+        const_reverse_iterator rbegin() const noexcept;
+        reverse_iterator rend() noexcept;
+        const_reverse_iterator rend() const noexcept;
+
+        /**
+         * @brief Returns the allocator this tree allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+        /**
+         * @brief Returns the value of the item with key, default constructing it if it doesn't exist.
+         * @param key
+         * @return
+         */
+        mapped_reference_type operator[](key_t const &key) requires is_map && std::is_default_constructible_v<mapped_t>;
+
+        template<typename key_t_1, typename mapped_t_1, typename compare_t_1, typename allocator_t_1>
+        friend bool operator==(b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &lhs, b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &rhs);
+        template<typename key_t_1, typename mapped_t_1, typename compare_t_1, typename allocator_t_1>
+        friend bool operator!=(b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &lhs, b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &rhs);
+
+    private:
+        static key_t const &get_key(value_type const &item);
+
+        /**
+         * @brief Returns the index of the first item in leaf that is not less than key.
+         */
+        std::size_t find_item_index(leaf_node *leaf, key_t const &key) const;
+        /**
+         * @brief Returns the index of the child of branch that key belongs in.
+         */
+        std::size_t find_child_index(internal_node *branch, key_t const &key) const;
+        /**
+         * @brief Returns the leaf key belongs in. The tree must not be empty.
+         */
+        leaf_node *find_leaf(key_t const &key) const;
+
+        /**
+         * @brief Constructs an item from args in the leaf key belongs in if key isn't already in the subtree at current,
+         * splitting any nodes on the way back up that are full.
+         */
+        template<typename... args_t>
+        insert_result insert_unique(node *current, key_t const &key, args_t &&...args);
+        template<typename... args_t>
+        std::pair<iterator, bool> insert_root(key_t const &key, args_t &&...args);
+        void insert_child(internal_node *branch, std::size_t const index, key_t &&key, node *child);
+
+        /**
+         * @brief Erases key from the subtree at current, rebalancing any children that end up less than half full.
+         */
+        bool erase_from(node *current, key_t const &key);
+        void rebalance_child(internal_node *branch, std::size_t const index);
+        /**
+         * @brief Merges branch's child at index + 1 into the child at index.
+         */
+        void merge_children(internal_node *branch, std::size_t const index);
+
+        leaf_node *allocate_leaf();
+        internal_node *allocate_internal();
+        void free_node(node *to_free);
+        void free_subtree(node *subtree);
+        node *copy_subtree(node *subtree, leaf_node *&previous_leaf);
+
+        iterator make_iterator(leaf_node *leaf, std::size_t const index) const;
+    };
+}
+
+namespace std {
+    //Specialised iterator traits for certain std algorithms.
+    template<typename tree_t, typename value_t>
+    struct iterator_traits<ember::containers::internal::b_tree_iterator<tree_t, value_t>> {
+        using iterator_category = typename ember::containers::internal::b_tree_iterator<tree_t, value_t>::iterator_category;
+
+        using value_type = typename ember::containers::internal::b_tree_iterator<tree_t, value_t>::value_type;
+        using pointer    = typename ember::containers::internal::b_tree_iterator<tree_t, value_t>::pointer_type;
+        using reference  = typename ember::containers::internal::b_tree_iterator<tree_t, value_t>::reference_type;
+
+        using difference_type = typename ember::containers::internal::b_tree_iterator<tree_t, value_t>::difference_type;
+    };
+}
+
+#include "b_tree.inl"
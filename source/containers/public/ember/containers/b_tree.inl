@@ -0,0 +1,913 @@
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <memory>
+#include <new>
+#include <span>
+#include <tuple>
+
+namespace ember::inline containers {
+    namespace internal {
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t>::b_tree_iterator() = default;
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t>::b_tree_iterator(leaf_type *leaf, std::size_t const index)
+            : leaf{ leaf }
+            , index{ index } {
+        }
+
+        template<typename tree_t, typename value_t>
+        template<typename other_value_t>
+        b_tree_iterator<tree_t, value_t>::b_tree_iterator(b_tree_iterator<tree_t, other_value_t> const &other) requires std::same_as<value_t, other_value_t const>
+            : leaf{ other.leaf }
+            , index{ other.index } {
+        }
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t>::b_tree_iterator(b_tree_iterator const &other) = default;
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t>::b_tree_iterator(b_tree_iterator &&other) noexcept = default;
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t> &b_tree_iterator<tree_t, value_t>::operator=(b_tree_iterator const &other) = default;
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t> &b_tree_iterator<tree_t, value_t>::operator=(b_tree_iterator &&other) noexcept = default;
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t>::~b_tree_iterator() = default;
+
+        template<typename tree_t, typename value_t>
+        typename b_tree_iterator<tree_t, value_t>::pointer_type b_tree_iterator<tree_t, value_t>::operator->() const {
+            EMBER_CHECK(leaf != nullptr && index < leaf->count);
+            return leaf->get_items() + index;
+        }
+
+        template<typename tree_t, typename value_t>
+        typename b_tree_iterator<tree_t, value_t>::reference_type b_tree_iterator<tree_t, value_t>::operator*() const {
+            EMBER_CHECK(leaf != nullptr && index < leaf->count);
+            return leaf->get_items()[index];
+        }
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t> &b_tree_iterator<tree_t, value_t>::operator++() {
+            EMBER_CHECK(leaf != nullptr && index < leaf->count);
+
+            //Only the last leaf's iterator can point past it's items, which is end().
+            if(++index == leaf->count && leaf->next != nullptr) {
+                leaf  = leaf->next;
+                index = 0;
+            }
+            return *this;
+        }
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t> b_tree_iterator<tree_t, value_t>::operator++(int) {
+            b_tree_iterator previous{ *this };
+            ++(*this);
+            return previous;
+        }
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t> &b_tree_iterator<tree_t, value_t>::operator--() {
+            EMBER_CHECK(leaf != nullptr);
+
+            if(index == 0) {
+                EMBER_CHECK(leaf->previous != nullptr);
+                leaf  = leaf->previous;
+                index = leaf->count;
+            }
+            --index;
+            return *this;
+        }
+
+        template<typename tree_t, typename value_t>
+        b_tree_iterator<tree_t, value_t> b_tree_iterator<tree_t, value_t>::operator--(int) {
+            b_tree_iterator previous{ *this };
+            --(*this);
+            return previous;
+        }
+
+        template<typename tree_t_1, typename value_t_1, typename value_t_2>
+        bool operator==(b_tree_iterator<tree_t_1, value_t_1> const &lhs, b_tree_iterator<tree_t_1, value_t_2> const &rhs) noexcept {
+            return lhs.leaf == rhs.leaf && lhs.index == rhs.index;
+        }
+
+        template<typename tree_t_1, typename value_t_1, typename value_t_2>
+        bool operator!=(b_tree_iterator<tree_t_1, value_t_1> const &lhs, b_tree_iterator<tree_t_1, value_t_2> const &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::value_type *b_tree<key_t, mapped_t, compare_t, allocator_t>::leaf_node::get_items() noexcept {
+        return std::launder(reinterpret_cast<value_type *>(storage));
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    key_t *b_tree<key_t, mapped_t, compare_t, allocator_t>::internal_node::get_keys() noexcept {
+        return std::launder(reinterpret_cast<key_t *>(storage));
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t>::b_tree() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t>::b_tree(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t>::b_tree(std::initializer_list<value_type> init) requires std::is_default_constructible_v<allocator_t> {
+        for(auto const &item : init) {
+            insert(item);
+        }
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t>::b_tree(b_tree const &other)
+        : elems{ other.elems }
+        , compare{ other.compare }
+        , allocator{ other.allocator } {
+        if(other.root != nullptr) {
+            leaf_node *previous_leaf{ nullptr };
+            root      = copy_subtree(other.root, previous_leaf);
+            last_leaf = previous_leaf;
+        }
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t>::b_tree(b_tree &&other) noexcept
+        : root{ std::exchange(other.root, nullptr) }
+        , first_leaf{ std::exchange(other.first_leaf, nullptr) }
+        , last_leaf{ std::exchange(other.last_leaf, nullptr) }
+        , elems{ std::exchange(other.elems, 0) }
+        , compare{ std::move(other.compare) }
+        , allocator{ other.allocator } {
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t> &b_tree<key_t, mapped_t, compare_t, allocator_t>::operator=(b_tree const &other) {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+
+        compare = other.compare;
+        elems   = other.elems;
+        if(other.root != nullptr) {
+            leaf_node *previous_leaf{ nullptr };
+            root      = copy_subtree(other.root, previous_leaf);
+            last_leaf = previous_leaf;
+        }
+
+        return *this;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t> &b_tree<key_t, mapped_t, compare_t, allocator_t>::operator=(b_tree &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+
+        //We can only take other's nodes if our allocator can free them.
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
+        }
+
+        compare = std::move(other.compare);
+        if(can_take_memory) {
+            root       = std::exchange(other.root, nullptr);
+            first_leaf = std::exchange(other.first_leaf, nullptr);
+            last_leaf  = std::exchange(other.last_leaf, nullptr);
+            elems      = std::exchange(other.elems, 0);
+        } else {
+            for(leaf_node *leaf{ other.first_leaf }; leaf != nullptr; leaf = leaf->next) {
+                for(value_type &item : std::span{ leaf->get_items(), leaf->count }) {
+                    insert_root(get_key(item), std::move(item));
+                }
+            }
+            other.clear();
+        }
+
+        return *this;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    b_tree<key_t, mapped_t, compare_t, allocator_t>::~b_tree() {
+        clear();
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::pair<typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator, bool> b_tree<key_t, mapped_t, compare_t, allocator_t>::insert(value_type const &item) {
+        return insert_root(get_key(item), item);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::pair<typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator, bool> b_tree<key_t, mapped_t, compare_t, allocator_t>::insert(value_type &&item) {
+        //The key is only read before item is moved into the tree.
+        return insert_root(get_key(item), std::move(item));
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    template<typename... args_t>
+    std::pair<typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator, bool> b_tree<key_t, mapped_t, compare_t, allocator_t>::emplace(args_t &&...args) {
+        value_type item{ std::forward<args_t>(args)... };
+        return insert_root(get_key(item), std::move(item));
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    template<typename... args_t>
+    std::pair<typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator, bool> b_tree<key_t, mapped_t, compare_t, allocator_t>::try_emplace(key_t const &key, args_t &&...args) requires is_map {
+        return insert_root(key, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<args_t>(args)...));
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    template<typename iterator_type>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::bulk_load(iterator_type begin, iterator_type end) {
+        EMBER_CHECK(std::adjacent_find(begin, end, [this](auto const &lhs, auto const &rhs) { return !compare(get_key(lhs), get_key(rhs)); }) == end);
+
+        clear();
+
+        std::size_t const item_count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        if(item_count == 0) {
+            return;
+        }
+
+        //Spread the items evenly so every node, other than a lone root, is at least half full.
+        array<std::pair<node *, key_t const *>> level{};//Each node in the current level and the smallest key in it.
+        {
+            std::size_t const leaf_count{ (item_count + leaf_capacity - 1) / leaf_capacity };
+            level.reserve(leaf_count);
+
+            leaf_node *previous_leaf{ nullptr };
+            for(std::size_t i{ 0 }; i < leaf_count; ++i) {
+                std::size_t const count{ (item_count / leaf_count) + (i < item_count % leaf_count ? 1 : 0) };
+
+                leaf_node *const leaf{ allocate_leaf() };
+                value_type *const items{ leaf->get_items() };
+                for(std::size_t j{ 0 }; j < count; ++j, ++begin) {
+                    new(items + j) value_type{ *begin };
+                    leaf->count = static_cast<std::uint16_t>(j + 1);
+                }
+
+                leaf->previous = previous_leaf;
+                if(previous_leaf != nullptr) {
+                    previous_leaf->next = leaf;
+                } else {
+                    first_leaf = leaf;
+                }
+                previous_leaf = leaf;
+
+                level.emplace_back(leaf, &get_key(items[0]));
+            }
+            last_leaf = previous_leaf;
+        }
+
+        while(level.size() > 1) {
+            std::size_t const parent_count{ (level.size() + internal_capacity) / (internal_capacity + 1) };
+
+            array<std::pair<node *, key_t const *>> parents{};
+            parents.reserve(parent_count);
+
+            for(std::size_t i{ 0 }, child{ 0 }; i < parent_count; ++i) {
+                std::size_t const child_count{ (level.size() / parent_count) + (i < level.size() % parent_count ? 1 : 0) };
+
+                internal_node *const parent{ allocate_internal() };
+                key_t *const keys{ parent->get_keys() };
+
+                parent->children[0] = level[child].first;
+                for(std::size_t j{ 1 }; j < child_count; ++j) {
+                    new(keys + (j - 1)) key_t{ *level[child + j].second };
+                    parent->children[j] = level[child + j].first;
+                    parent->count       = static_cast<std::uint16_t>(j);
+                }
+
+                parents.emplace_back(parent, level[child].second);
+                child += child_count;
+            }
+
+            level = std::move(parents);
+        }
+
+        root  = level[0].first;
+        elems = item_count;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::size_t b_tree<key_t, mapped_t, compare_t, allocator_t>::erase(key_t const &key) {
+        if(root == nullptr || !erase_from(root, key)) {
+            return 0;
+        }
+
+        --elems;
+
+        //Shrink the tree once the root runs out of keys.
+        if(!root->is_leaf && root->count == 0) {
+            node *const old_root{ root };
+            root = static_cast<internal_node *>(root)->children[0];
+            free_node(old_root);
+        } else if(root->is_leaf && root->count == 0) {
+            free_node(root);
+            root       = nullptr;
+            first_leaf = nullptr;
+            last_leaf  = nullptr;
+        }
+
+        return 1;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::erase(const_iterator where) {
+        //Rebalancing can move the following item into another node so find it again by key.
+        key_t const key{ get_key(*where) };
+        erase(key);
+        return lower_bound(key);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::clear() {
+        if(root != nullptr) {
+            free_subtree(root);
+        }
+
+        root       = nullptr;
+        first_leaf = nullptr;
+        last_leaf  = nullptr;
+        elems      = 0;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::size_t b_tree<key_t, mapped_t, compare_t, allocator_t>::size() const noexcept {
+        return elems;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    bool b_tree<key_t, mapped_t, compare_t, allocator_t>::empty() const noexcept {
+        return elems == 0;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::find(key_t const &key) {
+        if(root == nullptr) {
+            return end();
+        }
+
+        leaf_node *const leaf{ find_leaf(key) };
+        std::size_t const index{ find_item_index(leaf, key) };
+        if(index == leaf->count || compare(key, get_key(leaf->get_items()[index]))) {
+            return end();
+        }
+
+        return iterator{ leaf, index };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::find(key_t const &key) const {
+        return const_cast<b_tree *>(this)->find(key);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    bool b_tree<key_t, mapped_t, compare_t, allocator_t>::contains(key_t const &key) const {
+        return find(key) != end();
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::size_t b_tree<key_t, mapped_t, compare_t, allocator_t>::count(key_t const &key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::lower_bound(key_t const &key) {
+        if(root == nullptr) {
+            return end();
+        }
+
+        leaf_node *const leaf{ find_leaf(key) };
+        return make_iterator(leaf, find_item_index(leaf, key));
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::lower_bound(key_t const &key) const {
+        return const_cast<b_tree *>(this)->lower_bound(key);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::upper_bound(key_t const &key) {
+        iterator result{ lower_bound(key) };
+        if(result != end() && !compare(key, get_key(*result))) {
+            ++result;
+        }
+        return result;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::upper_bound(key_t const &key) const {
+        return const_cast<b_tree *>(this)->upper_bound(key);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::mapped_reference_type b_tree<key_t, mapped_t, compare_t, allocator_t>::at(key_t const &key) requires is_map {
+        iterator const iter{ find(key) };
+        EMBER_THROW_IF_FAILED(iter != end(), exception{ "Key does not exist in b_tree." });
+
+        return iter->second;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_mapped_reference_type b_tree<key_t, mapped_t, compare_t, allocator_t>::at(key_t const &key) const requires is_map {
+        const_iterator const iter{ find(key) };
+        EMBER_THROW_IF_FAILED(iter != end(), exception{ "Key does not exist in b_tree." });
+
+        return iter->second;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::begin() noexcept {
+        return iterator{ first_leaf, 0 };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::begin() const noexcept {
+        return const_iterator{ first_leaf, 0 };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::end() noexcept {
+        return iterator{ last_leaf, last_leaf != nullptr ? last_leaf->count : 0u };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::end() const noexcept {
+        return const_iterator{ last_leaf, last_leaf != nullptr ? last_leaf->count : 0u };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::reverse_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::rbegin() noexcept {
+        return reverse_iterator{ end() };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_reverse_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::rbegin() const noexcept {
+        return const_reverse_iterator{ end() };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::reverse_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::rend() noexcept {
+        return reverse_iterator{ begin() };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::const_reverse_iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::rend() const noexcept {
+        return const_reverse_iterator{ begin() };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    allocator_t b_tree<key_t, mapped_t, compare_t, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::mapped_reference_type b_tree<key_t, mapped_t, compare_t, allocator_t>::operator[](key_t const &key) requires is_map && std::is_default_constructible_v<mapped_t> {
+        return try_emplace(key).first->second;
+    }
+
+    template<typename key_t_1, typename mapped_t_1, typename compare_t_1, typename allocator_t_1>
+    bool operator==(b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &lhs, b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<typename key_t_1, typename mapped_t_1, typename compare_t_1, typename allocator_t_1>
+    bool operator!=(b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &lhs, b_tree<key_t_1, mapped_t_1, compare_t_1, allocator_t_1> const &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    key_t const &b_tree<key_t, mapped_t, compare_t, allocator_t>::get_key(value_type const &item) {
+        if constexpr(is_map) {
+            return item.first;
+        } else {
+            return item;
+        }
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::size_t b_tree<key_t, mapped_t, compare_t, allocator_t>::find_item_index(leaf_node *leaf, key_t const &key) const {
+        value_type const *const items{ leaf->get_items() };
+
+        std::size_t first{ 0 };
+        std::size_t count{ leaf->count };
+        while(count > 0) {
+            std::size_t const step{ count / 2 };
+            if(compare(get_key(items[first + step]), key)) {
+                first += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    std::size_t b_tree<key_t, mapped_t, compare_t, allocator_t>::find_child_index(internal_node *branch, key_t const &key) const {
+        key_t const *const keys{ branch->get_keys() };
+
+        std::size_t first{ 0 };
+        std::size_t count{ branch->count };
+        while(count > 0) {
+            std::size_t const step{ count / 2 };
+            if(!compare(key, keys[first + step])) {
+                first += step + 1;
+                count -= step + 1;
+            } else {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::leaf_node *b_tree<key_t, mapped_t, compare_t, allocator_t>::find_leaf(key_t const &key) const {
+        node *current{ root };
+        while(!current->is_leaf) {
+            auto *const branch{ static_cast<internal_node *>(current) };
+            current = branch->children[find_child_index(branch, key)];
+        }
+
+        return static_cast<leaf_node *>(current);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    template<typename... args_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::insert_result b_tree<key_t, mapped_t, compare_t, allocator_t>::insert_unique(node *current, key_t const &key, args_t &&...args) {
+        if(!current->is_leaf) {
+            auto *const branch{ static_cast<internal_node *>(current) };
+            std::size_t const child_index{ find_child_index(branch, key) };
+
+            insert_result result{ insert_unique(branch->children[child_index], key, std::forward<args_t>(args)...) };
+            if(result.split_node == nullptr) {
+                return result;
+            }
+
+            if(branch->count < internal_capacity) {
+                insert_child(branch, child_index, std::move(*result.split_key), result.split_node);
+                result.split_key.reset();
+                result.split_node = nullptr;
+                return result;
+            }
+
+            //Split around the middle key, which moves up into the parent.
+            std::size_t const middle{ internal_capacity / 2 };
+            internal_node *const right{ allocate_internal() };
+            key_t *const keys{ branch->get_keys() };
+
+            std::size_t const right_count{ internal_capacity - middle - 1 };
+            internal::relocate_items(keys + middle + 1, right->get_keys(), right_count);
+            std::copy(branch->children + middle + 1, branch->children + internal_capacity + 1, right->children);
+            right->count    = static_cast<std::uint16_t>(right_count);
+            branch->count = static_cast<std::uint16_t>(middle);
+
+            std::optional<key_t> middle_key{ std::move(keys[middle]) };
+            keys[middle].~key_t();
+
+            if(child_index <= middle) {
+                insert_child(branch, child_index, std::move(*result.split_key), result.split_node);
+            } else {
+                insert_child(right, child_index - middle - 1, std::move(*result.split_key), result.split_node);
+            }
+
+            result.split_key  = std::move(middle_key);
+            result.split_node = right;
+            return result;
+        }
+
+        auto *leaf{ static_cast<leaf_node *>(current) };
+        std::size_t index{ find_item_index(leaf, key) };
+        if(index < leaf->count && !compare(key, get_key(leaf->get_items()[index]))) {
+            return insert_result{ .leaf = leaf, .index = index, .inserted = false };
+        }
+
+        insert_result result{};
+
+        if(leaf->count == leaf_capacity) {
+            //Split so that the halves are balanced once the new item is in.
+            std::size_t const left_count{ (leaf_capacity + 1) / 2 };
+            std::size_t const split{ index < left_count ? left_count - 1 : left_count };
+
+            leaf_node *const right{ allocate_leaf() };
+            internal::relocate_items(leaf->get_items() + split, right->get_items(), leaf_capacity - split);
+            right->count = static_cast<std::uint16_t>(leaf_capacity - split);
+            leaf->count  = static_cast<std::uint16_t>(split);
+
+            right->previous = leaf;
+            right->next     = leaf->next;
+            if(leaf->next != nullptr) {
+                leaf->next->previous = right;
+            } else {
+                last_leaf = right;
+            }
+            leaf->next = right;
+
+            result.split_node = right;
+
+            if(index >= split) {
+                leaf = right;
+                index -= split;
+            }
+        }
+
+        value_type *const items{ leaf->get_items() };
+        internal::relocate_items(items + index, items + index + 1, leaf->count - index);
+        new(items + index) value_type{ std::forward<args_t>(args)... };
+        ++leaf->count;
+
+        if(result.split_node != nullptr) {
+            result.split_key.emplace(get_key(static_cast<leaf_node *>(result.split_node)->get_items()[0]));
+        }
+
+        result.leaf     = leaf;
+        result.index    = index;
+        result.inserted = true;
+        return result;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    template<typename... args_t>
+    std::pair<typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator, bool> b_tree<key_t, mapped_t, compare_t, allocator_t>::insert_root(key_t const &key, args_t &&...args) {
+        if(root == nullptr) {
+            leaf_node *const leaf{ allocate_leaf() };
+            root       = leaf;
+            first_leaf = leaf;
+            last_leaf  = leaf;
+        }
+
+        insert_result result{ insert_unique(root, key, std::forward<args_t>(args)...) };
+        if(result.split_node != nullptr) {
+            internal_node *const new_root{ allocate_internal() };
+            new(new_root->get_keys()) key_t{ std::move(*result.split_key) };
+            new_root->children[0] = root;
+            new_root->children[1] = result.split_node;
+            new_root->count       = 1;
+
+            root = new_root;
+        }
+
+        if(result.inserted) {
+            ++elems;
+        }
+
+        return { iterator{ result.leaf, result.index }, result.inserted };
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::insert_child(internal_node *branch, std::size_t const index, key_t &&key, node *child) {
+        EMBER_CHECK(branch->count < internal_capacity);
+
+        key_t *const keys{ branch->get_keys() };
+        internal::relocate_items(keys + index, keys + index + 1, branch->count - index);
+        new(keys + index) key_t{ std::move(key) };
+
+        std::copy_backward(branch->children + index + 1, branch->children + branch->count + 1, branch->children + branch->count + 2);
+        branch->children[index + 1] = child;
+
+        ++branch->count;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    bool b_tree<key_t, mapped_t, compare_t, allocator_t>::erase_from(node *current, key_t const &key) {
+        if(current->is_leaf) {
+            auto *const leaf{ static_cast<leaf_node *>(current) };
+            value_type *const items{ leaf->get_items() };
+
+            std::size_t const index{ find_item_index(leaf, key) };
+            if(index == leaf->count || compare(key, get_key(items[index]))) {
+                return false;
+            }
+
+            items[index].~value_type();
+            internal::relocate_items(items + index + 1, items + index, leaf->count - index - 1);
+            --leaf->count;
+
+            return true;
+        }
+
+        auto *const branch{ static_cast<internal_node *>(current) };
+        std::size_t const child_index{ find_child_index(branch, key) };
+        node *const child{ branch->children[child_index] };
+
+        if(!erase_from(child, key)) {
+            return false;
+        }
+
+        if(child->count < (child->is_leaf ? min_leaf_count : min_internal_count)) {
+            rebalance_child(branch, child_index);
+        }
+
+        return true;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::rebalance_child(internal_node *branch, std::size_t const index) {
+        node *const child{ branch->children[index] };
+        node *const left{ index > 0 ? branch->children[index - 1] : nullptr };
+        node *const right{ index < branch->count ? branch->children[index + 1] : nullptr };
+
+        std::size_t const min_count{ child->is_leaf ? min_leaf_count : min_internal_count };
+        key_t *const separators{ branch->get_keys() };
+
+        //Borrow an item from a sibling that can spare one, otherwise merge with it.
+        if(left != nullptr && left->count > min_count) {
+            if(child->is_leaf) {
+                value_type *const child_items{ static_cast<leaf_node *>(child)->get_items() };
+                value_type *const left_items{ static_cast<leaf_node *>(left)->get_items() };
+
+                internal::relocate_items(child_items, child_items + 1, child->count);
+                internal::relocate_items(left_items + left->count - 1, child_items, 1);
+
+                separators[index - 1].~key_t();
+                new(separators + index - 1) key_t{ get_key(child_items[0]) };
+            } else {
+                auto *const child_internal{ static_cast<internal_node *>(child) };
+                auto *const left_internal{ static_cast<internal_node *>(left) };
+                key_t *const child_keys{ child_internal->get_keys() };
+
+                internal::relocate_items(child_keys, child_keys + 1, child->count);
+                internal::relocate_items(separators + index - 1, child_keys, 1);
+                internal::relocate_items(left_internal->get_keys() + left->count - 1, separators + index - 1, 1);
+
+                std::copy_backward(child_internal->children, child_internal->children + child->count + 1, child_internal->children + child->count + 2);
+                child_internal->children[0] = left_internal->children[left->count];
+            }
+
+            --left->count;
+            ++child->count;
+        } else if(right != nullptr && right->count > min_count) {
+            if(child->is_leaf) {
+                value_type *const child_items{ static_cast<leaf_node *>(child)->get_items() };
+                value_type *const right_items{ static_cast<leaf_node *>(right)->get_items() };
+
+                internal::relocate_items(right_items, child_items + child->count, 1);
+                internal::relocate_items(right_items + 1, right_items, right->count - 1);
+
+                separators[index].~key_t();
+                new(separators + index) key_t{ get_key(right_items[0]) };
+            } else {
+                auto *const child_internal{ static_cast<internal_node *>(child) };
+                auto *const right_internal{ static_cast<internal_node *>(right) };
+                key_t *const right_keys{ right_internal->get_keys() };
+
+                internal::relocate_items(separators + index, child_internal->get_keys() + child->count, 1);
+                internal::relocate_items(right_keys, separators + index, 1);
+                internal::relocate_items(right_keys + 1, right_keys, right->count - 1);
+
+                child_internal->children[child->count + 1] = right_internal->children[0];
+                std::copy(right_internal->children + 1, right_internal->children + right->count + 1, right_internal->children);
+            }
+
+            --right->count;
+            ++child->count;
+        } else if(left != nullptr) {
+            merge_children(branch, index - 1);
+        } else {
+            merge_children(branch, index);
+        }
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::merge_children(internal_node *branch, std::size_t const index) {
+        node *const left{ branch->children[index] };
+        node *const right{ branch->children[index + 1] };
+        key_t *const separators{ branch->get_keys() };
+
+        if(left->is_leaf) {
+            auto *const left_leaf{ static_cast<leaf_node *>(left) };
+            auto *const right_leaf{ static_cast<leaf_node *>(right) };
+
+            internal::relocate_items(right_leaf->get_items(), left_leaf->get_items() + left->count, right->count);
+
+            left_leaf->next = right_leaf->next;
+            if(right_leaf->next != nullptr) {
+                right_leaf->next->previous = left_leaf;
+            } else {
+                last_leaf = left_leaf;
+            }
+
+            separators[index].~key_t();
+        } else {
+            auto *const left_internal{ static_cast<internal_node *>(left) };
+            auto *const right_internal{ static_cast<internal_node *>(right) };
+            key_t *const left_keys{ left_internal->get_keys() };
+
+            //The separator comes down between the two nodes' keys.
+            internal::relocate_items(separators + index, left_keys + left->count, 1);
+            internal::relocate_items(right_internal->get_keys(), left_keys + left->count + 1, right->count);
+            std::copy(right_internal->children, right_internal->children + right->count + 1, left_internal->children + left->count + 1);
+
+            ++left->count;
+        }
+
+        left->count = static_cast<std::uint16_t>(left->count + right->count);
+        right->count = 0;
+        free_node(right);
+
+        internal::relocate_items(separators + index + 1, separators + index, branch->count - index - 1);
+        std::copy(branch->children + index + 2, branch->children + branch->count + 1, branch->children + index + 1);
+        --branch->count;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::leaf_node *b_tree<key_t, mapped_t, compare_t, allocator_t>::allocate_leaf() {
+        std::byte *const memory{ allocator.alloc(sizeof(leaf_node), alignof(leaf_node)) };
+        EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate b_tree node." });
+
+        return new(memory) leaf_node{};
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::internal_node *b_tree<key_t, mapped_t, compare_t, allocator_t>::allocate_internal() {
+        std::byte *const memory{ allocator.alloc(sizeof(internal_node), alignof(internal_node)) };
+        EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate b_tree node." });
+
+        internal_node *const branch{ new(memory) internal_node{} };
+        branch->is_leaf = false;
+        return branch;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::free_node(node *to_free) {
+        std::byte *memory{ reinterpret_cast<std::byte *>(to_free) };
+
+        if(to_free->is_leaf) {
+            auto *const leaf{ static_cast<leaf_node *>(to_free) };
+            std::destroy_n(leaf->get_items(), leaf->count);
+            leaf->~leaf_node();
+        } else {
+            auto *const branch{ static_cast<internal_node *>(to_free) };
+            std::destroy_n(branch->get_keys(), branch->count);
+            branch->~internal_node();
+        }
+
+        allocator.free(memory);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    void b_tree<key_t, mapped_t, compare_t, allocator_t>::free_subtree(node *subtree) {
+        if(!subtree->is_leaf) {
+            auto *const branch{ static_cast<internal_node *>(subtree) };
+            for(std::size_t i{ 0 }; i <= branch->count; ++i) {
+                free_subtree(branch->children[i]);
+            }
+        }
+
+        free_node(subtree);
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::node *b_tree<key_t, mapped_t, compare_t, allocator_t>::copy_subtree(node *subtree, leaf_node *&previous_leaf) {
+        if(subtree->is_leaf) {
+            auto *const source{ static_cast<leaf_node *>(subtree) };
+            leaf_node *const leaf{ allocate_leaf() };
+
+            internal::copy_construct_items(source->get_items(), source->get_items() + source->count, leaf->get_items());
+            leaf->count = source->count;
+
+            leaf->previous = previous_leaf;
+            if(previous_leaf != nullptr) {
+                previous_leaf->next = leaf;
+            } else {
+                first_leaf = leaf;
+            }
+            previous_leaf = leaf;
+
+            return leaf;
+        }
+
+        auto *const source{ static_cast<internal_node *>(subtree) };
+        internal_node *const branch{ allocate_internal() };
+
+        internal::copy_construct_items(source->get_keys(), source->get_keys() + source->count, branch->get_keys());
+        branch->count = source->count;
+        for(std::size_t i{ 0 }; i <= source->count; ++i) {
+            branch->children[i] = copy_subtree(source->children[i], previous_leaf);
+        }
+
+        return branch;
+    }
+
+    template<typename key_t, typename mapped_t, typename compare_t, allocator allocator_t>
+    typename b_tree<key_t, mapped_t, compare_t, allocator_t>::iterator b_tree<key_t, mapped_t, compare_t, allocator_t>::make_iterator(leaf_node *leaf, std::size_t const index) const {
+        //Only end() can point past the last item in a leaf.
+        if(index == leaf->count && leaf->next != nullptr) {
+            return iterator{ leaf->next, 0 };
+        }
+        return iterator{ leaf, index };
+    }
+}
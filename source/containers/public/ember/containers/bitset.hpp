@@ -0,0 +1,428 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ember/memory/allocator.hpp>
+#include <type_traits>
+
+#if defined(__AVX2__)
+    #define EMBER_INTERNAL_BITSET_USE_AVX2 1
+    #include <immintrin.h>
+#else
+    #define EMBER_INTERNAL_BITSET_USE_AVX2 0
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EMBER_INTERNAL_BITSET_USE_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define EMBER_INTERNAL_BITSET_USE_SSE2 0
+#endif
+
+namespace ember::inline containers::internal {
+    using bitset_word = std::uint64_t;
+
+    inline std::size_t constexpr bitset_word_bits{ 64 };
+    inline std::size_t constexpr bitset_npos{ static_cast<std::size_t>(-1) };
+
+    inline constexpr std::size_t get_bitset_word_count(std::size_t const bit_count) noexcept;
+
+    /**
+     * @brief Word operations used by both bitsets. Each has a scalar, SSE2 and AVX2 overload so the loops in
+     * bitset_apply and bitset_any_of can process as many words at once as the target allows.
+     */
+    struct bitset_and_op;
+    struct bitset_or_op;
+    struct bitset_xor_op;
+    struct bitset_and_not_op;
+
+    /**
+     * @brief Sets dst[i] to op_t(dst[i], src[i]) for each of the word_count words.
+     */
+    template<typename op_t>
+    void bitset_apply(bitset_word *const dst, bitset_word const *const src, std::size_t const word_count) noexcept;
+    /**
+     * @brief Returns true if op_t(lhs[i], rhs[i]) has any bits set for any of the word_count words.
+     */
+    template<typename op_t>
+    bool bitset_any_of(bitset_word const *const lhs, bitset_word const *const rhs, std::size_t const word_count) noexcept;
+
+    inline bool bitset_any(bitset_word const *const words, std::size_t const word_count) noexcept;
+    inline std::size_t bitset_count(bitset_word const *const words, std::size_t const word_count) noexcept;
+    /**
+     * @brief Returns the index of the first bit at or after first_bit that equals value, or bitset_npos.
+     */
+    template<bool value>
+    std::size_t bitset_find(bitset_word const *const words, std::size_t const bit_count, std::size_t const first_bit) noexcept;
+    template<typename function_t>
+    void bitset_for_each_set(bitset_word const *const words, std::size_t const word_count, function_t &function);
+}
+
+namespace ember::inline containers {
+    /**
+     * @brief Fixed size set of bits stored inline.
+     * @details Unlike std::bitset, whole set operations (and, or, and not, counting and searching) work on
+     * multiple words at once with SSE2 or AVX2 when they are available, and set bits can be found and iterated
+     * without testing every index.
+     * @tparam bit_count
+     */
+    template<std::size_t bit_count>
+    class static_bitset {
+        //TYPES
+    public:
+        static std::size_t constexpr npos{ internal::bitset_npos };
+
+    private:
+        static std::size_t constexpr word_count{ internal::get_bitset_word_count(bit_count) };
+
+        //VARIABLES
+    private:
+        std::array<internal::bitset_word, word_count> words{}; /**< Bits past bit_count in the last word are always 0. */
+
+        //FUNCTIONS
+    public:
+        static_bitset() = default;
+
+        static_bitset(static_bitset const &other)     = default;
+        static_bitset(static_bitset &&other) noexcept = default;
+
+        static_bitset &operator=(static_bitset const &other)     = default;
+        static_bitset &operator=(static_bitset &&other) noexcept = default;
+
+        ~static_bitset() = default;
+
+        /**
+         * @brief Sets the bit at index to value.
+         * @param index
+         * @param value
+         */
+        void set(std::size_t const index, bool const value = true) noexcept;
+        /**
+         * @brief Sets every bit.
+         */
+        void set() noexcept;
+        /**
+         * @brief Clears the bit at index.
+         * @param index
+         */
+        void reset(std::size_t const index) noexcept;
+        /**
+         * @brief Clears every bit.
+         */
+        void reset() noexcept;
+        /**
+         * @brief Toggles the bit at index.
+         * @param index
+         */
+        void flip(std::size_t const index) noexcept;
+        /**
+         * @brief Toggles every bit.
+         */
+        void flip() noexcept;
+
+        /**
+         * @brief Returns the value of the bit at index.
+         * @param index
+         * @return
+         */
+        bool test(std::size_t const index) const noexcept;
+
+        /**
+         * @brief Returns how many bits are set.
+         * @return
+         */
+        std::size_t count() const noexcept;
+
+        bool any() const noexcept;
+        bool none() const noexcept;
+        bool all() const noexcept;
+
+        /**
+         * @brief Returns the index of the first set bit at or after from, or npos if there isn't one.
+         * @param from
+         * @return
+         */
+        std::size_t find_first_set(std::size_t const from = 0) const noexcept;
+        /**
+         * @brief Returns the index of the first unset bit at or after from, or npos if there isn't one.
+         * @param from
+         * @return
+         */
+        std::size_t find_first_unset(std::size_t const from = 0) const noexcept;
+
+        /**
+         * @brief Invokes function with the index of every set bit, in order.
+         * @param function
+         */
+        template<typename function_t>
+        void for_each_set(function_t &&function) const;
+
+        /**
+         * @brief Returns true if any bit is set in both this and other.
+         * @param other
+         * @return
+         */
+        bool intersects(static_bitset const &other) const noexcept;
+        /**
+         * @brief Returns true if every bit set in this is also set in other.
+         * @param other
+         * @return
+         */
+        bool is_subset_of(static_bitset const &other) const noexcept;
+
+        /**
+         * @brief Clears every bit that is set in other.
+         * @param other
+         * @return
+         */
+        static_bitset &and_not(static_bitset const &other) noexcept;
+
+        /**
+         * @brief Returns the number of bits.
+         * @return
+         */
+        static constexpr std::size_t size() noexcept;
+
+        /**
+         * @brief Returns the words holding the bits. Bit i is stored in word i / 64 at position i % 64.
+         * @return
+         */
+        internal::bitset_word const *data() const noexcept;
+
+        bool operator[](std::size_t const index) const noexcept;
+
+        static_bitset &operator&=(static_bitset const &other) noexcept;
+        static_bitset &operator|=(static_bitset const &other) noexcept;
+        static_bitset &operator^=(static_bitset const &other) noexcept;
+
+        template<std::size_t bit_count_1>
+        friend static_bitset<bit_count_1> operator&(static_bitset<bit_count_1> lhs, static_bitset<bit_count_1> const &rhs) noexcept;
+        template<std::size_t bit_count_1>
+        friend static_bitset<bit_count_1> operator|(static_bitset<bit_count_1> lhs, static_bitset<bit_count_1> const &rhs) noexcept;
+        template<std::size_t bit_count_1>
+        friend static_bitset<bit_count_1> operator^(static_bitset<bit_count_1> lhs, static_bitset<bit_count_1> const &rhs) noexcept;
+
+        template<std::size_t bit_count_1>
+        friend bool operator==(static_bitset<bit_count_1> const &lhs, static_bitset<bit_count_1> const &rhs) noexcept;
+        template<std::size_t bit_count_1>
+        friend bool operator!=(static_bitset<bit_count_1> const &lhs, static_bitset<bit_count_1> const &rhs) noexcept;
+
+    private:
+        /**
+         * @brief Clears the bits past bit_count in the last word after an operation that could have set them.
+         */
+        void clear_unused_bits() noexcept;
+    };
+
+    /**
+     * @brief Resizable set of bits.
+     * @details Shares static_bitset's vectorised operations. Bitsets of different sizes can be combined and
+     * compared, with the bits past the end of the shorter one treated as unset, so they can be used as sets of
+     * ids that grow over time.
+     * @tparam allocator_t Allocator used for the bitset's memory.
+     */
+    template<allocator allocator_t = global_allocator_ref>
+    class dynamic_bitset {
+        //TYPES
+    public:
+        using allocator_type = allocator_t;
+
+        static std::size_t constexpr npos{ internal::bitset_npos };
+
+        //VARIABLES
+    private:
+        internal::bitset_word *words{ nullptr }; /**< Bits past bits in the last used word are always 0. */
+        std::size_t bits{ 0 };                   /**< How many bits this bitset holds. */
+        std::size_t word_capacity{ 0 };          /**< How many words have been allocated. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the bitset's memory comes from. */
+
+        //FUNCTIONS
+    public:
+        dynamic_bitset() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit dynamic_bitset(allocator_t allocator) noexcept;
+        /**
+         * @brief Creates a bitset holding bit_count bits that are all set to value.
+         * @param bit_count
+         * @param value
+         */
+        explicit dynamic_bitset(std::size_t const bit_count, bool const value = false) requires std::is_default_constructible_v<allocator_t>;
+
+        dynamic_bitset(dynamic_bitset const &other);
+        dynamic_bitset(dynamic_bitset &&other) noexcept;
+
+        dynamic_bitset &operator=(dynamic_bitset const &other);
+        dynamic_bitset &operator=(dynamic_bitset &&other) noexcept;
+
+        ~dynamic_bitset();
+
+        /**
+         * @brief Sets the bit at index to value.
+         * @param index
+         * @param value
+         */
+        void set(std::size_t const index, bool const value = true) noexcept;
+        /**
+         * @brief Sets every bit.
+         */
+        void set() noexcept;
+        /**
+         * @brief Clears the bit at index.
+         * @param index
+         */
+        void reset(std::size_t const index) noexcept;
+        /**
+         * @brief Clears every bit. The size stays the same.
+         */
+        void reset() noexcept;
+        /**
+         * @brief Toggles the bit at index.
+         * @param index
+         */
+        void flip(std::size_t const index) noexcept;
+        /**
+         * @brief Toggles every bit.
+         */
+        void flip() noexcept;
+
+        /**
+         * @brief Returns the value of the bit at index.
+         * @param index
+         * @return
+         */
+        bool test(std::size_t const index) const noexcept;
+
+        /**
+         * @brief Returns how many bits are set.
+         * @return
+         */
+        std::size_t count() const noexcept;
+
+        bool any() const noexcept;
+        bool none() const noexcept;
+        bool all() const noexcept;
+
+        /**
+         * @brief Returns the index of the first set bit at or after from, or npos if there isn't one.
+         * @param from
+         * @return
+         */
+        std::size_t find_first_set(std::size_t const from = 0) const noexcept;
+        /**
+         * @brief Returns the index of the first unset bit at or after from, or npos if there isn't one.
+         * @param from
+         * @return
+         */
+        std::size_t find_first_unset(std::size_t const from = 0) const noexcept;
+
+        /**
+         * @brief Invokes function with the index of every set bit, in order.
+         * @param function
+         */
+        template<typename function_t>
+        void for_each_set(function_t &&function) const;
+
+        /**
+         * @brief Returns true if any bit is set in both this and other.
+         * @param other
+         * @return
+         */
+        template<typename other_allocator_t>
+        bool intersects(dynamic_bitset<other_allocator_t> const &other) const noexcept;
+        /**
+         * @brief Returns true if every bit set in this is also set in other.
+         * @param other
+         * @return
+         */
+        template<typename other_allocator_t>
+        bool is_subset_of(dynamic_bitset<other_allocator_t> const &other) const noexcept;
+
+        /**
+         * @brief Clears every bit that is set in other.
+         * @param other
+         * @return
+         */
+        template<typename other_allocator_t>
+        dynamic_bitset &and_not(dynamic_bitset<other_allocator_t> const &other) noexcept;
+
+        /**
+         * @brief Changes the number of bits. Any new bits are set to value.
+         * @param bit_count
+         * @param value
+         */
+        void resize(std::size_t const bit_count, bool const value = false);
+        /**
+         * @brief Makes sure bit_count bits can be held without allocating.
+         * @param bit_count
+         */
+        void reserve(std::size_t const bit_count);
+        /**
+         * @brief Removes every bit. The capacity stays the same.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Returns the number of bits.
+         * @return
+         */
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns how many bits can be held without allocating.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns true if this bitset holds no bits.
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the words holding the bits. Bit i is stored in word i / 64 at position i % 64.
+         * @return
+         */
+        internal::bitset_word const *data() const noexcept;
+
+        /**
+         * @brief Returns the allocator this bitset allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+        bool operator[](std::size_t const index) const noexcept;
+
+        /**
+         * @brief Clears every bit that isn't set in other.
+         */
+        template<typename other_allocator_t>
+        dynamic_bitset &operator&=(dynamic_bitset<other_allocator_t> const &other) noexcept;
+        /**
+         * @brief Sets every bit that is set in other, growing if other is larger.
+         */
+        template<typename other_allocator_t>
+        dynamic_bitset &operator|=(dynamic_bitset<other_allocator_t> const &other);
+        /**
+         * @brief Toggles every bit that is set in other, growing if other is larger.
+         */
+        template<typename other_allocator_t>
+        dynamic_bitset &operator^=(dynamic_bitset<other_allocator_t> const &other);
+
+        /**
+         * @brief Returns true if both bitsets have the same bits set. Sizes can differ.
+         */
+        template<typename allocator_t_1, typename allocator_t_2>
+        friend bool operator==(dynamic_bitset<allocator_t_1> const &lhs, dynamic_bitset<allocator_t_2> const &rhs) noexcept;
+        template<typename allocator_t_1, typename allocator_t_2>
+        friend bool operator!=(dynamic_bitset<allocator_t_1> const &lhs, dynamic_bitset<allocator_t_2> const &rhs) noexcept;
+
+    private:
+        std::size_t get_word_count() const noexcept;
+        void clear_unused_bits() noexcept;
+        void reallocate(std::size_t const new_word_capacity);
+    };
+}
+
+#include "bitset.inl"
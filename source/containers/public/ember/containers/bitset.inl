@@ -0,0 +1,750 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <utility>
+
+namespace ember::inline containers {
+    namespace internal {
+        constexpr std::size_t get_bitset_word_count(std::size_t const bit_count) noexcept {
+            return (bit_count + bitset_word_bits - 1) / bitset_word_bits;
+        }
+
+        struct bitset_and_op {
+            static bitset_word apply(bitset_word const lhs, bitset_word const rhs) noexcept {
+                return lhs & rhs;
+            }
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            static __m128i apply(__m128i const lhs, __m128i const rhs) noexcept {
+                return _mm_and_si128(lhs, rhs);
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            static __m256i apply(__m256i const lhs, __m256i const rhs) noexcept {
+                return _mm256_and_si256(lhs, rhs);
+            }
+#endif
+        };
+
+        struct bitset_or_op {
+            static bitset_word apply(bitset_word const lhs, bitset_word const rhs) noexcept {
+                return lhs | rhs;
+            }
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            static __m128i apply(__m128i const lhs, __m128i const rhs) noexcept {
+                return _mm_or_si128(lhs, rhs);
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            static __m256i apply(__m256i const lhs, __m256i const rhs) noexcept {
+                return _mm256_or_si256(lhs, rhs);
+            }
+#endif
+        };
+
+        struct bitset_xor_op {
+            static bitset_word apply(bitset_word const lhs, bitset_word const rhs) noexcept {
+                return lhs ^ rhs;
+            }
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            static __m128i apply(__m128i const lhs, __m128i const rhs) noexcept {
+                return _mm_xor_si128(lhs, rhs);
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            static __m256i apply(__m256i const lhs, __m256i const rhs) noexcept {
+                return _mm256_xor_si256(lhs, rhs);
+            }
+#endif
+        };
+
+        struct bitset_and_not_op {
+            static bitset_word apply(bitset_word const lhs, bitset_word const rhs) noexcept {
+                return lhs & ~rhs;
+            }
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            static __m128i apply(__m128i const lhs, __m128i const rhs) noexcept {
+                return _mm_andnot_si128(rhs, lhs);
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            static __m256i apply(__m256i const lhs, __m256i const rhs) noexcept {
+                return _mm256_andnot_si256(rhs, lhs);
+            }
+#endif
+        };
+
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+        inline bool bitset_is_zero(__m128i const value) noexcept {
+            return _mm_movemask_epi8(_mm_cmpeq_epi8(value, _mm_setzero_si128())) == 0xffff;
+        }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+        inline bool bitset_is_zero(__m256i const value) noexcept {
+            return _mm256_testz_si256(value, value) != 0;
+        }
+#endif
+
+        template<typename op_t>
+        void bitset_apply(bitset_word *const dst, bitset_word const *const src, std::size_t const word_count) noexcept {
+            std::size_t i{ 0 };
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            for(; i + 4 <= word_count; i += 4) {
+                __m256i const lhs{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(dst + i)) };
+                __m256i const rhs{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i)) };
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), op_t::apply(lhs, rhs));
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            for(; i + 2 <= word_count; i += 2) {
+                __m128i const lhs{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(dst + i)) };
+                __m128i const rhs{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i)) };
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), op_t::apply(lhs, rhs));
+            }
+#endif
+            for(; i < word_count; ++i) {
+                dst[i] = op_t::apply(dst[i], src[i]);
+            }
+        }
+
+        template<typename op_t>
+        bool bitset_any_of(bitset_word const *const lhs, bitset_word const *const rhs, std::size_t const word_count) noexcept {
+            std::size_t i{ 0 };
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            for(; i + 4 <= word_count; i += 4) {
+                __m256i const lhs_words{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(lhs + i)) };
+                __m256i const rhs_words{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(rhs + i)) };
+                if(!bitset_is_zero(op_t::apply(lhs_words, rhs_words))) {
+                    return true;
+                }
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            for(; i + 2 <= word_count; i += 2) {
+                __m128i const lhs_words{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(lhs + i)) };
+                __m128i const rhs_words{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(rhs + i)) };
+                if(!bitset_is_zero(op_t::apply(lhs_words, rhs_words))) {
+                    return true;
+                }
+            }
+#endif
+            for(; i < word_count; ++i) {
+                if(op_t::apply(lhs[i], rhs[i]) != 0) {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        bool bitset_any(bitset_word const *const words, std::size_t const word_count) noexcept {
+            return bitset_any_of<bitset_or_op>(words, words, word_count);
+        }
+
+        std::size_t bitset_count(bitset_word const *const words, std::size_t const word_count) noexcept {
+            std::size_t count{ 0 };
+            std::size_t i{ 0 };
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            //Counts each nibble with a shuffle lookup then sums the bytes of each word with sad (Mula's method).
+            __m256i const lookup{ _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4) };
+            __m256i const low_mask{ _mm256_set1_epi8(0x0f) };
+            __m256i totals{ _mm256_setzero_si256() };
+
+            for(; i + 4 <= word_count; i += 4) {
+                __m256i const value{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(words + i)) };
+                __m256i const low{ _mm256_and_si256(value, low_mask) };
+                __m256i const high{ _mm256_and_si256(_mm256_srli_epi16(value, 4), low_mask) };
+                __m256i const byte_counts{ _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high)) };
+                totals = _mm256_add_epi64(totals, _mm256_sad_epu8(byte_counts, _mm256_setzero_si256()));
+            }
+
+            count += static_cast<std::size_t>(_mm256_extract_epi64(totals, 0) + _mm256_extract_epi64(totals, 1) + _mm256_extract_epi64(totals, 2) + _mm256_extract_epi64(totals, 3));
+#endif
+            for(; i < word_count; ++i) {
+                count += static_cast<std::size_t>(std::popcount(words[i]));
+            }
+
+            return count;
+        }
+
+        template<bool value>
+        std::size_t bitset_find(bitset_word const *const words, std::size_t const bit_count, std::size_t const first_bit) noexcept {
+            if(first_bit >= bit_count) {
+                return bitset_npos;
+            }
+
+            //Searching for unset bits is the same as searching for set bits in the inverted words.
+            auto const get_word{ [&](std::size_t const index) {
+                return value ? words[index] : ~words[index];
+            } };
+            auto const to_bit{ [&](std::size_t const bit) {
+                return bit < bit_count ? bit : bitset_npos;
+            } };
+
+            std::size_t const word_count{ get_bitset_word_count(bit_count) };
+            std::size_t word_index{ first_bit / bitset_word_bits };
+
+            bitset_word const first_word{ get_word(word_index) & (~bitset_word{ 0 } << (first_bit % bitset_word_bits)) };
+            if(first_word != 0) {
+                return to_bit(word_index * bitset_word_bits + static_cast<std::size_t>(std::countr_zero(first_word)));
+            }
+            ++word_index;
+
+            //Skip over whole vectors of words that can't contain a match.
+#if EMBER_INTERNAL_BITSET_USE_AVX2
+            __m256i const avx_skip_value{ value ? _mm256_setzero_si256() : _mm256_set1_epi8(-1) };
+            for(; word_index + 4 <= word_count; word_index += 4) {
+                __m256i const vector{ _mm256_loadu_si256(reinterpret_cast<__m256i const *>(words + word_index)) };
+                if(!bitset_is_zero(_mm256_xor_si256(vector, avx_skip_value))) {
+                    break;
+                }
+            }
+#endif
+#if EMBER_INTERNAL_BITSET_USE_SSE2
+            __m128i const sse_skip_value{ value ? _mm_setzero_si128() : _mm_set1_epi8(-1) };
+            for(; word_index + 2 <= word_count; word_index += 2) {
+                __m128i const vector{ _mm_loadu_si128(reinterpret_cast<__m128i const *>(words + word_index)) };
+                if(!bitset_is_zero(_mm_xor_si128(vector, sse_skip_value))) {
+                    break;
+                }
+            }
+#endif
+            for(; word_index < word_count; ++word_index) {
+                if(bitset_word const word{ get_word(word_index) }; word != 0) {
+                    return to_bit(word_index * bitset_word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+                }
+            }
+
+            return bitset_npos;
+        }
+
+        template<typename function_t>
+        void bitset_for_each_set(bitset_word const *const words, std::size_t const word_count, function_t &function) {
+            for(std::size_t word_index{ 0 }; word_index < word_count; ++word_index) {
+                for(bitset_word word{ words[word_index] }; word != 0; word &= word - 1) {
+                    function(word_index * bitset_word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+                }
+            }
+        }
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::set(std::size_t const index, bool const value) noexcept {
+        EMBER_CHECK(index < bit_count);
+
+        internal::bitset_word const mask{ internal::bitset_word{ 1 } << (index % internal::bitset_word_bits) };
+        if(value) {
+            words[index / internal::bitset_word_bits] |= mask;
+        } else {
+            words[index / internal::bitset_word_bits] &= ~mask;
+        }
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::set() noexcept {
+        words.fill(~internal::bitset_word{ 0 });
+        clear_unused_bits();
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::reset(std::size_t const index) noexcept {
+        set(index, false);
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::reset() noexcept {
+        words.fill(0);
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::flip(std::size_t const index) noexcept {
+        EMBER_CHECK(index < bit_count);
+        words[index / internal::bitset_word_bits] ^= internal::bitset_word{ 1 } << (index % internal::bitset_word_bits);
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::flip() noexcept {
+        for(internal::bitset_word &word : words) {
+            word = ~word;
+        }
+        clear_unused_bits();
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::test(std::size_t const index) const noexcept {
+        EMBER_CHECK(index < bit_count);
+        return (words[index / internal::bitset_word_bits] >> (index % internal::bitset_word_bits)) & 1;
+    }
+
+    template<std::size_t bit_count>
+    std::size_t static_bitset<bit_count>::count() const noexcept {
+        return internal::bitset_count(words.data(), word_count);
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::any() const noexcept {
+        return internal::bitset_any(words.data(), word_count);
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::none() const noexcept {
+        return !any();
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::all() const noexcept {
+        return find_first_unset() == npos;
+    }
+
+    template<std::size_t bit_count>
+    std::size_t static_bitset<bit_count>::find_first_set(std::size_t const from) const noexcept {
+        return internal::bitset_find<true>(words.data(), bit_count, from);
+    }
+
+    template<std::size_t bit_count>
+    std::size_t static_bitset<bit_count>::find_first_unset(std::size_t const from) const noexcept {
+        return internal::bitset_find<false>(words.data(), bit_count, from);
+    }
+
+    template<std::size_t bit_count>
+    template<typename function_t>
+    void static_bitset<bit_count>::for_each_set(function_t &&function) const {
+        internal::bitset_for_each_set(words.data(), word_count, function);
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::intersects(static_bitset const &other) const noexcept {
+        return internal::bitset_any_of<internal::bitset_and_op>(words.data(), other.words.data(), word_count);
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::is_subset_of(static_bitset const &other) const noexcept {
+        return !internal::bitset_any_of<internal::bitset_and_not_op>(words.data(), other.words.data(), word_count);
+    }
+
+    template<std::size_t bit_count>
+    static_bitset<bit_count> &static_bitset<bit_count>::and_not(static_bitset const &other) noexcept {
+        internal::bitset_apply<internal::bitset_and_not_op>(words.data(), other.words.data(), word_count);
+        return *this;
+    }
+
+    template<std::size_t bit_count>
+    constexpr std::size_t static_bitset<bit_count>::size() noexcept {
+        return bit_count;
+    }
+
+    template<std::size_t bit_count>
+    internal::bitset_word const *static_bitset<bit_count>::data() const noexcept {
+        return words.data();
+    }
+
+    template<std::size_t bit_count>
+    bool static_bitset<bit_count>::operator[](std::size_t const index) const noexcept {
+        return test(index);
+    }
+
+    template<std::size_t bit_count>
+    static_bitset<bit_count> &static_bitset<bit_count>::operator&=(static_bitset const &other) noexcept {
+        internal::bitset_apply<internal::bitset_and_op>(words.data(), other.words.data(), word_count);
+        return *this;
+    }
+
+    template<std::size_t bit_count>
+    static_bitset<bit_count> &static_bitset<bit_count>::operator|=(static_bitset const &other) noexcept {
+        internal::bitset_apply<internal::bitset_or_op>(words.data(), other.words.data(), word_count);
+        return *this;
+    }
+
+    template<std::size_t bit_count>
+    static_bitset<bit_count> &static_bitset<bit_count>::operator^=(static_bitset const &other) noexcept {
+        internal::bitset_apply<internal::bitset_xor_op>(words.data(), other.words.data(), word_count);
+        return *this;
+    }
+
+    template<std::size_t bit_count>
+    void static_bitset<bit_count>::clear_unused_bits() noexcept {
+        if constexpr(bit_count % internal::bitset_word_bits != 0) {
+            words[word_count - 1] &= (internal::bitset_word{ 1 } << (bit_count % internal::bitset_word_bits)) - 1;
+        }
+    }
+
+    template<std::size_t bit_count_1>
+    static_bitset<bit_count_1> operator&(static_bitset<bit_count_1> lhs, static_bitset<bit_count_1> const &rhs) noexcept {
+        return lhs &= rhs;
+    }
+
+    template<std::size_t bit_count_1>
+    static_bitset<bit_count_1> operator|(static_bitset<bit_count_1> lhs, static_bitset<bit_count_1> const &rhs) noexcept {
+        return lhs |= rhs;
+    }
+
+    template<std::size_t bit_count_1>
+    static_bitset<bit_count_1> operator^(static_bitset<bit_count_1> lhs, static_bitset<bit_count_1> const &rhs) noexcept {
+        return lhs ^= rhs;
+    }
+
+    template<std::size_t bit_count_1>
+    bool operator==(static_bitset<bit_count_1> const &lhs, static_bitset<bit_count_1> const &rhs) noexcept {
+        return !internal::bitset_any_of<internal::bitset_xor_op>(lhs.words.data(), rhs.words.data(), static_bitset<bit_count_1>::word_count);
+    }
+
+    template<std::size_t bit_count_1>
+    bool operator!=(static_bitset<bit_count_1> const &lhs, static_bitset<bit_count_1> const &rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t>::dynamic_bitset() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t>::dynamic_bitset(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t>::dynamic_bitset(std::size_t const bit_count, bool const value) requires std::is_default_constructible_v<allocator_t> {
+        resize(bit_count, value);
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t>::dynamic_bitset(dynamic_bitset const &other)
+        : allocator{ other.allocator } {
+        reallocate(other.get_word_count());
+        if(other.bits > 0) {
+            std::memcpy(words, other.words, other.get_word_count() * sizeof(internal::bitset_word));
+        }
+        bits = other.bits;
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t>::dynamic_bitset(dynamic_bitset &&other) noexcept
+        : words{ std::exchange(other.words, nullptr) }
+        , bits{ std::exchange(other.bits, 0) }
+        , word_capacity{ std::exchange(other.word_capacity, 0) }
+        , allocator{ other.allocator } {
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t> &dynamic_bitset<allocator_t>::operator=(dynamic_bitset const &other) {
+        if(this == &other) {
+            return *this;
+        }
+
+        bits = 0;
+        if(word_capacity < other.get_word_count()) {
+            reallocate(other.get_word_count());
+        }
+        if(other.bits > 0) {
+            std::memcpy(words, other.words, other.get_word_count() * sizeof(internal::bitset_word));
+        }
+        bits = other.bits;
+
+        return *this;
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t> &dynamic_bitset<allocator_t>::operator=(dynamic_bitset &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        //The memory can only be taken if it can be freed through this bitset's allocator.
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
+        }
+
+        if(can_take_memory) {
+            if(words != nullptr) {
+                auto *memory{ reinterpret_cast<std::byte *>(words) };
+                allocator.free(memory);
+            }
+
+            words         = std::exchange(other.words, nullptr);
+            bits          = std::exchange(other.bits, 0);
+            word_capacity = std::exchange(other.word_capacity, 0);
+        } else {
+            *this = std::as_const(other);
+
+            auto *other_memory{ reinterpret_cast<std::byte *>(other.words) };
+            other.allocator.free(other_memory);
+            other.words         = nullptr;
+            other.bits          = 0;
+            other.word_capacity = 0;
+        }
+
+        return *this;
+    }
+
+    template<allocator allocator_t>
+    dynamic_bitset<allocator_t>::~dynamic_bitset() {
+        if(words != nullptr) {
+            auto *memory{ reinterpret_cast<std::byte *>(words) };
+            allocator.free(memory);
+
+            words         = nullptr;
+            bits          = 0;
+            word_capacity = 0;
+        }
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::set(std::size_t const index, bool const value) noexcept {
+        EMBER_CHECK(index < bits);
+
+        internal::bitset_word const mask{ internal::bitset_word{ 1 } << (index % internal::bitset_word_bits) };
+        if(value) {
+            words[index / internal::bitset_word_bits] |= mask;
+        } else {
+            words[index / internal::bitset_word_bits] &= ~mask;
+        }
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::set() noexcept {
+        std::fill_n(words, get_word_count(), ~internal::bitset_word{ 0 });
+        clear_unused_bits();
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::reset(std::size_t const index) noexcept {
+        set(index, false);
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::reset() noexcept {
+        std::fill_n(words, get_word_count(), internal::bitset_word{ 0 });
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::flip(std::size_t const index) noexcept {
+        EMBER_CHECK(index < bits);
+        words[index / internal::bitset_word_bits] ^= internal::bitset_word{ 1 } << (index % internal::bitset_word_bits);
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::flip() noexcept {
+        for(std::size_t i{ 0 }; i < get_word_count(); ++i) {
+            words[i] = ~words[i];
+        }
+        clear_unused_bits();
+    }
+
+    template<allocator allocator_t>
+    bool dynamic_bitset<allocator_t>::test(std::size_t const index) const noexcept {
+        EMBER_CHECK(index < bits);
+        return (words[index / internal::bitset_word_bits] >> (index % internal::bitset_word_bits)) & 1;
+    }
+
+    template<allocator allocator_t>
+    std::size_t dynamic_bitset<allocator_t>::count() const noexcept {
+        return internal::bitset_count(words, get_word_count());
+    }
+
+    template<allocator allocator_t>
+    bool dynamic_bitset<allocator_t>::any() const noexcept {
+        return internal::bitset_any(words, get_word_count());
+    }
+
+    template<allocator allocator_t>
+    bool dynamic_bitset<allocator_t>::none() const noexcept {
+        return !any();
+    }
+
+    template<allocator allocator_t>
+    bool dynamic_bitset<allocator_t>::all() const noexcept {
+        return find_first_unset() == npos;
+    }
+
+    template<allocator allocator_t>
+    std::size_t dynamic_bitset<allocator_t>::find_first_set(std::size_t const from) const noexcept {
+        return internal::bitset_find<true>(words, bits, from);
+    }
+
+    template<allocator allocator_t>
+    std::size_t dynamic_bitset<allocator_t>::find_first_unset(std::size_t const from) const noexcept {
+        return internal::bitset_find<false>(words, bits, from);
+    }
+
+    template<allocator allocator_t>
+    template<typename function_t>
+    void dynamic_bitset<allocator_t>::for_each_set(function_t &&function) const {
+        internal::bitset_for_each_set(words, get_word_count(), function);
+    }
+
+    template<allocator allocator_t>
+    template<typename other_allocator_t>
+    bool dynamic_bitset<allocator_t>::intersects(dynamic_bitset<other_allocator_t> const &other) const noexcept {
+        std::size_t const common_words{ std::min(get_word_count(), internal::get_bitset_word_count(other.size())) };
+        return internal::bitset_any_of<internal::bitset_and_op>(words, other.data(), common_words);
+    }
+
+    template<allocator allocator_t>
+    template<typename other_allocator_t>
+    bool dynamic_bitset<allocator_t>::is_subset_of(dynamic_bitset<other_allocator_t> const &other) const noexcept {
+        std::size_t const word_count{ get_word_count() };
+        std::size_t const common_words{ std::min(word_count, internal::get_bitset_word_count(other.size())) };
+
+        //Any bits set past the end of other can't be in it.
+        return !internal::bitset_any_of<internal::bitset_and_not_op>(words, other.data(), common_words) && !internal::bitset_any(words + common_words, word_count - common_words);
+    }
+
+    template<allocator allocator_t>
+    template<typename other_allocator_t>
+    dynamic_bitset<allocator_t> &dynamic_bitset<allocator_t>::and_not(dynamic_bitset<other_allocator_t> const &other) noexcept {
+        std::size_t const common_words{ std::min(get_word_count(), internal::get_bitset_word_count(other.size())) };
+        internal::bitset_apply<internal::bitset_and_not_op>(words, other.data(), common_words);
+
+        return *this;
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::resize(std::size_t const bit_count, bool const value) {
+        std::size_t const old_bits{ bits };
+        std::size_t const old_word_count{ get_word_count() };
+        std::size_t const new_word_count{ internal::get_bitset_word_count(bit_count) };
+
+        if(word_capacity < new_word_count) {
+            reallocate(std::max(new_word_count, word_capacity * 2));
+        }
+
+        bits = bit_count;
+        if(bit_count > old_bits) {
+            internal::bitset_word const fill_word{ value ? ~internal::bitset_word{ 0 } : internal::bitset_word{ 0 } };
+            std::fill(words + old_word_count, words + new_word_count, fill_word);
+
+            //The rest of the old last word was unset, so only needs filling when growing with set bits.
+            if(value && old_bits % internal::bitset_word_bits != 0) {
+                words[old_word_count - 1] |= ~internal::bitset_word{ 0 } << (old_bits % internal::bitset_word_bits);
+            }
+        }
+        clear_unused_bits();
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::reserve(std::size_t const bit_count) {
+        std::size_t const word_count{ internal::get_bitset_word_count(bit_count) };
+        if(word_capacity < word_count) {
+            reallocate(word_count);
+        }
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::clear() noexcept {
+        bits = 0;
+    }
+
+    template<allocator allocator_t>
+    std::size_t dynamic_bitset<allocator_t>::size() const noexcept {
+        return bits;
+    }
+
+    template<allocator allocator_t>
+    std::size_t dynamic_bitset<allocator_t>::capacity() const noexcept {
+        return word_capacity * internal::bitset_word_bits;
+    }
+
+    template<allocator allocator_t>
+    bool dynamic_bitset<allocator_t>::empty() const noexcept {
+        return bits == 0;
+    }
+
+    template<allocator allocator_t>
+    internal::bitset_word const *dynamic_bitset<allocator_t>::data() const noexcept {
+        return words;
+    }
+
+    template<allocator allocator_t>
+    allocator_t dynamic_bitset<allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<allocator allocator_t>
+    bool dynamic_bitset<allocator_t>::operator[](std::size_t const index) const noexcept {
+        return test(index);
+    }
+
+    template<allocator allocator_t>
+    template<typename other_allocator_t>
+    dynamic_bitset<allocator_t> &dynamic_bitset<allocator_t>::operator&=(dynamic_bitset<other_allocator_t> const &other) noexcept {
+        std::size_t const word_count{ get_word_count() };
+        std::size_t const common_words{ std::min(word_count, internal::get_bitset_word_count(other.size())) };
+
+        internal::bitset_apply<internal::bitset_and_op>(words, other.data(), common_words);
+        std::fill(words + common_words, words + word_count, internal::bitset_word{ 0 });
+
+        return *this;
+    }
+
+    template<allocator allocator_t>
+    template<typename other_allocator_t>
+    dynamic_bitset<allocator_t> &dynamic_bitset<allocator_t>::operator|=(dynamic_bitset<other_allocator_t> const &other) {
+        if(bits < other.size()) {
+            resize(other.size());
+        }
+        internal::bitset_apply<internal::bitset_or_op>(words, other.data(), internal::get_bitset_word_count(other.size()));
+
+        return *this;
+    }
+
+    template<allocator allocator_t>
+    template<typename other_allocator_t>
+    dynamic_bitset<allocator_t> &dynamic_bitset<allocator_t>::operator^=(dynamic_bitset<other_allocator_t> const &other) {
+        if(bits < other.size()) {
+            resize(other.size());
+        }
+        internal::bitset_apply<internal::bitset_xor_op>(words, other.data(), internal::get_bitset_word_count(other.size()));
+
+        return *this;
+    }
+
+    template<allocator allocator_t>
+    std::size_t dynamic_bitset<allocator_t>::get_word_count() const noexcept {
+        return internal::get_bitset_word_count(bits);
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::clear_unused_bits() noexcept {
+        if(bits % internal::bitset_word_bits != 0) {
+            words[get_word_count() - 1] &= (internal::bitset_word{ 1 } << (bits % internal::bitset_word_bits)) - 1;
+        }
+    }
+
+    template<allocator allocator_t>
+    void dynamic_bitset<allocator_t>::reallocate(std::size_t const new_word_capacity) {
+        if(new_word_capacity == 0) {
+            return;
+        }
+
+        auto *const new_words{ reinterpret_cast<internal::bitset_word *>(allocator.alloc(new_word_capacity * sizeof(internal::bitset_word), alignof(internal::bitset_word))) };
+        EMBER_THROW_IF_FAILED(new_words != nullptr, exception{ "Failed to allocate dynamic_bitset memory." });
+
+        if(words != nullptr) {
+            std::memcpy(new_words, words, get_word_count() * sizeof(internal::bitset_word));
+
+            auto *memory{ reinterpret_cast<std::byte *>(words) };
+            allocator.free(memory);
+        }
+
+        words         = new_words;
+        word_capacity = new_word_capacity;
+    }
+
+    template<typename allocator_t_1, typename allocator_t_2>
+    bool operator==(dynamic_bitset<allocator_t_1> const &lhs, dynamic_bitset<allocator_t_2> const &rhs) noexcept {
+        std::size_t const lhs_words{ internal::get_bitset_word_count(lhs.size()) };
+        std::size_t const rhs_words{ internal::get_bitset_word_count(rhs.size()) };
+        std::size_t const common_words{ std::min(lhs_words, rhs_words) };
+
+        //Whichever bitset is longer can only have unset bits past the end of the other.
+        return !internal::bitset_any_of<internal::bitset_xor_op>(lhs.data(), rhs.data(), common_words) &&
+               !internal::bitset_any(lhs.data() + common_words, lhs_words - common_words) &&
+               !internal::bitset_any(rhs.data() + common_words, rhs_words - common_words);
+    }
+
+    template<typename allocator_t_1, typename allocator_t_2>
+    bool operator!=(dynamic_bitset<allocator_t_1> const &lhs, dynamic_bitset<allocator_t_2> const &rhs) noexcept {
+        return !(lhs == rhs);
+    }
+}
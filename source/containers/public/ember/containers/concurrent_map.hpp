@@ -0,0 +1,237 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/map.hpp>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/memory.hpp>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ember::inline containers::internal {
+    /**
+     * @brief Reader writer lock that spins on a single atomic instead of sleeping in the kernel.
+     * @details Waiting threads pause briefly and then yield, which suits the short critical sections of a hash map
+     * far better than a std::shared_mutex that wakes every waiter on unlock. A writer claims the lock before
+     * waiting for readers to leave, which stops new readers from starving it.
+     */
+    class shared_spin_lock {
+        //VARIABLES
+    private:
+        static std::uint32_t constexpr writer_bit{ 1u << 31 };
+
+        std::atomic<std::uint32_t> state{ 0 }; /**< writer_bit is set while a writer holds or is waiting for the lock. The rest counts readers. */
+
+        //FUNCTIONS
+    public:
+        shared_spin_lock() = default;
+
+        shared_spin_lock(shared_spin_lock const &other) = delete;
+        shared_spin_lock(shared_spin_lock &&other)      = delete;
+
+        shared_spin_lock &operator=(shared_spin_lock const &other) = delete;
+        shared_spin_lock &operator=(shared_spin_lock &&other)      = delete;
+
+        ~shared_spin_lock() = default;
+
+        inline void lock() noexcept;
+        inline bool try_lock() noexcept;
+        inline void unlock() noexcept;
+
+        inline void lock_shared() noexcept;
+        inline bool try_lock_shared() noexcept;
+        inline void unlock_shared() noexcept;
+
+    private:
+        /**
+         * @brief Pauses for the first few attempts and then gives up the rest of the thread's time slice.
+         */
+        static inline void back_off(std::uint32_t &attempt) noexcept;
+    };
+}
+
+namespace ember::inline containers {
+    /**
+     * @brief Unordered associative container that can be read from and written to by many threads at once.
+     * @details Items are spread across shard_count shards by the top bits of their key's hash. Each shard is a map
+     * guarded by it's own reader writer spin lock and sits on it's own cache line, so threads only contend when they
+     * touch the same shard and lookups never block each other. Items are never handed out by reference as a shard
+     * can grow on another thread. Instead they are copied out or visited while the shard is locked.
+     * @tparam key_t
+     * @tparam value_t
+     * @tparam hash_t
+     * @tparam key_equal_t
+     * @tparam allocator_t Allocator used for every shard's memory.
+     */
+    template<typename key_t, typename value_t, typename hash_t = std::hash<key_t>, typename key_equal_t = std::equal_to<key_t>, allocator allocator_t = global_allocator_ref>
+    class concurrent_map {
+        //TYPES
+    public:
+        using key_type       = key_t;
+        using mapped_type    = value_t;
+        using hasher         = hash_t;
+        using key_equal      = key_equal_t;
+        using allocator_type = allocator_t;
+
+        static std::size_t constexpr shard_count{ 64 };
+
+    private:
+        using map_type = map<key_t, value_t, hash_t, key_equal_t, allocator_t>;
+
+        struct alignas(cache_line_size) shard {
+            mutable internal::shared_spin_lock mutex{};
+            map_type items;
+
+            explicit shard(allocator_t allocator);
+        };
+
+        //VARIABLES
+    private:
+        std::array<shard, shard_count> shards;
+
+        [[no_unique_address]] hash_t hash{};
+
+        //FUNCTIONS
+    public:
+        concurrent_map() requires std::is_default_constructible_v<allocator_t>;
+        explicit concurrent_map(allocator_t allocator);
+
+        concurrent_map(concurrent_map const &other) = delete;
+        /**
+         * @brief Moves every item out of other. Neither map can be in use by another thread.
+         */
+        concurrent_map(concurrent_map &&other) noexcept;
+
+        concurrent_map &operator=(concurrent_map const &other) = delete;
+        /**
+         * @brief Moves every item out of other. Neither map can be in use by another thread.
+         */
+        concurrent_map &operator=(concurrent_map &&other) noexcept;
+
+        ~concurrent_map() = default;
+
+        /**
+         * @brief Constructs a value from args if key is not already in the map.
+         * @return Returns true if the item was inserted.
+         */
+        template<typename... args_t>
+        bool try_emplace(key_t const &key, args_t &&...args);
+        /**
+         * @overload try_emplace(key_t const &key, args_t &&...args)
+         */
+        template<typename... args_t>
+        bool try_emplace(key_t &&key, args_t &&...args);
+
+        /**
+         * @brief Inserts value under key, replacing the existing value if there is one.
+         * @return Returns true if the item was inserted and false if it was assigned.
+         */
+        template<typename value_arg_t>
+        bool insert_or_assign(key_t const &key, value_arg_t &&value);
+
+        /**
+         * @brief Returns a copy of the value with key. If key doesn't exist factory is invoked to create it.
+         * @details Lookups only take a shared lock. factory runs under the shard's exclusive lock so it's called at
+         * most once per key, even when many threads ask for the same key. factory must not use this map.
+         * @param key
+         * @param factory Returns the value to insert.
+         * @return
+         */
+        template<typename factory_t>
+        value_t find_or_insert(key_t const &key, factory_t &&factory) requires std::copy_constructible<value_t>;
+        /**
+         * @brief Same as find_or_insert(key_t const &key, factory_t &&factory) but invokes function with the value
+         * while the shard is locked instead of copying it.
+         * @return Returns what function returns. Don't return references into the map.
+         */
+        template<typename factory_t, typename function_t>
+        decltype(auto) find_or_insert(key_t const &key, factory_t &&factory, function_t &&function);
+
+        /**
+         * @brief Returns a copy of the value with key or an empty optional if it doesn't exist.
+         * @param key
+         * @return
+         */
+        std::optional<value_t> find(key_t const &key) const requires std::copy_constructible<value_t>;
+        /**
+         * @brief Returns a copy of the value with key. Throws if key doesn't exist.
+         * @param key
+         * @return
+         */
+        value_t at(key_t const &key) const requires std::copy_constructible<value_t>;
+
+        /**
+         * @brief Invokes function with a const reference to the value with key while holding a shared lock.
+         * @return Returns false if key doesn't exist.
+         */
+        template<typename function_t>
+        bool visit(key_t const &key, function_t &&function) const;
+        /**
+         * @brief Invokes function with a reference to the value with key while holding an exclusive lock.
+         * @return Returns false if key doesn't exist.
+         */
+        template<typename function_t>
+        bool update(key_t const &key, function_t &&function);
+        /**
+         * @brief Invokes function with each key and value, one shard at a time. Items added or removed by other
+         * threads during the call may or may not be visited.
+         * @param function
+         */
+        template<typename function_t>
+        void for_each(function_t &&function) const;
+
+        bool contains(key_t const &key) const;
+
+        /**
+         * @brief Erases the item with key if it exists.
+         * @param key
+         * @return How many items were erased.
+         */
+        std::size_t erase(key_t const &key);
+
+        /**
+         * @brief Destructs every item in the map.
+         */
+        void clear();
+
+        /**
+         * @brief Returns the number of items. Can be out of date as soon as it returns.
+         * @return
+         */
+        std::size_t size() const;
+
+        /**
+         * @brief Returns true if this map appeared to contain no items. Same caveats as size().
+         * @return
+         */
+        [[nodiscard]] bool empty() const;
+
+        /**
+         * @brief Returns the allocator this map allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+    private:
+        template<std::size_t... indices>
+        static std::array<shard, shard_count> make_shards(allocator_t const &allocator, std::index_sequence<indices...>);
+
+        /**
+         * @brief Picks a shard from the top bits of key's hash. map uses the bottom bits so items in the same shard
+         * still spread out across it's slots.
+         */
+        shard &get_shard(key_t const &key);
+        /**
+         * @overload get_shard(key_t const &key)
+         */
+        shard const &get_shard(key_t const &key) const;
+        std::size_t get_shard_index(key_t const &key) const;
+    };
+}
+
+#include "concurrent_map.inl"
@@ -0,0 +1,307 @@
+#include <bit>
+#include <cstdint>
+#include <ember/core/exception.hpp>
+#include <limits>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+namespace ember::inline containers::internal {
+    void shared_spin_lock::lock() noexcept {
+        std::uint32_t attempt{ 0 };
+
+        //Claim the writer bit first so no new readers can get in, then wait for the current ones to leave.
+        std::uint32_t current{ state.load(std::memory_order_relaxed) };
+        while((current & writer_bit) != 0 || !state.compare_exchange_weak(current, current | writer_bit, std::memory_order_acquire, std::memory_order_relaxed)) {
+            back_off(attempt);
+            current = state.load(std::memory_order_relaxed);
+        }
+
+        while(state.load(std::memory_order_acquire) != writer_bit) {
+            back_off(attempt);
+        }
+    }
+
+    bool shared_spin_lock::try_lock() noexcept {
+        std::uint32_t expected{ 0 };
+        return state.compare_exchange_strong(expected, writer_bit, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void shared_spin_lock::unlock() noexcept {
+        state.store(0, std::memory_order_release);
+    }
+
+    void shared_spin_lock::lock_shared() noexcept {
+        std::uint32_t attempt{ 0 };
+        while(!try_lock_shared()) {
+            back_off(attempt);
+        }
+    }
+
+    bool shared_spin_lock::try_lock_shared() noexcept {
+        std::uint32_t current{ state.load(std::memory_order_relaxed) };
+        while((current & writer_bit) == 0) {
+            if(state.compare_exchange_weak(current, current + 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void shared_spin_lock::unlock_shared() noexcept {
+        state.fetch_sub(1, std::memory_order_release);
+    }
+
+    void shared_spin_lock::back_off(std::uint32_t &attempt) noexcept {
+        std::uint32_t constexpr pause_attempts{ 16 };
+
+        if(attempt < pause_attempts) {
+            ++attempt;
+#if EMBER_INTERNAL_MAP_USE_SSE2
+            _mm_pause();
+#endif
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+namespace ember::inline containers {
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::shard::shard(allocator_t allocator)
+        : items{ std::move(allocator) } {
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::concurrent_map() requires std::is_default_constructible_v<allocator_t>
+        : concurrent_map{ allocator_t{} } {
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::concurrent_map(allocator_t allocator)
+        : shards{ make_shards(allocator, std::make_index_sequence<shard_count>{}) } {
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::concurrent_map(concurrent_map &&other) noexcept
+        : shards{ make_shards(other.get_allocator(), std::make_index_sequence<shard_count>{}) }
+        , hash{ std::move(other.hash) } {
+        for(std::size_t i{ 0 }; i < shard_count; ++i) {
+            shards[i].items = std::move(other.shards[i].items);
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t> &concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::operator=(concurrent_map &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        for(std::size_t i{ 0 }; i < shard_count; ++i) {
+            shards[i].items = std::move(other.shards[i].items);
+        }
+        hash = std::move(other.hash);
+
+        return *this;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename... args_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::try_emplace(key_t const &key, args_t &&...args) {
+        shard &key_shard{ get_shard(key) };
+
+        std::unique_lock const lock{ key_shard.mutex };
+        return key_shard.items.try_emplace(key, std::forward<args_t>(args)...).second;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename... args_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::try_emplace(key_t &&key, args_t &&...args) {
+        shard &key_shard{ get_shard(key) };
+
+        std::unique_lock const lock{ key_shard.mutex };
+        return key_shard.items.try_emplace(std::move(key), std::forward<args_t>(args)...).second;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename value_arg_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::insert_or_assign(key_t const &key, value_arg_t &&value) {
+        shard &key_shard{ get_shard(key) };
+
+        std::unique_lock const lock{ key_shard.mutex };
+        auto [iter, inserted]{ key_shard.items.try_emplace(key, std::forward<value_arg_t>(value)) };
+        if(!inserted) {
+            iter->second = std::forward<value_arg_t>(value);
+        }
+
+        return inserted;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename factory_t>
+    value_t concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find_or_insert(key_t const &key, factory_t &&factory) requires std::copy_constructible<value_t> {
+        return find_or_insert(key, std::forward<factory_t>(factory), [](value_t const &value) {
+            return value;
+        });
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename factory_t, typename function_t>
+    decltype(auto) concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find_or_insert(key_t const &key, factory_t &&factory, function_t &&function) {
+        shard &key_shard{ get_shard(key) };
+
+        {
+            std::shared_lock const lock{ key_shard.mutex };
+            if(auto const iter{ key_shard.items.find(key) }; iter != key_shard.items.end()) {
+                return std::invoke(std::forward<function_t>(function), std::as_const(iter->second));
+            }
+        }
+
+        //Another thread could have inserted key between the locks so it needs checking again.
+        std::unique_lock const lock{ key_shard.mutex };
+        auto iter{ key_shard.items.find(key) };
+        if(iter == key_shard.items.end()) {
+            iter = key_shard.items.try_emplace(key, std::invoke(std::forward<factory_t>(factory))).first;
+        }
+
+        return std::invoke(std::forward<function_t>(function), std::as_const(iter->second));
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::optional<value_t> concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find(key_t const &key) const requires std::copy_constructible<value_t> {
+        shard const &key_shard{ get_shard(key) };
+
+        std::shared_lock const lock{ key_shard.mutex };
+        if(auto const iter{ key_shard.items.find(key) }; iter != key_shard.items.end()) {
+            return iter->second;
+        }
+
+        return std::nullopt;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    value_t concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::at(key_t const &key) const requires std::copy_constructible<value_t> {
+        shard const &key_shard{ get_shard(key) };
+
+        std::shared_lock const lock{ key_shard.mutex };
+        return key_shard.items.at(key);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename function_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::visit(key_t const &key, function_t &&function) const {
+        shard const &key_shard{ get_shard(key) };
+
+        std::shared_lock const lock{ key_shard.mutex };
+        auto const iter{ key_shard.items.find(key) };
+        if(iter == key_shard.items.end()) {
+            return false;
+        }
+
+        std::invoke(std::forward<function_t>(function), iter->second);
+        return true;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename function_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::update(key_t const &key, function_t &&function) {
+        shard &key_shard{ get_shard(key) };
+
+        std::unique_lock const lock{ key_shard.mutex };
+        auto const iter{ key_shard.items.find(key) };
+        if(iter == key_shard.items.end()) {
+            return false;
+        }
+
+        std::invoke(std::forward<function_t>(function), iter->second);
+        return true;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename function_t>
+    void concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::for_each(function_t &&function) const {
+        for(shard const &current_shard : shards) {
+            std::shared_lock const lock{ current_shard.mutex };
+            for(auto const &[key, value] : current_shard.items) {
+                std::invoke(function, key, value);
+            }
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::contains(key_t const &key) const {
+        shard const &key_shard{ get_shard(key) };
+
+        std::shared_lock const lock{ key_shard.mutex };
+        return key_shard.items.contains(key);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::erase(key_t const &key) {
+        shard &key_shard{ get_shard(key) };
+
+        std::unique_lock const lock{ key_shard.mutex };
+        return key_shard.items.erase(key);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::clear() {
+        for(shard &current_shard : shards) {
+            std::unique_lock const lock{ current_shard.mutex };
+            current_shard.items.clear();
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::size() const {
+        std::size_t count{ 0 };
+        for(shard const &current_shard : shards) {
+            std::shared_lock const lock{ current_shard.mutex };
+            count += current_shard.items.size();
+        }
+
+        return count;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    bool concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::empty() const {
+        return size() == 0;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    allocator_t concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_allocator() const {
+        return shards[0].items.get_allocator();
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<std::size_t... indices>
+    std::array<typename concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::shard, concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::shard_count> concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::make_shards(allocator_t const &allocator, std::index_sequence<indices...>) {
+        //Shards can't be moved because of their mutex, so they are constructed in place with the allocator.
+        return std::array<shard, shard_count>{ shard{ (static_cast<void>(indices), allocator) }... };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::shard &concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_shard(key_t const &key) {
+        return shards[get_shard_index(key)];
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::shard const &concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_shard(key_t const &key) const {
+        return shards[get_shard_index(key)];
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t concurrent_map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_shard_index(key_t const &key) const {
+        static_assert(std::has_single_bit(shard_count), "shard_count must be a power of two.");
+        std::size_t constexpr shard_shift{ std::numeric_limits<std::uint64_t>::digits - std::countr_zero(shard_count) };
+
+        //Finaliser from MurmurHash3, same as map, so the top bits depend on every bit of the key's hash.
+        auto hash_value{ static_cast<std::uint64_t>(hash(key)) };
+        hash_value ^= hash_value >> 33;
+        hash_value *= 0xff51afd7ed558ccdull;
+        hash_value ^= hash_value >> 33;
+
+        return static_cast<std::size_t>(hash_value >> shard_shift);
+    }
+}
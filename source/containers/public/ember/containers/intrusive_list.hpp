@@ -0,0 +1,276 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace ember::inline containers {
+    /**
+     * @brief Links an object into an intrusive_list. Objects inherit from this once for each list they can be
+     * in at the same time, using tag_t to tell the links apart.
+     * @details Copying or assigning a node never copies it's links, a copied object starts off unlinked.
+     * @tparam tag_t
+     */
+    template<typename tag_t = void>
+    struct intrusive_list_node {
+        //VARIABLES
+    public:
+        intrusive_list_node *previous{ nullptr };
+        intrusive_list_node *next{ nullptr };
+
+        //FUNCTIONS
+    public:
+        intrusive_list_node() noexcept;
+
+        intrusive_list_node(intrusive_list_node const &other) noexcept;
+        intrusive_list_node &operator=(intrusive_list_node const &other) noexcept;
+
+        ~intrusive_list_node();
+
+        /**
+         * @brief Returns true if this node is currently inside a list.
+         * @return
+         */
+        bool is_linked() const noexcept;
+    };
+}
+
+namespace ember::inline containers::internal {
+    /**
+     * @brief Bidirectional iterator over lists built from intrusive_list_nodes. list_t provides the node_type
+     * it walks and get_item to turn a node into the item it links.
+     */
+    template<typename list_t, typename value_t>
+    class list_iterator {
+        template<typename other_list_t, typename other_value_t>
+        friend class list_iterator;
+        friend list_t;
+
+        //TYPES
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+
+        using value_type     = std::remove_const_t<value_t>;
+        using pointer_type   = value_t *;
+        using reference_type = value_t &;
+
+        using difference_type = std::ptrdiff_t;
+
+    private:
+        using node_type = typename list_t::node_type;
+
+        //VARIABLES
+    private:
+        node_type *node{ nullptr };
+
+        //FUNCTIONS
+    public:
+        list_iterator();
+        explicit list_iterator(node_type *node);
+        /**
+         * @brief Allows an iterator to be converted into a const_iterator.
+         */
+        template<typename other_value_t>
+        list_iterator(list_iterator<list_t, other_value_t> const &other) requires std::same_as<value_t, other_value_t const>;
+        /**
+         * @brief Allows a list built on top of another list to convert between their iterators.
+         */
+        template<typename other_list_t, typename other_value_t>
+        explicit list_iterator(list_iterator<other_list_t, other_value_t> const &other) requires(!std::same_as<list_t, other_list_t>);
+
+        list_iterator(list_iterator const &other);
+        list_iterator(list_iterator &&other) noexcept;
+
+        list_iterator &operator=(list_iterator const &other);
+        list_iterator &operator=(list_iterator &&other) noexcept;
+
+        ~list_iterator();
+
+        pointer_type operator->() const;
+        reference_type operator*() const;
+
+        list_iterator &operator++();
+        list_iterator operator++(int);
+
+        list_iterator &operator--();
+        list_iterator operator--(int);
+
+        template<typename list_t_1, typename value_t_1, typename value_t_2>
+        friend bool operator==(list_iterator<list_t_1, value_t_1> const &lhs, list_iterator<list_t_1, value_t_2> const &rhs) noexcept;
+        template<typename list_t_1, typename value_t_1, typename value_t_2>
+        friend bool operator!=(list_iterator<list_t_1, value_t_1> const &lhs, list_iterator<list_t_1, value_t_2> const &rhs) noexcept;
+    };
+}
+
+namespace ember::inline containers {
+    /**
+     * @brief Doubly linked list that threads through links stored inside the objects themselves.
+     * @details The list never allocates, copies or destroys the objects it holds. Linking, unlinking and splicing
+     * are O(1) and an iterator can be made straight from an object with iterator_to. Objects must outlive their
+     * time in the list and can only be in one list per intrusive_list_node base they inherit from.
+     * @tparam T Must publicly inherit from intrusive_list_node<tag_t>.
+     * @tparam tag_t Selects which intrusive_list_node base of T this list uses.
+     */
+    template<typename T, typename tag_t = void>
+    class intrusive_list {
+        static_assert(std::is_base_of_v<intrusive_list_node<tag_t>, T>, "T must inherit from intrusive_list_node<tag_t> to be put in an intrusive_list.");
+
+        template<typename list_t, typename value_t>
+        friend class internal::list_iterator;
+
+        //TYPES
+    public:
+        using value_type           = T;
+        using node_type            = intrusive_list_node<tag_t>;
+        using pointer_type         = T *;
+        using const_pointer_type   = T const *;
+        using reference_type       = T &;
+        using const_reference_type = T const &;
+
+        using iterator               = internal::list_iterator<intrusive_list, T>;
+        using const_iterator         = internal::list_iterator<intrusive_list, T const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        //VARIABLES
+    private:
+        node_type root{};       /**< Sentinel that the first and last objects link back to. Acts as end(). */
+        std::size_t count{ 0 }; /**< How many objects are currently linked. */
+
+        //FUNCTIONS
+    public:
+        intrusive_list() noexcept;
+
+        intrusive_list(intrusive_list const &other) = delete;
+        intrusive_list(intrusive_list &&other) noexcept;
+
+        intrusive_list &operator=(intrusive_list const &other) = delete;
+        intrusive_list &operator=(intrusive_list &&other) noexcept;
+
+        ~intrusive_list();
+
+        /**
+         * @brief Links item onto the front of the list.
+         * @param item Must not already be in a list.
+         */
+        void push_front(reference_type item) noexcept;
+        /**
+         * @brief Links item onto the back of the list.
+         * @param item Must not already be in a list.
+         */
+        void push_back(reference_type item) noexcept;
+
+        /**
+         * @brief Links item into the list before position.
+         * @param position
+         * @param item Must not already be in a list.
+         * @return Returns an iterator to item.
+         */
+        iterator insert(const_iterator position, reference_type item) noexcept;
+
+        /**
+         * @brief Unlinks the object at position from the list.
+         * @param position
+         * @return Returns an iterator to the object after position.
+         */
+        iterator erase(const_iterator position) noexcept;
+        /**
+         * @brief Unlinks all objects in the range [first, last).
+         * @param first
+         * @param last
+         * @return Returns last.
+         */
+        iterator erase(const_iterator first, const_iterator last) noexcept;
+        /**
+         * @brief Unlinks item from this list.
+         * @param item Must be in this list.
+         */
+        void remove(reference_type item) noexcept;
+
+        /**
+         * @brief Unlinks the object at the front of the list.
+         */
+        void pop_front() noexcept;
+        /**
+         * @brief Unlinks the object at the back of the list.
+         */
+        void pop_back() noexcept;
+
+        /**
+         * @brief Unlinks every object from the list.
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Moves the object at item from other into this list before position.
+         * @param position
+         * @param other Can be this list.
+         * @param item
+         */
+        void splice(const_iterator position, intrusive_list &other, const_iterator item) noexcept;
+        /**
+         * @brief Moves every object from other into this list before position.
+         * @param position
+         * @param other Must not be this list.
+         */
+        void splice(const_iterator position, intrusive_list &other) noexcept;
+
+        /**
+         * @brief Returns an iterator to item.
+         * @param item Must be in this list.
+         * @return
+         */
+        iterator iterator_to(reference_type item) noexcept;
+        const_iterator iterator_to(const_reference_type item) const noexcept;
+
+        reference_type front();
+        const_reference_type front() const;
+
+        reference_type back();
+        const_reference_type back() const;
+
+        std::size_t size() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        reverse_iterator rbegin() noexcept;
+        const_reverse_iterator rbegin() const noexcept;
+        const_reverse_iterator crbegin() const noexcept;
+
+        reverse_iterator rend() noexcept;
+        const_reverse_iterator rend() const noexcept;
+        const_reverse_iterator crend() const noexcept;
+
+    private:
+        void link_before(node_type *position, node_type *item) noexcept;
+        void unlink(node_type *item) noexcept;
+
+        node_type *get_root() const noexcept;
+
+        static T *get_item(node_type *node) noexcept;
+    };
+}
+
+namespace std {
+    //Specialised iterator traits for certain std algorithms.
+    template<typename list_t, typename value_t>
+    struct iterator_traits<ember::containers::internal::list_iterator<list_t, value_t>> {
+        using iterator_category = typename ember::containers::internal::list_iterator<list_t, value_t>::iterator_category;
+
+        using value_type = typename ember::containers::internal::list_iterator<list_t, value_t>::value_type;
+        using pointer    = typename ember::containers::internal::list_iterator<list_t, value_t>::pointer_type;
+        using reference  = typename ember::containers::internal::list_iterator<list_t, value_t>::reference_type;
+
+        using difference_type = typename ember::containers::internal::list_iterator<list_t, value_t>::difference_type;
+    };
+}
+
+#include "intrusive_list.inl"
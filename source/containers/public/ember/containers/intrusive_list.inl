@@ -0,0 +1,377 @@
+#include <ember/core/log.hpp>
+
+namespace ember::inline containers {
+    template<typename tag_t>
+    intrusive_list_node<tag_t>::intrusive_list_node() noexcept = default;
+
+    template<typename tag_t>
+    intrusive_list_node<tag_t>::intrusive_list_node(intrusive_list_node const &) noexcept {
+        //Links belong to the list, not the object.
+    }
+
+    template<typename tag_t>
+    intrusive_list_node<tag_t> &intrusive_list_node<tag_t>::operator=(intrusive_list_node const &) noexcept {
+        return *this;
+    }
+
+    template<typename tag_t>
+    intrusive_list_node<tag_t>::~intrusive_list_node() = default;
+
+    template<typename tag_t>
+    bool intrusive_list_node<tag_t>::is_linked() const noexcept {
+        return next != nullptr;
+    }
+
+    namespace internal {
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t>::list_iterator() = default;
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t>::list_iterator(node_type *node)
+            : node{ node } {
+        }
+
+        template<typename list_t, typename value_t>
+        template<typename other_value_t>
+        list_iterator<list_t, value_t>::list_iterator(list_iterator<list_t, other_value_t> const &other) requires std::same_as<value_t, other_value_t const>
+            : node{ other.node } {
+        }
+
+        template<typename list_t, typename value_t>
+        template<typename other_list_t, typename other_value_t>
+        list_iterator<list_t, value_t>::list_iterator(list_iterator<other_list_t, other_value_t> const &other) requires(!std::same_as<list_t, other_list_t>)
+            : node{ other.node } {
+        }
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t>::list_iterator(list_iterator const &other) = default;
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t>::list_iterator(list_iterator &&other) noexcept = default;
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t> &list_iterator<list_t, value_t>::operator=(list_iterator const &other) = default;
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t> &list_iterator<list_t, value_t>::operator=(list_iterator &&other) noexcept = default;
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t>::~list_iterator() = default;
+
+        template<typename list_t, typename value_t>
+        typename list_iterator<list_t, value_t>::pointer_type list_iterator<list_t, value_t>::operator->() const {
+            EMBER_CHECK(node != nullptr);
+            return list_t::get_item(node);
+        }
+
+        template<typename list_t, typename value_t>
+        typename list_iterator<list_t, value_t>::reference_type list_iterator<list_t, value_t>::operator*() const {
+            EMBER_CHECK(node != nullptr);
+            return *list_t::get_item(node);
+        }
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t> &list_iterator<list_t, value_t>::operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t> list_iterator<list_t, value_t>::operator++(int) {
+            list_iterator previous{ *this };
+            node = node->next;
+            return previous;
+        }
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t> &list_iterator<list_t, value_t>::operator--() {
+            node = node->previous;
+            return *this;
+        }
+
+        template<typename list_t, typename value_t>
+        list_iterator<list_t, value_t> list_iterator<list_t, value_t>::operator--(int) {
+            list_iterator previous{ *this };
+            node = node->previous;
+            return previous;
+        }
+
+        template<typename list_t_1, typename value_t_1, typename value_t_2>
+        bool operator==(list_iterator<list_t_1, value_t_1> const &lhs, list_iterator<list_t_1, value_t_2> const &rhs) noexcept {
+            return lhs.node == rhs.node;
+        }
+
+        template<typename list_t_1, typename value_t_1, typename value_t_2>
+        bool operator!=(list_iterator<list_t_1, value_t_1> const &lhs, list_iterator<list_t_1, value_t_2> const &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+    }
+
+    template<typename T, typename tag_t>
+    intrusive_list<T, tag_t>::intrusive_list() noexcept {
+        root.previous = &root;
+        root.next     = &root;
+    }
+
+    template<typename T, typename tag_t>
+    intrusive_list<T, tag_t>::intrusive_list(intrusive_list &&other) noexcept
+        : intrusive_list{} {
+        splice(end(), other);
+    }
+
+    template<typename T, typename tag_t>
+    intrusive_list<T, tag_t> &intrusive_list<T, tag_t>::operator=(intrusive_list &&other) noexcept {
+        if(this != &other) {
+            clear();
+            splice(end(), other);
+        }
+
+        return *this;
+    }
+
+    template<typename T, typename tag_t>
+    intrusive_list<T, tag_t>::~intrusive_list() {
+        clear();
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::push_front(reference_type item) noexcept {
+        link_before(root.next, &item);
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::push_back(reference_type item) noexcept {
+        link_before(&root, &item);
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::iterator intrusive_list<T, tag_t>::insert(const_iterator position, reference_type item) noexcept {
+        link_before(position.node, &item);
+        return iterator{ &item };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::iterator intrusive_list<T, tag_t>::erase(const_iterator position) noexcept {
+        EMBER_CHECK(position.node != &root);
+
+        node_type *const next{ position.node->next };
+        unlink(position.node);
+
+        return iterator{ next };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::iterator intrusive_list<T, tag_t>::erase(const_iterator first, const_iterator last) noexcept {
+        while(first != last) {
+            first = erase(first);
+        }
+        return iterator{ last.node };
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::remove(reference_type item) noexcept {
+        unlink(&item);
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::pop_front() noexcept {
+        EMBER_CHECK(!empty());
+        unlink(root.next);
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::pop_back() noexcept {
+        EMBER_CHECK(!empty());
+        unlink(root.previous);
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::clear() noexcept {
+        //Reset each node's links so they can be put into another list.
+        for(node_type *node{ root.next }; node != &root;) {
+            node_type *const next{ node->next };
+
+            node->previous = nullptr;
+            node->next     = nullptr;
+
+            node = next;
+        }
+
+        root.previous = &root;
+        root.next     = &root;
+        count         = 0;
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::splice(const_iterator position, intrusive_list &other, const_iterator item) noexcept {
+        if(&other == this && (position == item || position.node == item.node->next)) {
+            return;//Already in place.
+        }
+
+        other.unlink(item.node);
+        link_before(position.node, item.node);
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::splice(const_iterator position, intrusive_list &other) noexcept {
+        EMBER_CHECK(this != &other);
+
+        if(other.empty()) {
+            return;
+        }
+
+        node_type *const first{ other.root.next };
+        node_type *const last{ other.root.previous };
+        node_type *const after{ position.node };
+        node_type *const before{ after->previous };
+
+        before->next    = first;
+        first->previous = before;
+        last->next      = after;
+        after->previous = last;
+
+        count += other.count;
+
+        other.root.previous = &other.root;
+        other.root.next     = &other.root;
+        other.count         = 0;
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::iterator intrusive_list<T, tag_t>::iterator_to(reference_type item) noexcept {
+        return iterator{ &item };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_iterator intrusive_list<T, tag_t>::iterator_to(const_reference_type item) const noexcept {
+        return const_iterator{ const_cast<node_type *>(static_cast<node_type const *>(&item)) };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::reference_type intrusive_list<T, tag_t>::front() {
+        EMBER_CHECK(!empty());
+        return *get_item(root.next);
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_reference_type intrusive_list<T, tag_t>::front() const {
+        EMBER_CHECK(!empty());
+        return *get_item(root.next);
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::reference_type intrusive_list<T, tag_t>::back() {
+        EMBER_CHECK(!empty());
+        return *get_item(root.previous);
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_reference_type intrusive_list<T, tag_t>::back() const {
+        EMBER_CHECK(!empty());
+        return *get_item(root.previous);
+    }
+
+    template<typename T, typename tag_t>
+    std::size_t intrusive_list<T, tag_t>::size() const noexcept {
+        return count;
+    }
+
+    template<typename T, typename tag_t>
+    bool intrusive_list<T, tag_t>::empty() const noexcept {
+        return count == 0;
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::iterator intrusive_list<T, tag_t>::begin() noexcept {
+        return iterator{ root.next };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_iterator intrusive_list<T, tag_t>::begin() const noexcept {
+        return const_iterator{ root.next };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_iterator intrusive_list<T, tag_t>::cbegin() const noexcept {
+        return begin();
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::iterator intrusive_list<T, tag_t>::end() noexcept {
+        return iterator{ get_root() };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_iterator intrusive_list<T, tag_t>::end() const noexcept {
+        return const_iterator{ get_root() };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_iterator intrusive_list<T, tag_t>::cend() const noexcept {
+        return end();
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::reverse_iterator intrusive_list<T, tag_t>::rbegin() noexcept {
+        return reverse_iterator{ end() };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_reverse_iterator intrusive_list<T, tag_t>::rbegin() const noexcept {
+        return const_reverse_iterator{ end() };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_reverse_iterator intrusive_list<T, tag_t>::crbegin() const noexcept {
+        return rbegin();
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::reverse_iterator intrusive_list<T, tag_t>::rend() noexcept {
+        return reverse_iterator{ begin() };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_reverse_iterator intrusive_list<T, tag_t>::rend() const noexcept {
+        return const_reverse_iterator{ begin() };
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::const_reverse_iterator intrusive_list<T, tag_t>::crend() const noexcept {
+        return rend();
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::link_before(node_type *position, node_type *item) noexcept {
+        EMBER_CHECK(!item->is_linked());
+
+        item->previous           = position->previous;
+        item->next               = position;
+        position->previous->next = item;
+        position->previous       = item;
+
+        ++count;
+    }
+
+    template<typename T, typename tag_t>
+    void intrusive_list<T, tag_t>::unlink(node_type *item) noexcept {
+        EMBER_CHECK(item != &root && item->is_linked());
+
+        item->previous->next = item->next;
+        item->next->previous = item->previous;
+        item->previous       = nullptr;
+        item->next           = nullptr;
+
+        --count;
+    }
+
+    template<typename T, typename tag_t>
+    typename intrusive_list<T, tag_t>::node_type *intrusive_list<T, tag_t>::get_root() const noexcept {
+        return const_cast<node_type *>(&root);
+    }
+
+    template<typename T, typename tag_t>
+    T *intrusive_list<T, tag_t>::get_item(node_type *node) noexcept {
+        return static_cast<T *>(node);
+    }
+}
@@ -1,8 +1,247 @@
 #pragma once
 
-#include <list>
+#include <cstddef>
+#include <ember/containers/intrusive_list.hpp>
+#include <ember/memory/allocator.hpp>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
 
 namespace ember::inline containers {
-    template<typename T>
-    using linked_list = std::list<T>;
-}
\ No newline at end of file
+    /**
+     * @brief Doubly linked list of T that pools it's nodes in contiguous slabs.
+     * @details Nodes are handed out from slabs in address order and erased nodes go onto a free list to be
+     * reused, so once the list has grown to it's working size inserting and erasing never allocates and
+     * neighbouring items tend to sit next to each other in memory. Items never move while they're in the
+     * list, so pointers and iterators stay valid until the item is erased. Memory is only returned to the
+     * allocator when the list is destroyed.
+     * @tparam T
+     * @tparam allocator_t Allocator used for the node slabs.
+     */
+    template<typename T, allocator allocator_t = global_allocator_ref>
+    class linked_list {
+        template<typename list_t, typename value_t>
+        friend class internal::list_iterator;
+
+        //TYPES
+    public:
+        using value_type           = T;
+        using allocator_type       = allocator_t;
+        using pointer_type         = T *;
+        using const_pointer_type   = T const *;
+        using reference_type       = T &;
+        using const_reference_type = T const &;
+
+        using iterator               = internal::list_iterator<linked_list, T>;
+        using const_iterator         = internal::list_iterator<linked_list, T const>;
+        using reverse_iterator       = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    private:
+        using node_type = intrusive_list_node<>;
+
+        struct node_storage {
+            alignas(T) std::byte storage[sizeof(T)]; /**< Storage for the item. Only constructed while the node is in the list. */
+        };
+        struct node : public node_storage, public node_type {};
+
+        struct slab {
+            slab *next{ nullptr };      /**< Slab allocated before this one. */
+            std::size_t capacity{ 0 }; /**< How many nodes follow this header. */
+
+            node *get_nodes() noexcept;
+        };
+
+        //VARIABLES
+    private:
+        static std::size_t constexpr min_slab_capacity{ 16 };
+
+        intrusive_list<node> nodes{};  /**< Nodes holding the items, in list order. */
+        node *free_nodes{ nullptr };  /**< Nodes not in the list, chained through their next link. */
+        slab *slabs{ nullptr };       /**< Every slab this list owns, most recent first. */
+        std::size_t cap{ 0 };         /**< Total nodes across all slabs. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the slabs are allocated from. */
+
+        //FUNCTIONS
+    public:
+        linked_list() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit linked_list(allocator_t allocator) noexcept;
+        linked_list(std::initializer_list<T> init) requires std::is_default_constructible_v<allocator_t>;
+        template<typename iterator_type>
+        linked_list(iterator_type begin, iterator_type end) requires std::is_default_constructible_v<allocator_t>;
+
+        linked_list(linked_list const &other);
+        linked_list(linked_list &&other) noexcept;
+
+        linked_list &operator=(linked_list const &other);
+        linked_list &operator=(linked_list &&other) noexcept;
+
+        ~linked_list();
+
+        /**
+         * @brief Copies val onto the front of the list.
+         * @param val
+         */
+        void push_front(const_reference_type val);
+        /**
+         * @brief Moves val onto the front of the list.
+         * @param val
+         */
+        void push_front(value_type &&val);
+        /**
+         * @brief Copies val onto the back of the list.
+         * @param val
+         */
+        void push_back(const_reference_type val);
+        /**
+         * @brief Moves val onto the back of the list.
+         * @param val
+         */
+        void push_back(value_type &&val);
+
+        /**
+         * @brief Constructs a new item at the front of the list with args.
+         * @tparam args_t
+         * @param args
+         * @return Returns a reference to the new item.
+         */
+        template<typename... args_t>
+        reference_type emplace_front(args_t &&...args);
+        /**
+         * @brief Constructs a new item at the back of the list with args.
+         * @tparam args_t
+         * @param args
+         * @return Returns a reference to the new item.
+         */
+        template<typename... args_t>
+        reference_type emplace_back(args_t &&...args);
+        /**
+         * @brief Constructs a new item before position with args.
+         * @tparam args_t
+         * @param position
+         * @param args
+         * @return Returns an iterator to the new item.
+         */
+        template<typename... args_t>
+        iterator emplace(const_iterator position, args_t &&...args);
+
+        /**
+         * @brief Copies val into the list before position.
+         * @param position
+         * @param val
+         * @return Returns an iterator to the new item.
+         */
+        iterator insert(const_iterator position, const_reference_type val);
+        /**
+         * @brief Moves val into the list before position.
+         * @param position
+         * @param val
+         * @return Returns an iterator to the new item.
+         */
+        iterator insert(const_iterator position, value_type &&val);
+
+        /**
+         * @brief Destructs the item at position and returns it's node to the pool.
+         * @param position
+         * @return Returns an iterator to the item after position.
+         */
+        iterator erase(const_iterator position);
+        /**
+         * @brief Destructs all items in the range [first, last).
+         * @param first
+         * @param last
+         * @return Returns last.
+         */
+        iterator erase(const_iterator first, const_iterator last);
+
+        /**
+         * @brief Destructs the item at the front of the list.
+         */
+        void pop_front();
+        /**
+         * @brief Destructs the item at the back of the list.
+         */
+        void pop_back();
+
+        /**
+         * @brief Destructs every item in the list. Keeps the nodes pooled for reuse.
+         */
+        void clear();
+
+        /**
+         * @brief Makes sure the list can hold at least capacity items without allocating. Any extra nodes are
+         * allocated as a single slab.
+         * @param capacity
+         */
+        void reserve(std::size_t const capacity);
+
+        /**
+         * @brief Returns an iterator to item in O(1).
+         * @param item Must be an item in this list.
+         * @return
+         */
+        iterator iterator_to(reference_type item) noexcept;
+        const_iterator iterator_to(const_reference_type item) const noexcept;
+
+        reference_type front();
+        const_reference_type front() const;
+
+        reference_type back();
+        const_reference_type back() const;
+
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns how many items the list can hold before allocating another slab.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the allocator this list allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        reverse_iterator rbegin() noexcept;
+        const_reverse_iterator rbegin() const noexcept;
+        const_reverse_iterator crbegin() const noexcept;
+
+        reverse_iterator rend() noexcept;
+        const_reverse_iterator rend() const noexcept;
+        const_reverse_iterator crend() const noexcept;
+
+        template<typename T_1, typename allocator_t_1>
+        friend bool operator==(linked_list<T_1, allocator_t_1> const &lhs, linked_list<T_1, allocator_t_1> const &rhs);
+        template<typename T_1, typename allocator_t_1>
+        friend bool operator!=(linked_list<T_1, allocator_t_1> const &lhs, linked_list<T_1, allocator_t_1> const &rhs);
+
+    private:
+        /**
+         * @brief Takes a node off the free list, allocating a new slab if there are none left.
+         */
+        node *acquire_node();
+        /**
+         * @brief Destructs the item in to_release and puts it's node back on the free list.
+         */
+        void release_node(node *to_release);
+
+        void allocate_slab(std::size_t const capacity);
+        void free_slabs();
+
+        static T *get_item(node_type *link) noexcept;
+        static node *get_node(T const &item) noexcept;
+        static node *get_node(const_iterator position) noexcept;
+    };
+}
+
+#include "linked_list.inl"
@@ -0,0 +1,413 @@
+#include <algorithm>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <new>
+#include <utility>
+
+namespace ember::inline containers {
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::node *linked_list<T, allocator_t>::slab::get_nodes() noexcept {
+        std::size_t constexpr header_bytes{ (sizeof(slab) + alignof(node) - 1) / alignof(node) * alignof(node) };
+        return reinterpret_cast<node *>(reinterpret_cast<std::byte *>(this) + header_bytes);
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t>::linked_list() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t>::linked_list(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t>::linked_list(std::initializer_list<T> init) requires std::is_default_constructible_v<allocator_t>
+        : linked_list{ std::begin(init), std::end(init) } {
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename iterator_type>
+    linked_list<T, allocator_t>::linked_list(iterator_type begin, iterator_type end) requires std::is_default_constructible_v<allocator_t> {
+        if constexpr(std::forward_iterator<iterator_type>) {
+            reserve(static_cast<std::size_t>(std::distance(begin, end)));
+        }
+        for(; begin != end; ++begin) {
+            emplace_back(*begin);
+        }
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t>::linked_list(linked_list const &other)
+        : allocator{ other.allocator } {
+        //Copies go into a single slab so they're laid out in list order.
+        reserve(other.size());
+        for(auto const &item : other) {
+            emplace_back(item);
+        }
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t>::linked_list(linked_list &&other) noexcept
+        : nodes{ std::move(other.nodes) }
+        , free_nodes{ std::exchange(other.free_nodes, nullptr) }
+        , slabs{ std::exchange(other.slabs, nullptr) }
+        , cap{ std::exchange(other.cap, 0) }
+        , allocator{ std::move(other.allocator) } {
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t> &linked_list<T, allocator_t>::operator=(linked_list const &other) {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+        reserve(other.size());
+        for(auto const &item : other) {
+            emplace_back(item);
+        }
+
+        return *this;
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t> &linked_list<T, allocator_t>::operator=(linked_list &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
+        }
+
+        if(can_take_memory) {
+            free_slabs();
+
+            nodes      = std::move(other.nodes);
+            free_nodes = std::exchange(other.free_nodes, nullptr);
+            slabs      = std::exchange(other.slabs, nullptr);
+            cap        = std::exchange(other.cap, 0);
+        } else {
+            //Our allocator can't free other's slabs, so move each item across instead.
+            reserve(other.size());
+            for(auto &item : other) {
+                emplace_back(std::move(item));
+            }
+            other.clear();
+        }
+
+        return *this;
+    }
+
+    template<typename T, allocator allocator_t>
+    linked_list<T, allocator_t>::~linked_list() {
+        clear();
+        free_slabs();
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::push_front(const_reference_type val) {
+        emplace_front(val);
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::push_front(value_type &&val) {
+        emplace_front(std::move(val));
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::push_back(const_reference_type val) {
+        emplace_back(val);
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::push_back(value_type &&val) {
+        emplace_back(std::move(val));
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename... args_t>
+    typename linked_list<T, allocator_t>::reference_type linked_list<T, allocator_t>::emplace_front(args_t &&...args) {
+        return *emplace(cbegin(), std::forward<args_t>(args)...);
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename... args_t>
+    typename linked_list<T, allocator_t>::reference_type linked_list<T, allocator_t>::emplace_back(args_t &&...args) {
+        return *emplace(cend(), std::forward<args_t>(args)...);
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename... args_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::emplace(const_iterator position, args_t &&...args) {
+        node *const new_node{ acquire_node() };
+        new(new_node->storage) T{ std::forward<args_t>(args)... };
+
+        return iterator{ nodes.insert(typename intrusive_list<node>::const_iterator{ position }, *new_node) };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::insert(const_iterator position, const_reference_type val) {
+        return emplace(position, val);
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::insert(const_iterator position, value_type &&val) {
+        return emplace(position, std::move(val));
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::erase(const_iterator position) {
+        EMBER_CHECK(position != end());
+
+        node *const to_erase{ get_node(position) };
+        iterator const next{ nodes.erase(nodes.iterator_to(*to_erase)) };
+        release_node(to_erase);
+
+        return next;
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::erase(const_iterator first, const_iterator last) {
+        while(first != last) {
+            first = erase(first);
+        }
+        return iterator{ last.node };
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::pop_front() {
+        EMBER_CHECK(!empty());
+        erase(cbegin());
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::pop_back() {
+        EMBER_CHECK(!empty());
+        erase(std::prev(cend()));
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::clear() {
+        while(!nodes.empty()) {
+            node &to_erase{ nodes.back() };
+            nodes.pop_back();
+            release_node(&to_erase);
+        }
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::reserve(std::size_t const capacity) {
+        if(capacity > cap) {
+            allocate_slab(capacity - cap);
+        }
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::iterator_to(reference_type item) noexcept {
+        return iterator{ nodes.iterator_to(*get_node(item)) };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_iterator linked_list<T, allocator_t>::iterator_to(const_reference_type item) const noexcept {
+        return const_iterator{ nodes.iterator_to(*get_node(item)) };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::reference_type linked_list<T, allocator_t>::front() {
+        EMBER_CHECK(!empty());
+        return *begin();
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_reference_type linked_list<T, allocator_t>::front() const {
+        EMBER_CHECK(!empty());
+        return *begin();
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::reference_type linked_list<T, allocator_t>::back() {
+        EMBER_CHECK(!empty());
+        return *std::prev(end());
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_reference_type linked_list<T, allocator_t>::back() const {
+        EMBER_CHECK(!empty());
+        return *std::prev(end());
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t linked_list<T, allocator_t>::size() const noexcept {
+        return nodes.size();
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t linked_list<T, allocator_t>::capacity() const noexcept {
+        return cap;
+    }
+
+    template<typename T, allocator allocator_t>
+    bool linked_list<T, allocator_t>::empty() const noexcept {
+        return nodes.empty();
+    }
+
+    template<typename T, allocator allocator_t>
+    allocator_t linked_list<T, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::begin() noexcept {
+        return iterator{ nodes.begin() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_iterator linked_list<T, allocator_t>::begin() const noexcept {
+        return const_iterator{ nodes.begin() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_iterator linked_list<T, allocator_t>::cbegin() const noexcept {
+        return begin();
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::iterator linked_list<T, allocator_t>::end() noexcept {
+        return iterator{ nodes.end() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_iterator linked_list<T, allocator_t>::end() const noexcept {
+        return const_iterator{ nodes.end() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_iterator linked_list<T, allocator_t>::cend() const noexcept {
+        return end();
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::reverse_iterator linked_list<T, allocator_t>::rbegin() noexcept {
+        return reverse_iterator{ end() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_reverse_iterator linked_list<T, allocator_t>::rbegin() const noexcept {
+        return const_reverse_iterator{ end() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_reverse_iterator linked_list<T, allocator_t>::crbegin() const noexcept {
+        return rbegin();
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::reverse_iterator linked_list<T, allocator_t>::rend() noexcept {
+        return reverse_iterator{ begin() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_reverse_iterator linked_list<T, allocator_t>::rend() const noexcept {
+        return const_reverse_iterator{ begin() };
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::const_reverse_iterator linked_list<T, allocator_t>::crend() const noexcept {
+        return rend();
+    }
+
+    template<typename T_1, typename allocator_t_1>
+    bool operator==(linked_list<T_1, allocator_t_1> const &lhs, linked_list<T_1, allocator_t_1> const &rhs) {
+        return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<typename T_1, typename allocator_t_1>
+    bool operator!=(linked_list<T_1, allocator_t_1> const &lhs, linked_list<T_1, allocator_t_1> const &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::node *linked_list<T, allocator_t>::acquire_node() {
+        if(free_nodes == nullptr) {
+            //Grow geometrically so the number of slabs stays logarithmic in the list's size.
+            allocate_slab(std::max(min_slab_capacity, cap));
+        }
+
+        node *const acquired{ free_nodes };
+        free_nodes     = static_cast<node *>(acquired->next);
+        acquired->next = nullptr;
+
+        return acquired;
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::release_node(node *to_release) {
+        get_item(to_release)->~T();
+
+        //Released nodes are reused first so a list that erases and inserts keeps touching the same memory.
+        to_release->next = free_nodes;
+        free_nodes       = to_release;
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::allocate_slab(std::size_t const capacity) {
+        std::size_t constexpr header_bytes{ (sizeof(slab) + alignof(node) - 1) / alignof(node) * alignof(node) };
+        std::size_t constexpr alignment{ std::max(alignof(slab), alignof(node)) };
+
+        std::byte *memory{ allocator.alloc(header_bytes + sizeof(node) * capacity, alignment) };
+        EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate linked_list slab." });
+
+        slab *const new_slab{ new(memory) slab{ slabs, capacity } };
+        slabs = new_slab;
+        cap += capacity;
+
+        //Chain the nodes onto the free list back to front so they're handed out in address order.
+        node *const slab_nodes{ new_slab->get_nodes() };
+        for(std::size_t i{ capacity }; i > 0; --i) {
+            node *const new_node{ new(&slab_nodes[i - 1]) node{} };
+            new_node->next = free_nodes;
+            free_nodes     = new_node;
+        }
+    }
+
+    template<typename T, allocator allocator_t>
+    void linked_list<T, allocator_t>::free_slabs() {
+        EMBER_CHECK(nodes.empty());
+
+        while(slabs != nullptr) {
+            slab *const to_free{ slabs };
+            slabs = to_free->next;
+
+            node *const slab_nodes{ to_free->get_nodes() };
+            for(std::size_t i{ 0 }; i < to_free->capacity; ++i) {
+                slab_nodes[i].~node();
+            }
+            to_free->~slab();
+
+            std::byte *memory{ reinterpret_cast<std::byte *>(to_free) };
+            allocator.free(memory);
+        }
+
+        free_nodes = nullptr;
+        cap        = 0;
+    }
+
+    template<typename T, allocator allocator_t>
+    T *linked_list<T, allocator_t>::get_item(node_type *link) noexcept {
+        return std::launder(reinterpret_cast<T *>(static_cast<node *>(link)->storage));
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::node *linked_list<T, allocator_t>::get_node(T const &item) noexcept {
+        //Items are constructed at the start of node_storage, which is the first base of node.
+        return static_cast<node *>(reinterpret_cast<node_storage *>(const_cast<T *>(&item)));
+    }
+
+    template<typename T, allocator allocator_t>
+    typename linked_list<T, allocator_t>::node *linked_list<T, allocator_t>::get_node(const_iterator position) noexcept {
+        return static_cast<node *>(position.node);
+    }
+}
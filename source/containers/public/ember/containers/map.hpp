@@ -1,8 +1,382 @@
 #pragma once
 
-#include <unordered_map>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <ember/memory/allocator.hpp>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define EMBER_INTERNAL_MAP_USE_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define EMBER_INTERNAL_MAP_USE_SSE2 0
+#endif
+
+namespace ember::inline containers::internal {
+    /**
+     * @brief Describes the state of a single slot in a map. Full slots store the lower 7 bits of their key's
+     * hash so the sign bit is only set for empty, deleted and the sentinel.
+     */
+    using control_byte = std::int8_t;
+
+    inline control_byte constexpr empty_control{ -128 };
+    inline control_byte constexpr deleted_control{ -2 };
+    inline control_byte constexpr sentinel_control{ -1 }; /**< Placed after the last slot so iterators know where to stop. */
+
+    inline std::size_t constexpr map_group_width{ 16 };
+
+    /**
+     * @brief A group of control bytes that can be matched against all at once.
+     * @details Each match returns a mask with a bit set for each slot in the group that matched.
+     */
+    class map_group {
+        //VARIABLES
+    private:
+#if EMBER_INTERNAL_MAP_USE_SSE2
+        __m128i control;
+#else
+        control_byte control[map_group_width];
+#endif
+
+        //FUNCTIONS
+    public:
+        map_group() = delete;
+        inline explicit map_group(control_byte const *const group_control);
+
+        map_group(map_group const &other)     = default;
+        map_group(map_group &&other) noexcept = default;
+
+        map_group &operator=(map_group const &other)     = default;
+        map_group &operator=(map_group &&other) noexcept = default;
+
+        ~map_group() = default;
+
+        inline std::uint32_t match(control_byte const hash) const;
+        inline std::uint32_t match_empty() const;
+        inline std::uint32_t match_empty_or_deleted() const;
+    };
+
+    template<typename value_t>
+    class map_iterator {
+        template<typename other_value_t>
+        friend class map_iterator;
+
+        //TYPES
+    public:
+        using iterator_category = std::forward_iterator_tag;
+
+        using value_type     = std::remove_const_t<value_t>;
+        using pointer_type   = value_t *;
+        using reference_type = value_t &;
+
+        using difference_type = std::ptrdiff_t;
+
+        //VARIABLES
+    private:
+        control_byte const *control{ nullptr };
+        pointer_type slot{ nullptr };
+
+        //FUNCTIONS
+    public:
+        map_iterator();
+        map_iterator(control_byte const *control, pointer_type slot);
+        /**
+         * @brief Allows an iterator to be converted into a const_iterator.
+         */
+        template<typename other_value_t>
+        map_iterator(map_iterator<other_value_t> const &other) requires std::same_as<value_t, other_value_t const>;
+
+        map_iterator(map_iterator const &other);
+        map_iterator(map_iterator &&other) noexcept;
+
+        map_iterator &operator=(map_iterator const &other);
+        map_iterator &operator=(map_iterator &&other) noexcept;
+
+        ~map_iterator();
+
+        pointer_type operator->() const;
+        reference_type operator*() const;
+
+        map_iterator &operator++();
+        map_iterator operator++(int);
+
+        template<typename value_t_1, typename value_t_2>
+        friend bool operator==(map_iterator<value_t_1> const &lhs, map_iterator<value_t_2> const &rhs) noexcept;
+        template<typename value_t_1, typename value_t_2>
+        friend bool operator!=(map_iterator<value_t_1> const &lhs, map_iterator<value_t_2> const &rhs) noexcept;
+
+    private:
+        /**
+         * @brief Moves forward until the iterator is at a full slot or the end of the map.
+         */
+        void skip_empty_slots();
+    };
+}
 
 namespace ember::inline containers {
-    template<typename key_type, typename value_type>
-    using map = std::unordered_map<key_type, value_type>;
-}
\ No newline at end of file
+    /**
+     * @brief Unordered associative container that stores it's items inline using open addressing.
+     * @details Items and a control byte per slot are kept in a single allocation. Slots are probed a group of 16 at
+     * a time (using SSE2 where available) and the control bytes hold 7 bits of each key's hash, so most keys that
+     * don't match are never compared. Unlike std::unordered_map, inserting can move items, invalidating any references,
+     * pointers or iterators into the map. Erasing only invalidates the erased item.
+     * @tparam key_t
+     * @tparam value_t
+     * @tparam hash_t
+     * @tparam key_equal_t
+     * @tparam allocator_t Allocator used for the map's memory.
+     */
+    template<typename key_t, typename value_t, typename hash_t = std::hash<key_t>, typename key_equal_t = std::equal_to<key_t>, allocator allocator_t = global_allocator_ref>
+    class map {
+        //TYPES
+    public:
+        using key_type             = key_t;
+        using mapped_type          = value_t;
+        using value_type           = std::pair<key_t const, value_t>;
+        using hasher               = hash_t;
+        using key_equal            = key_equal_t;
+        using allocator_type       = allocator_t;
+        using pointer_type         = value_type *;
+        using const_pointer_type   = value_type const *;
+        using reference_type       = value_type &;
+        using const_reference_type = value_type const &;
+
+        using iterator       = internal::map_iterator<value_type>;
+        using const_iterator = internal::map_iterator<value_type const>;
+
+    private:
+        static std::size_t constexpr group_width{ internal::map_group_width };
+        static std::size_t constexpr not_found{ static_cast<std::size_t>(-1) };
+
+        //VARIABLES
+    private:
+        std::byte *memory{ nullptr };                  /**< Holds the control bytes followed by the slots. */
+        internal::control_byte *control{ nullptr };    /**< One byte per slot, plus a sentinel. */
+        pointer_type slots{ nullptr };
+
+        std::size_t elems{ 0 };       /**< How many items are currently stored in this map. */
+        std::size_t cap{ 0 };         /**< Total number of slots. Always a power of two and a multiple of group_width. */
+        std::size_t growth_left{ 0 }; /**< How many empty slots can be filled before the map needs to grow. */
+
+        [[no_unique_address]] hash_t hash{};
+        [[no_unique_address]] key_equal_t equal{};
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the map's memory comes from. */
+
+        //FUNCTIONS
+    public:
+        map() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit map(allocator_t allocator) noexcept;
+        map(std::initializer_list<value_type> init) requires std::is_default_constructible_v<allocator_t>;
+
+        map(map const &other);
+        map(map &&other) noexcept;
+
+        map &operator=(map const &other);
+        map &operator=(map &&other) noexcept;
+
+        ~map();
+
+        /**
+         * @brief Inserts item if it's key is not already in the map.
+         * @param item
+         * @return An iterator to the item with item's key and true if the item was inserted.
+         */
+        std::pair<iterator, bool> insert(value_type const &item);
+        /**
+         * @overload insert(value_type const &item)
+         */
+        std::pair<iterator, bool> insert(value_type &&item);
+
+        /**
+         * @brief Constructs an item from args if it's key is not already in the map.
+         * @return An iterator to the item with the key and true if the item was inserted.
+         */
+        template<typename... args_t>
+        std::pair<iterator, bool> emplace(args_t &&...args);
+        /**
+         * @overload emplace(args_t &&...args)
+         */
+        template<typename key_arg_t, typename value_arg_t>
+        std::pair<iterator, bool> emplace(key_arg_t &&key, value_arg_t &&value);
+
+        /**
+         * @brief Constructs a value from args if key is not already in the map. Unlike emplace, nothing is
+         * constructed if key already exists.
+         * @return An iterator to the item with key and true if the item was inserted.
+         */
+        template<typename... args_t>
+        std::pair<iterator, bool> try_emplace(key_t const &key, args_t &&...args);
+        /**
+         * @overload try_emplace(key_t const &key, args_t &&...args)
+         */
+        template<typename... args_t>
+        std::pair<iterator, bool> try_emplace(key_t &&key, args_t &&...args);
+
+        /**
+         * @brief Erases the item with key if it exists.
+         * @param key
+         * @return How many items were erased.
+         */
+        std::size_t erase(key_t const &key);
+        /**
+         * @brief Erases the item at where.
+         * @param where
+         * @return An iterator to the item after where.
+         */
+        iterator erase(const_iterator where);
+
+        /**
+         * @brief Destructs every item in the map. The capacity of the map stays the same.
+         */
+        void clear();
+
+        /**
+         * @brief Makes sure count items can be held without the map needing to grow.
+         * @param count
+         */
+        void reserve(std::size_t const count);
+
+        /**
+         * @brief Returns the number of items.
+         * @return
+         */
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns the number of slots in currently allocated storage.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns true if this map contains no items.
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns an iterator to the item with key or end() if it doesn't exist.
+         * @param key
+         * @return
+         */
+        iterator find(key_t const &key);
+        /**
+         * @overload find(key_t const &key)
+         */
+        const_iterator find(key_t const &key) const;
+
+        bool contains(key_t const &key) const;
+        std::size_t count(key_t const &key) const;
+
+        /**
+         * @brief Returns the value of the item with key. Throws if key doesn't exist.
+         * @param key
+         * @return
+         */
+        value_t &at(key_t const &key);
+        /**
+         * @overload at(key_t const &key)
+         */
+        value_t const &at(key_t const &key) const;
+
+        /**
+         * @brief Returns an iterator to the beginning of this map.
+         * @return
+         */
+        iterator begin() noexcept;
+        /**
+         * @overload begin()
+         */
+        const_iterator begin() const noexcept;
+        /**
+         * @brief Returns an iterator to the end of this map.
+         * @return
+         */
+        iterator end() noexcept;
+        /**
+         * @overload end()
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns the allocator this map allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+        /**
+         * @brief Returns the value of the item with key, default constructing it if it doesn't exist.
+         * @param key
+         * @return
+         */
+        value_t &operator[](key_t const &key) requires std::is_default_constructible_v<value_t>;
+        /**
+         * @overload operator[](key_t const &key)
+         */
+        value_t &operator[](key_t &&key) requires std::is_default_constructible_v<value_t>;
+
+        template<typename key_t_1, typename value_t_1, typename hash_t_1, typename key_equal_t_1, typename allocator_t_1>
+        friend bool operator==(map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &lhs, map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &rhs);
+        template<typename key_t_1, typename value_t_1, typename hash_t_1, typename key_equal_t_1, typename allocator_t_1>
+        friend bool operator!=(map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &lhs, map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &rhs);
+
+    private:
+        /**
+         * @brief Hashes key, mixing the bits as std::hash is often the identity function for integers.
+         */
+        std::size_t hash_key(key_t const &key) const;
+        static inline internal::control_byte get_control_hash(std::size_t const hash_value);
+        static inline std::size_t get_first_group(std::size_t const hash_value);
+
+        std::size_t find_index(key_t const &key, std::size_t const hash_value) const;
+        /**
+         * @brief Finds the first empty or deleted slot along hash_value's probe sequence.
+         */
+        std::size_t find_insert_index(std::size_t const hash_value) const;
+
+        template<typename key_arg_t, typename... args_t>
+        std::pair<iterator, bool> emplace_key(key_arg_t &&key, args_t &&...args);
+        /**
+         * @brief Constructs an item from args without checking if it's key already exists.
+         */
+        template<typename... args_t>
+        std::size_t emplace_unique(std::size_t const hash_value, args_t &&...args);
+        /**
+         * @brief Returns the slot an item with hash_value should be inserted into, growing the map if it's full.
+         */
+        std::size_t prepare_insert(std::size_t const hash_value);
+        void commit_insert(std::size_t const index, std::size_t const hash_value);
+
+        void erase_at(std::size_t const index);
+
+        void rehash(std::size_t const new_capacity);
+        void allocate_table(std::size_t const capacity);
+        void free_table();
+        void destruct_items();
+
+        iterator make_iterator(std::size_t const index);
+        const_iterator make_iterator(std::size_t const index) const;
+
+        static inline std::size_t get_capacity_for(std::size_t const count);
+        static inline std::size_t get_max_load(std::size_t const capacity);
+    };
+}
+
+namespace std {
+    //Specialised iterator traits for certain std algorithms.
+    template<typename value_t>
+    struct iterator_traits<ember::containers::internal::map_iterator<value_t>> {
+        using iterator_category = typename ember::containers::internal::map_iterator<value_t>::iterator_category;
+
+        using value_type = typename ember::containers::internal::map_iterator<value_t>::value_type;
+        using pointer    = typename ember::containers::internal::map_iterator<value_t>::pointer_type;
+        using reference  = typename ember::containers::internal::map_iterator<value_t>::reference_type;
+
+        using difference_type = typename ember::containers::internal::map_iterator<value_t>::difference_type;
+    };
+}
+
+#include "map.inl"
@@ -0,0 +1,657 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <new>
+#include <tuple>
+
+namespace ember::inline containers {
+    namespace internal {
+        map_group::map_group(control_byte const *const group_control) {
+#if EMBER_INTERNAL_MAP_USE_SSE2
+            control = _mm_loadu_si128(reinterpret_cast<__m128i const *>(group_control));
+#else
+            std::memcpy(control, group_control, map_group_width);
+#endif
+        }
+
+        std::uint32_t map_group::match(control_byte const hash) const {
+#if EMBER_INTERNAL_MAP_USE_SSE2
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(hash))));
+#else
+            std::uint32_t mask{ 0 };
+            for(std::size_t i{ 0 }; i < map_group_width; ++i) {
+                mask |= static_cast<std::uint32_t>(control[i] == hash) << i;
+            }
+            return mask;
+#endif
+        }
+
+        std::uint32_t map_group::match_empty() const {
+            return match(empty_control);
+        }
+
+        std::uint32_t map_group::match_empty_or_deleted() const {
+#if EMBER_INTERNAL_MAP_USE_SSE2
+            //Empty and deleted are the only values less than the sentinel.
+            return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(sentinel_control), control)));
+#else
+            std::uint32_t mask{ 0 };
+            for(std::size_t i{ 0 }; i < map_group_width; ++i) {
+                mask |= static_cast<std::uint32_t>(control[i] < sentinel_control) << i;
+            }
+            return mask;
+#endif
+        }
+
+        template<typename value_t>
+        map_iterator<value_t>::map_iterator() = default;
+
+        template<typename value_t>
+        map_iterator<value_t>::map_iterator(control_byte const *control, pointer_type slot)
+            : control{ control }
+            , slot{ slot } {
+            skip_empty_slots();
+        }
+
+        template<typename value_t>
+        template<typename other_value_t>
+        map_iterator<value_t>::map_iterator(map_iterator<other_value_t> const &other) requires std::same_as<value_t, other_value_t const>
+            : control{ other.control }
+            , slot{ other.slot } {
+        }
+
+        template<typename value_t>
+        map_iterator<value_t>::map_iterator(map_iterator const &other) = default;
+
+        template<typename value_t>
+        map_iterator<value_t>::map_iterator(map_iterator &&other) noexcept = default;
+
+        template<typename value_t>
+        map_iterator<value_t> &map_iterator<value_t>::operator=(map_iterator const &other) = default;
+
+        template<typename value_t>
+        map_iterator<value_t> &map_iterator<value_t>::operator=(map_iterator &&other) noexcept = default;
+
+        template<typename value_t>
+        map_iterator<value_t>::~map_iterator() = default;
+
+        template<typename value_t>
+        typename map_iterator<value_t>::pointer_type map_iterator<value_t>::operator->() const {
+            EMBER_CHECK(control != nullptr && *control >= 0);
+            return slot;
+        }
+
+        template<typename value_t>
+        typename map_iterator<value_t>::reference_type map_iterator<value_t>::operator*() const {
+            EMBER_CHECK(control != nullptr && *control >= 0);
+            return *slot;
+        }
+
+        template<typename value_t>
+        map_iterator<value_t> &map_iterator<value_t>::operator++() {
+            EMBER_CHECK(control != nullptr && *control != sentinel_control);
+            ++control;
+            ++slot;
+            skip_empty_slots();
+            return *this;
+        }
+
+        template<typename value_t>
+        map_iterator<value_t> map_iterator<value_t>::operator++(int) {
+            map_iterator previous{ *this };
+            ++(*this);
+            return previous;
+        }
+
+        template<typename value_t_1, typename value_t_2>
+        bool operator==(map_iterator<value_t_1> const &lhs, map_iterator<value_t_2> const &rhs) noexcept {
+            return lhs.control == rhs.control;
+        }
+
+        template<typename value_t_1, typename value_t_2>
+        bool operator!=(map_iterator<value_t_1> const &lhs, map_iterator<value_t_2> const &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        template<typename value_t>
+        void map_iterator<value_t>::skip_empty_slots() {
+            if(control == nullptr) {
+                return;
+            }
+
+            while(*control < 0 && *control != sentinel_control) {
+                ++control;
+                ++slot;
+            }
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t>::map() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t>::map(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t>::map(std::initializer_list<value_type> init) requires std::is_default_constructible_v<allocator_t> {
+        reserve(init.size());
+        for(auto const &item : init) {
+            insert(item);
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t>::map(map const &other)
+        : hash{ other.hash }
+        , equal{ other.equal }
+        , allocator{ other.allocator } {
+        if(other.elems > 0) {
+            allocate_table(other.cap);
+            for(auto const &item : other) {
+                emplace_unique(hash_key(item.first), item);
+            }
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t>::map(map &&other) noexcept
+        : memory{ std::exchange(other.memory, nullptr) }
+        , control{ std::exchange(other.control, nullptr) }
+        , slots{ std::exchange(other.slots, nullptr) }
+        , elems{ std::exchange(other.elems, 0) }
+        , cap{ std::exchange(other.cap, 0) }
+        , growth_left{ std::exchange(other.growth_left, 0) }
+        , hash{ other.hash }
+        , equal{ other.equal }
+        , allocator{ other.allocator } {
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t> &map<key_t, value_t, hash_t, key_equal_t, allocator_t>::operator=(map const &other) {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+        hash  = other.hash;
+        equal = other.equal;
+
+        reserve(other.elems);
+        for(auto const &item : other) {
+            emplace_unique(hash_key(item.first), item);
+        }
+
+        return *this;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t> &map<key_t, value_t, hash_t, key_equal_t, allocator_t>::operator=(map &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        hash  = other.hash;
+        equal = other.equal;
+
+        //The memory can only be taken if it can be freed through this map's allocator.
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
+        }
+
+        if(can_take_memory) {
+            free_table();
+
+            memory      = std::exchange(other.memory, nullptr);
+            control     = std::exchange(other.control, nullptr);
+            slots       = std::exchange(other.slots, nullptr);
+            elems       = std::exchange(other.elems, 0);
+            cap         = std::exchange(other.cap, 0);
+            growth_left = std::exchange(other.growth_left, 0);
+        } else {
+            clear();
+            reserve(other.elems);
+            for(auto &item : other) {
+                emplace_unique(hash_key(item.first), item.first, std::move(item.second));
+            }
+            other.free_table();
+        }
+
+        return *this;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    map<key_t, value_t, hash_t, key_equal_t, allocator_t>::~map() {
+        free_table();
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::insert(value_type const &item) {
+        return emplace_key(item.first, item.second);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::insert(value_type &&item) {
+        return emplace_key(item.first, std::move(item.second));
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename... args_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::emplace(args_t &&...args) {
+        //The key isn't known until the item is constructed.
+        return insert(value_type{ std::forward<args_t>(args)... });
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename key_arg_t, typename value_arg_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::emplace(key_arg_t &&key, value_arg_t &&value) {
+        if constexpr(std::is_same_v<std::remove_cvref_t<key_arg_t>, key_t>) {
+            return emplace_key(std::forward<key_arg_t>(key), std::forward<value_arg_t>(value));
+        } else {
+            return emplace_key(key_t{ std::forward<key_arg_t>(key) }, std::forward<value_arg_t>(value));
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename... args_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::try_emplace(key_t const &key, args_t &&...args) {
+        return emplace_key(key, std::forward<args_t>(args)...);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename... args_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::try_emplace(key_t &&key, args_t &&...args) {
+        return emplace_key(std::move(key), std::forward<args_t>(args)...);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::erase(key_t const &key) {
+        std::size_t const index{ find_index(key, hash_key(key)) };
+        if(index == not_found) {
+            return 0;
+        }
+
+        erase_at(index);
+        return 1;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::erase(const_iterator where) {
+        EMBER_CHECK(where != end());
+
+        auto const index{ static_cast<std::size_t>(std::addressof(*where) - slots) };
+        erase_at(index);
+
+        //Erasing never moves items so the next full slot is still where it was.
+        return make_iterator(index);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::clear() {
+        if(cap == 0) {
+            return;
+        }
+
+        destruct_items();
+        std::memset(control, static_cast<unsigned char>(internal::empty_control), cap);
+
+        elems       = 0;
+        growth_left = get_max_load(cap);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::reserve(std::size_t const count) {
+        if(count > elems + growth_left) {
+            rehash(std::max(cap, get_capacity_for(count)));
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::size() const noexcept {
+        return elems;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::capacity() const noexcept {
+        return cap;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    bool map<key_t, value_t, hash_t, key_equal_t, allocator_t>::empty() const noexcept {
+        return elems == 0;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find(key_t const &key) {
+        std::size_t const index{ find_index(key, hash_key(key)) };
+        return index != not_found ? make_iterator(index) : end();
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::const_iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find(key_t const &key) const {
+        std::size_t const index{ find_index(key, hash_key(key)) };
+        return index != not_found ? make_iterator(index) : end();
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    bool map<key_t, value_t, hash_t, key_equal_t, allocator_t>::contains(key_t const &key) const {
+        return find_index(key, hash_key(key)) != not_found;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::count(key_t const &key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    value_t &map<key_t, value_t, hash_t, key_equal_t, allocator_t>::at(key_t const &key) {
+        std::size_t const index{ find_index(key, hash_key(key)) };
+        EMBER_THROW_IF_FAILED(index != not_found, exception{ "Key does not exist in map." });
+
+        return slots[index].second;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    value_t const &map<key_t, value_t, hash_t, key_equal_t, allocator_t>::at(key_t const &key) const {
+        std::size_t const index{ find_index(key, hash_key(key)) };
+        EMBER_THROW_IF_FAILED(index != not_found, exception{ "Key does not exist in map." });
+
+        return slots[index].second;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::begin() noexcept {
+        return iterator{ control, slots };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::const_iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::begin() const noexcept {
+        return const_iterator{ control, slots };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::end() noexcept {
+        return iterator{ control + cap, slots + cap };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::const_iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::end() const noexcept {
+        return const_iterator{ control + cap, slots + cap };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    allocator_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    value_t &map<key_t, value_t, hash_t, key_equal_t, allocator_t>::operator[](key_t const &key) requires std::is_default_constructible_v<value_t> {
+        return emplace_key(key).first->second;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    value_t &map<key_t, value_t, hash_t, key_equal_t, allocator_t>::operator[](key_t &&key) requires std::is_default_constructible_v<value_t> {
+        return emplace_key(std::move(key)).first->second;
+    }
+
+    template<typename key_t_1, typename value_t_1, typename hash_t_1, typename key_equal_t_1, typename allocator_t_1>
+    bool operator==(map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &lhs, map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &rhs) {
+        if(lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        for(auto const &[key, value] : lhs) {
+            auto const iter{ rhs.find(key) };
+            if(iter == rhs.end() || !(iter->second == value)) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    template<typename key_t_1, typename value_t_1, typename hash_t_1, typename key_equal_t_1, typename allocator_t_1>
+    bool operator!=(map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &lhs, map<key_t_1, value_t_1, hash_t_1, key_equal_t_1, allocator_t_1> const &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::hash_key(key_t const &key) const {
+        //Finaliser from MurmurHash3.
+        auto hash_value{ static_cast<std::uint64_t>(hash(key)) };
+        hash_value ^= hash_value >> 33;
+        hash_value *= 0xff51afd7ed558ccdull;
+        hash_value ^= hash_value >> 33;
+
+        return static_cast<std::size_t>(hash_value);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    internal::control_byte map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_control_hash(std::size_t const hash_value) {
+        return static_cast<internal::control_byte>(hash_value & 0x7f);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_first_group(std::size_t const hash_value) {
+        return hash_value >> 7;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find_index(key_t const &key, std::size_t const hash_value) const {
+        if(elems == 0) {
+            return not_found;
+        }
+
+        internal::control_byte const control_hash{ get_control_hash(hash_value) };
+        std::size_t const group_mask{ (cap / group_width) - 1 };
+
+        //Triangular probing visits every group exactly once when the group count is a power of two.
+        std::size_t group{ get_first_group(hash_value) & group_mask };
+        for(std::size_t probe{ 1 }; probe <= group_mask + 1; ++probe) {
+            std::size_t const group_start{ group * group_width };
+            internal::map_group const control_group{ control + group_start };
+
+            for(std::uint32_t matches{ control_group.match(control_hash) }; matches != 0; matches &= matches - 1) {
+                std::size_t const index{ group_start + static_cast<std::size_t>(std::countr_zero(matches)) };
+                if(equal(slots[index].first, key)) {
+                    return index;
+                }
+            }
+
+            //A key is always inserted into the first group along it's probe sequence with space so we can stop here.
+            if(control_group.match_empty() != 0) {
+                return not_found;
+            }
+
+            group = (group + probe) & group_mask;
+        }
+
+        return not_found;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::find_insert_index(std::size_t const hash_value) const {
+        std::size_t const group_mask{ (cap / group_width) - 1 };
+
+        std::size_t group{ get_first_group(hash_value) & group_mask };
+        for(std::size_t probe{ 1 };; ++probe) {
+            std::size_t const group_start{ group * group_width };
+            if(std::uint32_t const available{ internal::map_group{ control + group_start }.match_empty_or_deleted() }; available != 0) {
+                return group_start + static_cast<std::size_t>(std::countr_zero(available));
+            }
+
+            EMBER_CHECK_MSG(probe <= group_mask, "Map has no empty slots to insert into.");
+            group = (group + probe) & group_mask;
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename key_arg_t, typename... args_t>
+    std::pair<typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator, bool> map<key_t, value_t, hash_t, key_equal_t, allocator_t>::emplace_key(key_arg_t &&key, args_t &&...args) {
+        std::size_t const hash_value{ hash_key(key) };
+        if(std::size_t const index{ find_index(key, hash_value) }; index != not_found) {
+            return { make_iterator(index), false };
+        }
+
+        std::size_t const index{ prepare_insert(hash_value) };
+        new(&slots[index]) value_type{ std::piecewise_construct, std::forward_as_tuple(std::forward<key_arg_t>(key)), std::forward_as_tuple(std::forward<args_t>(args)...) };
+        commit_insert(index, hash_value);
+
+        return { make_iterator(index), true };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    template<typename... args_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::emplace_unique(std::size_t const hash_value, args_t &&...args) {
+        std::size_t const index{ prepare_insert(hash_value) };
+        new(&slots[index]) value_type{ std::forward<args_t>(args)... };
+        commit_insert(index, hash_value);
+
+        return index;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::prepare_insert(std::size_t const hash_value) {
+        if(growth_left == 0) {
+            if(cap == 0) {
+                rehash(group_width);
+            } else if(elems <= get_max_load(cap) / 2) {
+                //Mostly deleted slots so clearing them out is enough.
+                rehash(cap);
+            } else {
+                rehash(cap * 2);
+            }
+        }
+
+        return find_insert_index(hash_value);
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::commit_insert(std::size_t const index, std::size_t const hash_value) {
+        //Deleted slots were already counted against growth_left when they were filled.
+        if(control[index] == internal::empty_control) {
+            --growth_left;
+        }
+
+        control[index] = get_control_hash(hash_value);
+        ++elems;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::erase_at(std::size_t const index) {
+        EMBER_CHECK(index < cap && control[index] >= 0);
+
+        slots[index].~value_type();
+        --elems;
+
+        //Lookups stop at the first group with an empty slot so if this group already has one then no probe sequence
+        //continues past it and the slot can become empty. Otherwise it has to be marked as deleted.
+        std::size_t const group_start{ index & ~(group_width - 1) };
+        if(internal::map_group{ control + group_start }.match_empty() != 0) {
+            control[index] = internal::empty_control;
+            ++growth_left;
+        } else {
+            control[index] = internal::deleted_control;
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::rehash(std::size_t const new_capacity) {
+        std::byte *old_memory{ memory };
+        internal::control_byte *const old_control{ control };
+        pointer_type const old_slots{ slots };
+        std::size_t const old_capacity{ cap };
+
+        memory = nullptr;
+        allocate_table(new_capacity);
+
+        for(std::size_t i{ 0 }; i < old_capacity; ++i) {
+            if(old_control[i] >= 0) {
+                value_type &item{ old_slots[i] };
+
+                //The old slot is destroyed straight after so it's safe to move out of it's key.
+                std::size_t const index{ find_insert_index(hash_key(item.first)) };
+                new(&slots[index]) value_type{ std::move(const_cast<key_t &>(item.first)), std::move(item.second) };
+                control[index] = old_control[i];
+
+                item.~value_type();
+            }
+        }
+
+        if(old_memory != nullptr) {
+            allocator.free(old_memory);
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::allocate_table(std::size_t const capacity) {
+        EMBER_CHECK(memory == nullptr);
+        EMBER_CHECK(capacity >= group_width && std::has_single_bit(capacity));
+
+        //Control bytes go first with a sentinel on the end, followed by the slots.
+        std::size_t const slot_offset{ ((capacity + 1 + alignof(value_type) - 1) / alignof(value_type)) * alignof(value_type) };
+
+        memory = allocator.alloc(slot_offset + (sizeof(value_type) * capacity), alignof(value_type));
+        EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate map." });
+
+        control = reinterpret_cast<internal::control_byte *>(memory);
+        slots   = reinterpret_cast<pointer_type>(memory + slot_offset);
+
+        std::memset(control, static_cast<unsigned char>(internal::empty_control), capacity);
+        control[capacity] = internal::sentinel_control;
+
+        cap         = capacity;
+        growth_left = get_max_load(capacity) - elems;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::free_table() {
+        if(memory != nullptr) {
+            destruct_items();
+            allocator.free(memory);
+        }
+
+        memory      = nullptr;
+        control     = nullptr;
+        slots       = nullptr;
+        elems       = 0;
+        cap         = 0;
+        growth_left = 0;
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    void map<key_t, value_t, hash_t, key_equal_t, allocator_t>::destruct_items() {
+        if constexpr(!std::is_trivially_destructible_v<value_type>) {
+            for(std::size_t i{ 0 }; i < cap; ++i) {
+                if(control[i] >= 0) {
+                    slots[i].~value_type();
+                }
+            }
+        }
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::make_iterator(std::size_t const index) {
+        return iterator{ control + index, slots + index };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    typename map<key_t, value_t, hash_t, key_equal_t, allocator_t>::const_iterator map<key_t, value_t, hash_t, key_equal_t, allocator_t>::make_iterator(std::size_t const index) const {
+        return const_iterator{ control + index, slots + index };
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_capacity_for(std::size_t const count) {
+        //Keep the load factor at or below 7/8.
+        return std::bit_ceil(std::max(group_width, ((count * 8) + 6) / 7));
+    }
+
+    template<typename key_t, typename value_t, typename hash_t, typename key_equal_t, allocator allocator_t>
+    std::size_t map<key_t, value_t, hash_t, key_equal_t, allocator_t>::get_max_load(std::size_t const capacity) {
+        return capacity - (capacity / 8);
+    }
+}
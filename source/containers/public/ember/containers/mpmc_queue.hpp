@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/memory.hpp>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace ember::inline containers {
+    /**
+     * @brief Bounded lock-free queue that any number of threads can push to and pop from.
+     * @details Based on Dmitry Vyukov's bounded MPMC queue. Each cell holds a sequence number that tells
+     * producers and consumers whose turn it is to use it, so threads only contend on the single compare
+     * exchange that claims a position. Batch operations claim a run of cells with one compare exchange.
+     * Capacity is rounded up to a power of two.
+     * @tparam T
+     * @tparam allocator_t Allocator used for the ring buffer.
+     */
+    template<typename T, allocator allocator_t = global_allocator_ref>
+    class mpmc_queue {
+        //TYPES
+    public:
+        using value_type     = T;
+        using allocator_type = allocator_t;
+
+    private:
+        struct cell {
+            std::atomic<std::size_t> sequence{ 0 };   /**< Equals the position when free for a producer, position + 1 when ready for a consumer. */
+            alignas(T) std::byte storage[sizeof(T)]; /**< Storage for the item. Only constructed while the cell is ready for a consumer. */
+
+            T *get_item() noexcept;
+        };
+
+        //VARIABLES
+    private:
+        cell *cells{ nullptr }; /**< Ring buffer of capacity cells. */
+        std::size_t mask{ 0 };  /**< capacity - 1, used to wrap positions into the ring buffer. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the ring buffer is allocated from. */
+
+        alignas(cache_line_size) std::atomic<std::size_t> enqueue_position{ 0 }; /**< Next position producers will claim. */
+        alignas(cache_line_size) std::atomic<std::size_t> dequeue_position{ 0 }; /**< Next position consumers will claim. */
+
+        //FUNCTIONS
+    public:
+        /**
+         * @brief Creates a queue that can hold at least capacity items.
+         * @param capacity
+         */
+        explicit mpmc_queue(std::size_t const capacity) requires std::is_default_constructible_v<allocator_t>;
+        mpmc_queue(std::size_t const capacity, allocator_t allocator);
+
+        mpmc_queue(mpmc_queue const &other) = delete;
+        mpmc_queue(mpmc_queue &&other)      = delete;
+
+        mpmc_queue &operator=(mpmc_queue const &other) = delete;
+        mpmc_queue &operator=(mpmc_queue &&other)      = delete;
+
+        ~mpmc_queue();
+
+        /**
+         * @brief Constructs a new item at the back of the queue with args.
+         * @tparam args_t
+         * @param args
+         * @return Returns false if the queue is full.
+         */
+        template<typename... args_t>
+        bool try_emplace(args_t &&...args);
+
+        /**
+         * @brief Copies val onto the back of the queue.
+         * @param val
+         * @return Returns false if the queue is full.
+         */
+        bool try_push(T const &val);
+        /**
+         * @brief Moves val onto the back of the queue.
+         * @param val
+         * @return Returns false if the queue is full.
+         */
+        bool try_push(T &&val);
+        /**
+         * @brief Copies as many items from [begin, end) onto the back of the queue as there are consecutive
+         * free cells, claiming them all at once. Items pushed by one call stay in order.
+         * @param begin
+         * @param end
+         * @return Returns how many items were pushed.
+         */
+        template<typename iterator_type>
+        std::size_t try_push(iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Removes the item at the front of the queue.
+         * @return Returns an empty optional if the queue is empty.
+         */
+        std::optional<T> try_pop();
+        /**
+         * @brief Moves up to max_count consecutive ready items from the front of the queue into out.
+         * @param out Output iterator to write the items to.
+         * @param max_count
+         * @return Returns how many items were popped.
+         */
+        template<typename output_iterator_type>
+        std::size_t try_pop(output_iterator_type out, std::size_t const max_count);
+
+        /**
+         * @brief Returns an approximate number of items in the queue. Can be out of date as soon as it returns.
+         * @return
+         */
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns the maximum number of items the queue can hold.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns true if the queue appeared to contain no items. Same caveats as size().
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the allocator this queue allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+    private:
+        /**
+         * @brief Claims up to max_count consecutive cells from position. Cells are claimed when their sequence
+         * equals their position + sequence_offset.
+         * @return Returns the first claimed position and how many cells were claimed. Claims 0 cells if the first
+         * cell isn't ready.
+         */
+        std::pair<std::size_t, std::size_t> claim_cells(std::atomic<std::size_t> &position, std::size_t const sequence_offset, std::size_t const max_count);
+    };
+}
+
+#include "mpmc_queue.inl"
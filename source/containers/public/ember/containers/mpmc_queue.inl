@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <bit>
+#include <ember/core/exception.hpp>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace ember::inline containers {
+    template<typename T, allocator allocator_t>
+    T *mpmc_queue<T, allocator_t>::cell::get_item() noexcept {
+        return std::launder(reinterpret_cast<T *>(storage));
+    }
+
+    template<typename T, allocator allocator_t>
+    mpmc_queue<T, allocator_t>::mpmc_queue(std::size_t const capacity) requires std::is_default_constructible_v<allocator_t>
+        : mpmc_queue{ capacity, allocator_t{} } {
+    }
+
+    template<typename T, allocator allocator_t>
+    mpmc_queue<T, allocator_t>::mpmc_queue(std::size_t const capacity, allocator_t allocator)
+        : allocator{ std::move(allocator) } {
+        std::size_t const ring_capacity{ std::bit_ceil(std::max<std::size_t>(capacity, 1)) };
+
+        cells = reinterpret_cast<cell *>(this->allocator.alloc(sizeof(cell) * ring_capacity, alignof(cell)));
+        EMBER_THROW_IF_FAILED(cells != nullptr, exception{ "Failed to allocate mpmc_queue ring buffer." });
+
+        for(std::size_t i{ 0 }; i < ring_capacity; ++i) {
+            new(&cells[i]) cell{};
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        mask = ring_capacity - 1;
+    }
+
+    template<typename T, allocator allocator_t>
+    mpmc_queue<T, allocator_t>::~mpmc_queue() {
+        if constexpr(!std::is_trivially_destructible_v<T>) {
+            std::size_t const end{ enqueue_position.load(std::memory_order_acquire) };
+            for(std::size_t position{ dequeue_position.load(std::memory_order_relaxed) }; position != end; ++position) {
+                cells[position & mask].get_item()->~T();
+            }
+        }
+
+        for(std::size_t i{ 0 }; i < capacity(); ++i) {
+            cells[i].~cell();
+        }
+
+        std::byte *memory{ reinterpret_cast<std::byte *>(cells) };
+        allocator.free(memory);
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename... args_t>
+    bool mpmc_queue<T, allocator_t>::try_emplace(args_t &&...args) {
+        auto const [position, count]{ claim_cells(enqueue_position, 0, 1) };
+        if(count == 0) {
+            return false;
+        }
+
+        cell &target{ cells[position & mask] };
+        new(target.storage) T{ std::forward<args_t>(args)... };
+        target.sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template<typename T, allocator allocator_t>
+    bool mpmc_queue<T, allocator_t>::try_push(T const &val) {
+        return try_emplace(val);
+    }
+
+    template<typename T, allocator allocator_t>
+    bool mpmc_queue<T, allocator_t>::try_push(T &&val) {
+        return try_emplace(std::move(val));
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename iterator_type>
+    std::size_t mpmc_queue<T, allocator_t>::try_push(iterator_type begin, iterator_type end) {
+        std::size_t const requested_count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        if(requested_count == 0) {
+            return 0;
+        }
+
+        auto const [position, count]{ claim_cells(enqueue_position, 0, requested_count) };
+        for(std::size_t i{ 0 }; i < count; ++i, ++begin) {
+            cell &target{ cells[(position + i) & mask] };
+            new(target.storage) T(*begin);
+            target.sequence.store(position + i + 1, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::optional<T> mpmc_queue<T, allocator_t>::try_pop() {
+        auto const [position, count]{ claim_cells(dequeue_position, 1, 1) };
+        if(count == 0) {
+            return std::nullopt;
+        }
+
+        cell &source{ cells[position & mask] };
+        T *const item{ source.get_item() };
+
+        std::optional<T> result{ std::move(*item) };
+        item->~T();
+
+        //Hand the cell to the producer that will wrap around onto it.
+        source.sequence.store(position + mask + 1, std::memory_order_release);
+
+        return result;
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename output_iterator_type>
+    std::size_t mpmc_queue<T, allocator_t>::try_pop(output_iterator_type out, std::size_t const max_count) {
+        if(max_count == 0) {
+            return 0;
+        }
+
+        auto const [position, count]{ claim_cells(dequeue_position, 1, max_count) };
+        for(std::size_t i{ 0 }; i < count; ++i, ++out) {
+            cell &source{ cells[(position + i) & mask] };
+            T *const item{ source.get_item() };
+
+            *out = std::move(*item);
+            item->~T();
+
+            source.sequence.store(position + i + mask + 1, std::memory_order_release);
+        }
+
+        return count;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t mpmc_queue<T, allocator_t>::size() const noexcept {
+        std::size_t const dequeued{ dequeue_position.load(std::memory_order_relaxed) };
+        std::size_t const enqueued{ enqueue_position.load(std::memory_order_relaxed) };
+
+        //The positions are read separately so dequeue can briefly appear ahead of enqueue.
+        return enqueued > dequeued ? std::min(enqueued - dequeued, capacity()) : 0;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t mpmc_queue<T, allocator_t>::capacity() const noexcept {
+        return mask + 1;
+    }
+
+    template<typename T, allocator allocator_t>
+    bool mpmc_queue<T, allocator_t>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template<typename T, allocator allocator_t>
+    allocator_t mpmc_queue<T, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::pair<std::size_t, std::size_t> mpmc_queue<T, allocator_t>::claim_cells(std::atomic<std::size_t> &position, std::size_t const sequence_offset, std::size_t const max_count) {
+        std::size_t first{ position.load(std::memory_order_relaxed) };
+
+        for(;;) {
+            //Count how many consecutive cells are ready. A cell can only stop being ready once its position
+            //has been claimed, which would make the compare exchange below fail, so this can be done up front.
+            std::size_t count{ 0 };
+            bool stale{ false };
+            for(; count < max_count; ++count) {
+                std::size_t const expected{ first + count + sequence_offset };
+                std::size_t const sequence{ cells[(first + count) & mask].sequence.load(std::memory_order_acquire) };
+
+                if(sequence != expected) {
+                    //A sequence ahead of the one expected means another thread has claimed this position.
+                    stale = static_cast<std::ptrdiff_t>(sequence - expected) > 0;
+                    break;
+                }
+            }
+
+            if(count == 0 && !stale) {
+                return { first, 0 };//Full when producing, empty when consuming.
+            }
+
+            if(count > 0 && position.compare_exchange_weak(first, first + count, std::memory_order_relaxed)) {
+                return { first, count };
+            }
+
+            if(count == 0) {
+                first = position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+}
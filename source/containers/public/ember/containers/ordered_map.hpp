@@ -1,8 +1,8 @@
 #pragma once
 
-#include <map>
+#include <ember/containers/b_tree.hpp>
 
 namespace ember::inline containers {
-    template<typename key_type, typename value_type>
-    using ordered_map = std::map<key_type, value_type>;
+    template<typename key_type, typename value_type, typename compare_t = std::less<key_type>, allocator allocator_t = global_allocator_ref>
+    using ordered_map = b_tree<key_type, value_type, compare_t, allocator_t>;
 }
\ No newline at end of file
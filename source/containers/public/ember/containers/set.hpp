@@ -1,8 +1,8 @@
 #pragma once
 
-#include <set>
+#include <ember/containers/b_tree.hpp>
 
 namespace ember::inline containers {
-    template<typename key_type>
-    using set = std::set<key_type>;
+    template<typename key_type, typename compare_t = std::less<key_type>, allocator allocator_t = global_allocator_ref>
+    using set = b_tree<key_type, void, compare_t, allocator_t>;
 }
\ No newline at end of file
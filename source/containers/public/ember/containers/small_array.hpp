@@ -0,0 +1,275 @@
+#pragma once
+
+#include <cstddef>
+#include <ember/containers/array.hpp>
+#include <ember/memory/allocator.hpp>
+#include <initializer_list>
+#include <type_traits>
+
+namespace ember::inline containers {
+    /**
+     * @brief Dynamically sized contiguous array of type T that stores up to inline_capacity items inside
+     * itself before spilling over into memory from its allocator.
+     * @details Suited to short lived arrays that usually only hold a handful of items. Because the items
+     * can live inside the array, moving a small_array that hasn't spilled moves each item and pointers
+     * into it are invalidated. Copy constructing copies the allocator, assigning keeps the allocator the
+     * small_array was constructed with.
+     * @tparam T
+     * @tparam inline_capacity How many items can be stored before allocating.
+     * @tparam allocator_t Allocator used once the inline storage is full.
+     */
+    template<typename T, std::size_t inline_capacity, allocator allocator_t = global_allocator_ref>
+    class small_array {
+        static_assert(inline_capacity > 0, "small_array needs room for at least one inline item. Use array instead.");
+
+        //TYPES
+    public:
+        using value_type           = T;
+        using allocator_type       = allocator_t;
+        using pointer_type         = T *;
+        using const_pointer_type   = T const *;
+        using reference_type       = T &;
+        using const_reference_type = T const &;
+
+        using iterator       = internal::array_iterator<small_array<T, inline_capacity, allocator_t>>;
+        using const_iterator = internal::const_array_iterator<small_array<T, inline_capacity, allocator_t>>;
+
+        friend iterator;
+        friend const_iterator;
+
+        //VARIABLES
+    private:
+        std::byte *memory{ nullptr };                                          /**< Memory from the allocator. Null while the items are stored inline. */
+        pointer_type first{ reinterpret_cast<pointer_type>(inline_storage) }; /**< Points to the first item, either in inline_storage or memory. */
+
+        std::size_t elems{ 0 };             /**< How many items are currently stored in this array. */
+        std::size_t cap{ inline_capacity }; /**< Total capacity of the array. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the array's memory comes from once it spills. */
+
+        alignas(T) std::byte inline_storage[sizeof(T) * inline_capacity]; /**< Storage for the first inline_capacity items. */
+
+        //FUNCTIONS
+    public:
+        small_array() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit small_array(allocator_t allocator) noexcept;
+        explicit small_array(std::size_t const size) requires std::is_default_constructible_v<T> && std::is_default_constructible_v<allocator_t>;
+        small_array(std::size_t const size, allocator_t allocator) requires std::is_default_constructible_v<T>;
+        small_array(std::initializer_list<T> init) requires std::is_default_constructible_v<allocator_t>;
+        template<typename iterator_type>
+        small_array(iterator_type begin, iterator_type end) requires std::is_default_constructible_v<allocator_t>;
+
+        small_array(small_array const &other);
+        small_array(small_array &&other) noexcept;
+
+        small_array &operator=(small_array const &other);
+        small_array &operator=(small_array &&other) noexcept;
+
+        ~small_array();
+
+        /**
+         * @brief Copies val onto the end of the array.
+         * @param val
+         */
+        void push_back(const_reference_type val);
+
+        /**
+         * @brief Constructs a new item at the end of the array with args.
+         * @tparam args_t
+         * @param args
+         */
+        template<typename... args_t>
+        void emplace_back(args_t &&...args);
+
+        /**
+         * @brief Inserts copies of the items in [begin, end) before where. The range must not point into this array.
+         * @param where Where to insert the items. Can be end().
+         * @param begin
+         * @param end
+         * @return Returns an iterator to the first inserted item.
+         */
+        template<typename iterator_type>
+        iterator insert(iterator where, iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Copies the items in [begin, end) onto the end of the array.
+         * @param begin
+         * @param end
+         */
+        template<typename iterator_type>
+        void append(iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Replaces the contents of the array with copies of the items in [begin, end).
+         * @param begin
+         * @param end
+         */
+        template<typename iterator_type>
+        void assign(iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Removes an element from the end of this array
+         */
+        void pop_back();
+
+        /**
+         * @brief Erases an element from the array at the specified point.
+         * @param where Where to remove the element from.
+         * @return Returns an iterator after the removed element.
+         */
+        iterator erase(iterator where);
+        /**
+         * @brief Erases elements in the range [from, to).
+         * @param from Where to start erasing from (inclusive).
+         * @param to Where to erase to (exclusive).
+         * @return Returns an iterator after the last removed element.
+         */
+        iterator erase(iterator from, iterator to);
+
+        /**
+         * @brief Erases a specific value from the array.
+         * @param value
+         */
+        void erase(T const &value);
+
+        /**
+         * @brief Increases the capacity of the array to meet new_capacity. Does nothing if the
+         * capacity is already large enough.
+         * @param new_capacity
+         */
+        void reserve(std::size_t new_capacity);
+
+        /**
+         * @brief Changes the number of elements stored to size.
+         * @details If the current size of the array is greater than size then extra items will be destructed. If the
+         * current size of the array is less than size then extra items will be constructed on the end.
+         * @param size
+         * @param args List of arguments to pass to the constructor if required.
+         */
+        template<typename... args_t>
+        void resize(std::size_t const size, args_t &&...args);
+
+        /**
+         * @brief Clears all of the elements in the array. Memory that has been allocated is kept.
+         */
+        void clear();
+
+        /**
+         * @brief Returns the number of elements.
+         * @return
+         */
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns the number of elements that can be held in currently allocated storage.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns true if this array contains no elements.
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns true if the items are stored inside the array rather than in allocated memory.
+         * @return
+         */
+        bool is_inline() const noexcept;
+
+        /**
+         * @brief Returns the item at the front of the array.
+         * @return
+         */
+        reference_type front();
+        /**
+         * @overload front()
+         */
+        const_reference_type front() const;
+
+        /**
+         * @brief Returns the item at the end of the array.
+         * @return
+         */
+        reference_type back();
+        /**
+         * @overload back()
+         */
+        const_reference_type back() const;
+
+        /**
+         * @brief Direct access to the underlying array.
+         * @return
+         */
+        pointer_type data();
+        /**
+         * @overload data()
+         */
+        const_pointer_type data() const;
+
+        /**
+         * @brief Returns an iterator to the beginning of this array.
+         * @return
+         */
+        iterator begin() noexcept;
+        /**
+         * @overload begin()
+         */
+        const_iterator begin() const noexcept;
+        /**
+         * @brief Returns an iterator to the end of this array.
+         * @return
+         */
+        iterator end() noexcept;
+        /**
+         * @overload end()
+         */
+        const_iterator end() const noexcept;
+
+        /**
+         * @brief Returns the allocator this array allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+        reference_type operator[](std::size_t pos);
+        const_reference_type operator[](std::size_t pos) const;
+
+        template<typename T_1, std::size_t capacity_1, typename allocator_t_1, typename T_2, std::size_t capacity_2, typename allocator_t_2>
+        friend bool operator==(small_array<T_1, capacity_1, allocator_t_1> const &lhs, small_array<T_2, capacity_2, allocator_t_2> const &rhs);
+        template<typename T_1, std::size_t capacity_1, typename allocator_t_1, typename T_2, std::size_t capacity_2, typename allocator_t_2>
+        friend bool operator!=(small_array<T_1, capacity_1, allocator_t_1> const &lhs, small_array<T_2, capacity_2, allocator_t_2> const &rhs);
+
+    private:
+        pointer_type get_inline_items() noexcept;
+
+        void grow_to_fit(std::size_t const size);
+        void reallocate_array(std::size_t const new_capacity);
+
+        void destruct_items();
+        void free_memory();
+    };
+}
+
+namespace std {
+    //Specialised iterator traits for certain std algorithms.
+    template<typename T, std::size_t inline_capacity, typename allocator_t>
+    struct iterator_traits<ember::containers::internal::const_array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>> {
+        using iterator_category = typename ember::containers::internal::const_array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>::iterator_category;
+
+        using value_type = typename ember::containers::internal::const_array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>::value_type;
+
+        using difference_type = typename ember::containers::internal::const_array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>::difference_type;
+    };
+
+    template<typename T, std::size_t inline_capacity, typename allocator_t>
+    struct iterator_traits<ember::containers::internal::array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>> {
+        using iterator_category = typename ember::containers::internal::array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>::iterator_category;
+
+        using value_type = typename ember::containers::internal::array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>::value_type;
+
+        using difference_type = typename ember::containers::internal::array_iterator<ember::containers::small_array<T, inline_capacity, allocator_t>>::difference_type;
+    };
+}
+
+#include "small_array.inl"
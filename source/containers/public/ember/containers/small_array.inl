@@ -0,0 +1,388 @@
+#include <algorithm>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <ember/memory/memory.hpp>
+#include <utility>
+
+namespace ember::inline containers {
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array(std::size_t const size) requires std::is_default_constructible_v<T> && std::is_default_constructible_v<allocator_t> {
+        resize(size);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array(std::size_t const size, allocator_t allocator) requires std::is_default_constructible_v<T>
+        : allocator{ std::move(allocator) } {
+        resize(size);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array(std::initializer_list<T> init) requires std::is_default_constructible_v<allocator_t> {
+        append(init.begin(), init.end());
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    template<typename iterator_type>
+    small_array<T, inline_capacity, allocator_t>::small_array(iterator_type begin, iterator_type end) requires std::is_default_constructible_v<allocator_t> {
+        append(begin, end);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array(small_array const &other)
+        : allocator{ other.allocator } {
+        append(other.first, other.first + other.elems);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::small_array(small_array &&other) noexcept
+        : allocator{ other.allocator } {
+        if(other.memory != nullptr) {
+            memory = std::exchange(other.memory, nullptr);
+            first  = std::exchange(other.first, other.get_inline_items());
+            cap    = std::exchange(other.cap, inline_capacity);
+        } else {
+            internal::relocate_items(other.first, first, other.elems);
+        }
+        elems = std::exchange(other.elems, 0);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t> &small_array<T, inline_capacity, allocator_t>::operator=(small_array const &other) {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+        append(other.first, other.first + other.elems);
+
+        return *this;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t> &small_array<T, inline_capacity, allocator_t>::operator=(small_array &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+
+        //Allocated memory can only be taken if it can be freed through this array's allocator.
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
+        }
+
+        if(other.memory != nullptr && can_take_memory) {
+            free_memory();
+
+            memory = std::exchange(other.memory, nullptr);
+            first  = std::exchange(other.first, other.get_inline_items());
+            cap    = std::exchange(other.cap, inline_capacity);
+        } else {
+            grow_to_fit(other.elems);
+            internal::relocate_items(other.first, first, other.elems);
+            other.free_memory();
+        }
+        elems = std::exchange(other.elems, 0);
+
+        return *this;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::~small_array() {
+        destruct_items();
+        free_memory();
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::push_back(const_reference_type val) {
+        emplace_back(val);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    template<typename... args_t>
+    void small_array<T, inline_capacity, allocator_t>::emplace_back(args_t &&...args) {
+        grow_to_fit(elems + 1);
+        new(&first[elems++]) value_type{ std::forward<args_t>(args)... };
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    template<typename iterator_type>
+    small_array<T, inline_capacity, allocator_t>::iterator small_array<T, inline_capacity, allocator_t>::insert(iterator where, iterator_type begin, iterator_type end) {
+        EMBER_CHECK(where <= this->end());
+
+        std::size_t const index{ static_cast<std::size_t>(where - this->begin()) };
+        std::size_t const count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        if(count == 0) {
+            return this->begin() + index;
+        }
+
+        grow_to_fit(elems + count);
+
+        //Open up a gap for the new items then copy them into it.
+        internal::relocate_items(first + index, first + index + count, elems - index);
+        internal::copy_construct_items(begin, end, first + index);
+        elems += count;
+
+        return this->begin() + index;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    template<typename iterator_type>
+    void small_array<T, inline_capacity, allocator_t>::append(iterator_type begin, iterator_type end) {
+        std::size_t const count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        grow_to_fit(elems + count);
+
+        internal::copy_construct_items(begin, end, first + elems);
+        elems += count;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    template<typename iterator_type>
+    void small_array<T, inline_capacity, allocator_t>::assign(iterator_type begin, iterator_type end) {
+        clear();
+        append(begin, end);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::pop_back() {
+        if(elems > 0) {
+            first[elems - 1].~T();
+            --elems;
+        }
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::iterator small_array<T, inline_capacity, allocator_t>::erase(iterator where) {
+        return erase(where, where + 1);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::iterator small_array<T, inline_capacity, allocator_t>::erase(iterator from, iterator to) {
+        EMBER_CHECK(to <= end());
+
+        if(from == to) {
+            return to;
+        }
+
+        std::size_t const index{ static_cast<std::size_t>(from - begin()) };
+        std::size_t const count{ static_cast<std::size_t>(to - from) };
+
+        //Destruct the items we are going to remove then shift the rest of the array over them.
+        for(std::size_t i{ index }; i < index + count; ++i) {
+            first[i].~T();
+        }
+        internal::relocate_items(first + index + count, first + index, elems - (index + count));
+
+        elems -= count;
+
+        return begin() + index;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::erase(T const &value) {
+        erase(std::remove(begin(), end(), value), end());
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::reserve(std::size_t new_capacity) {
+        if(cap < new_capacity) {
+            reallocate_array(new_capacity);
+        }
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    template<typename... args_t>
+    void small_array<T, inline_capacity, allocator_t>::resize(std::size_t const size, args_t &&...args) {
+        reserve(size);
+
+        if(elems < size) {
+            //Grow the array
+            for(std::size_t i{ elems }; i < size; ++i) {
+                new(&first[i]) T{ std::forward<args_t>(args)... };
+            }
+        } else {
+            //Shrink the array
+            for(std::size_t i{ size }; i < elems; ++i) {
+                first[i].~T();
+            }
+        }
+        elems = size;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::clear() {
+        destruct_items();
+        elems = 0;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    std::size_t small_array<T, inline_capacity, allocator_t>::size() const noexcept {
+        return elems;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    std::size_t small_array<T, inline_capacity, allocator_t>::capacity() const noexcept {
+        return cap;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    bool small_array<T, inline_capacity, allocator_t>::empty() const noexcept {
+        return elems == 0;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    bool small_array<T, inline_capacity, allocator_t>::is_inline() const noexcept {
+        return memory == nullptr;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::reference_type small_array<T, inline_capacity, allocator_t>::front() {
+        EMBER_CHECK(elems > 0);
+        return *first;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::const_reference_type small_array<T, inline_capacity, allocator_t>::front() const {
+        EMBER_CHECK(elems > 0);
+        return *first;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::reference_type small_array<T, inline_capacity, allocator_t>::back() {
+        EMBER_CHECK(elems > 0);
+        return *(first + (elems - 1));
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::const_reference_type small_array<T, inline_capacity, allocator_t>::back() const {
+        EMBER_CHECK(elems > 0);
+        return *(first + (elems - 1));
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::pointer_type small_array<T, inline_capacity, allocator_t>::data() {
+        return first;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::const_pointer_type small_array<T, inline_capacity, allocator_t>::data() const {
+        return first;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::iterator small_array<T, inline_capacity, allocator_t>::begin() noexcept {
+        return iterator{ this, first };
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::const_iterator small_array<T, inline_capacity, allocator_t>::begin() const noexcept {
+        return const_iterator{ this, first };
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::iterator small_array<T, inline_capacity, allocator_t>::end() noexcept {
+        return iterator{ this, first + elems };
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::const_iterator small_array<T, inline_capacity, allocator_t>::end() const noexcept {
+        return const_iterator{ this, first + elems };
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    allocator_t small_array<T, inline_capacity, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::reference_type small_array<T, inline_capacity, allocator_t>::operator[](std::size_t pos) {
+        EMBER_CHECK(pos < elems);
+        return first[pos];
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::const_reference_type small_array<T, inline_capacity, allocator_t>::operator[](std::size_t pos) const {
+        EMBER_CHECK(pos < elems);
+        return first[pos];
+    }
+
+    template<typename T_1, std::size_t capacity_1, typename allocator_t_1, typename T_2, std::size_t capacity_2, typename allocator_t_2>
+    bool operator==(small_array<T_1, capacity_1, allocator_t_1> const &lhs, small_array<T_2, capacity_2, allocator_t_2> const &rhs) {
+        if(lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    template<typename T_1, std::size_t capacity_1, typename allocator_t_1, typename T_2, std::size_t capacity_2, typename allocator_t_2>
+    bool operator!=(small_array<T_1, capacity_1, allocator_t_1> const &lhs, small_array<T_2, capacity_2, allocator_t_2> const &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    small_array<T, inline_capacity, allocator_t>::pointer_type small_array<T, inline_capacity, allocator_t>::get_inline_items() noexcept {
+        return reinterpret_cast<pointer_type>(inline_storage);
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::grow_to_fit(std::size_t const size) {
+        if(cap < size) {
+            //Keep growing geometrically so repeated appends stay amortised.
+            reallocate_array(std::max(size, cap * 2));
+        }
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::reallocate_array(std::size_t const new_capacity) {
+        if constexpr(is_trivially_relocatable_v<T>) {
+            //Memory that has already spilled can be grown by the allocator, which can avoid the copy if it grows in place.
+            if(memory != nullptr) {
+                memory = memory::reallocate(allocator, memory, sizeof(value_type) * elems, sizeof(value_type) * new_capacity, alignof(value_type));
+                EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to reallocate small_array." });
+                first = reinterpret_cast<pointer_type>(memory);
+                cap   = new_capacity;
+
+                return;
+            }
+        }
+
+        std::byte *new_memory{ allocator.alloc(sizeof(value_type) * new_capacity, alignof(value_type)) };
+        EMBER_THROW_IF_FAILED(new_memory != nullptr, exception{ "Failed to allocate small_array." });
+        auto *new_first{ reinterpret_cast<pointer_type>(new_memory) };
+
+        internal::relocate_items(first, new_first, elems);
+        free_memory();
+
+        memory = new_memory;
+        first  = new_first;
+        cap    = new_capacity;
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::destruct_items() {
+        for(std::size_t i{ 0 }; i < elems; ++i) {
+            first[i].~T();
+        }
+    }
+
+    template<typename T, std::size_t inline_capacity, allocator allocator_t>
+    void small_array<T, inline_capacity, allocator_t>::free_memory() {
+        if(memory != nullptr) {
+            allocator.free(memory);
+
+            memory = nullptr;
+            first  = get_inline_items();
+            cap    = inline_capacity;
+        }
+    }
+}
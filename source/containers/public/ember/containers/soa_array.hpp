@@ -0,0 +1,387 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <ember/containers/array.hpp>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/memory.hpp>
+#include <iterator>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ember::inline containers {
+    /**
+     * @brief A run of consecutive items in a soa_array, passed to the function given to for_each_chunk.
+     * @details Each field's span always covers lanes items and starts on an address aligned to the chunk's
+     * size (up to a cache line), so loops over them can be vectorised without a scalar tail. The last chunk
+     * can include lanes past the end of the array. They hold unspecified values and writing to them has no
+     * effect on the array.
+     * @tparam lanes
+     * @tparam fields_t May be const.
+     */
+    template<std::size_t lanes, typename... fields_t>
+    class soa_chunk {
+        //VARIABLES
+    private:
+        std::tuple<fields_t *...> streams{}; /**< Start of this chunk in each field's stream. */
+        std::size_t first{ 0 };              /**< Index in the array of the chunk's first lane. */
+        std::size_t count{ 0 };              /**< How many lanes hold items in the array. */
+
+        //FUNCTIONS
+    public:
+        soa_chunk(std::tuple<fields_t *...> streams, std::size_t const first, std::size_t const count);
+
+        /**
+         * @brief Returns the lanes of field index.
+         * @return
+         */
+        template<std::size_t index>
+        std::span<std::tuple_element_t<index, std::tuple<fields_t...>>, lanes> get() const;
+
+        /**
+         * @brief Returns the index in the array of this chunk's first lane.
+         * @return
+         */
+        std::size_t get_first() const noexcept;
+        /**
+         * @brief Returns how many lanes hold items in the array. Only less than lanes for the last chunk.
+         * @return
+         */
+        std::size_t size() const noexcept;
+    };
+}
+
+namespace ember::inline containers::internal {
+    /**
+     * @brief Proxy reference to a single item in a soa_array. Refers to the item's value in each field's stream.
+     * @details Copying the proxy copies the references, assigning to it assigns through them. Supports
+     * structured bindings, which bind to the fields themselves.
+     */
+    template<typename... fields_t>
+    class soa_reference {
+        //TYPES
+    public:
+        using value_type = std::tuple<std::remove_const_t<fields_t>...>;
+
+        //VARIABLES
+    private:
+        std::tuple<fields_t &...> fields;
+
+        //FUNCTIONS
+    public:
+        explicit soa_reference(fields_t &...fields);
+        /**
+         * @brief Allows a reference to be converted into a const reference.
+         */
+        template<typename... other_fields_t>
+        soa_reference(soa_reference<other_fields_t...> const &other) requires(std::same_as<fields_t, other_fields_t const> && ...);
+
+        soa_reference(soa_reference const &other);
+
+        soa_reference &operator=(soa_reference const &other) requires(!std::is_const_v<fields_t> && ...);
+        soa_reference &operator=(value_type const &value) requires(!std::is_const_v<fields_t> && ...);
+        soa_reference &operator=(value_type &&value) requires(!std::is_const_v<fields_t> && ...);
+
+        ~soa_reference();
+
+        template<std::size_t index>
+        std::tuple_element_t<index, std::tuple<fields_t...>> &get() const noexcept;
+
+        operator value_type() const;
+
+        template<typename... fields_t_1, typename... fields_t_2>
+        friend bool operator==(soa_reference<fields_t_1...> const &lhs, soa_reference<fields_t_2...> const &rhs);
+        template<typename... fields_t_1, typename... fields_t_2>
+        friend bool operator!=(soa_reference<fields_t_1...> const &lhs, soa_reference<fields_t_2...> const &rhs);
+
+    private:
+        template<typename... other_fields_t>
+        friend class soa_reference;
+    };
+
+    template<typename array_t, typename reference_t>
+    class soa_iterator {
+        template<typename other_array_t, typename other_reference_t>
+        friend class soa_iterator;
+
+        //TYPES
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+
+        using value_type     = typename reference_t::value_type;
+        using reference_type = reference_t;
+
+        using difference_type = std::ptrdiff_t;
+
+        //VARIABLES
+    private:
+        array_t *array{ nullptr };
+        std::size_t index{ 0 };
+
+        //FUNCTIONS
+    public:
+        soa_iterator();
+        soa_iterator(array_t *array, std::size_t const index);
+        /**
+         * @brief Allows an iterator to be converted into a const_iterator.
+         */
+        template<typename other_array_t, typename other_reference_t>
+        soa_iterator(soa_iterator<other_array_t, other_reference_t> const &other) requires std::same_as<array_t, other_array_t const>;
+
+        soa_iterator(soa_iterator const &other);
+        soa_iterator(soa_iterator &&other) noexcept;
+
+        soa_iterator &operator=(soa_iterator const &other);
+        soa_iterator &operator=(soa_iterator &&other) noexcept;
+
+        ~soa_iterator();
+
+        reference_type operator*() const;
+        reference_type operator[](difference_type const offset) const;
+
+        soa_iterator &operator++();
+        soa_iterator operator++(int);
+        soa_iterator &operator--();
+        soa_iterator operator--(int);
+
+        soa_iterator &operator+=(difference_type const offset);
+        soa_iterator &operator-=(difference_type const offset);
+
+        /**
+         * @brief Returns the index of the item this iterator points to.
+         * @return
+         */
+        std::size_t get_index() const noexcept;
+
+        template<typename array_t_1, typename reference_t_1>
+        friend soa_iterator<array_t_1, reference_t_1> operator+(soa_iterator<array_t_1, reference_t_1> const &lhs, typename soa_iterator<array_t_1, reference_t_1>::difference_type const offset);
+        template<typename array_t_1, typename reference_t_1>
+        friend soa_iterator<array_t_1, reference_t_1> operator-(soa_iterator<array_t_1, reference_t_1> const &lhs, typename soa_iterator<array_t_1, reference_t_1>::difference_type const offset);
+        template<typename array_t_1, typename reference_t_1>
+        friend typename soa_iterator<array_t_1, reference_t_1>::difference_type operator-(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs);
+
+        template<typename array_t_1, typename reference_t_1>
+        friend bool operator==(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) noexcept;
+        template<typename array_t_1, typename reference_t_1>
+        friend bool operator!=(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) noexcept;
+        template<typename array_t_1, typename reference_t_1>
+        friend bool operator<(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) noexcept;
+    };
+}
+
+namespace ember::inline containers {
+    /**
+     * @brief Dynamically sized array that stores each field of its items in a separate contiguous stream.
+     * @details A structure of arrays keeps every value of a field next to each other, so loops that only touch
+     * a few fields only pull those fields into cache and can process several items per instruction. Each
+     * stream is cache line aligned and the capacity is always a multiple of max_lanes so for_each_chunk can
+     * hand out whole, aligned chunks. Items are accessed through proxy references that refer to the item's
+     * value in each stream.
+     * @tparam allocator_t Allocator used for the streams.
+     * @tparam fields_t Type of each field. Can't be const or a reference.
+     */
+    template<allocator allocator_t, typename... fields_t>
+    class basic_soa_array {
+        static_assert(sizeof...(fields_t) > 0, "soa_array needs at least one field.");
+        static_assert(((!std::is_const_v<fields_t> && !std::is_reference_v<fields_t>) && ...), "soa_array fields can't be const or references.");
+
+        //TYPES
+    public:
+        using value_type           = std::tuple<fields_t...>;
+        using allocator_type       = allocator_t;
+        using reference_type       = internal::soa_reference<fields_t...>;
+        using const_reference_type = internal::soa_reference<fields_t const...>;
+
+        using iterator       = internal::soa_iterator<basic_soa_array, reference_type>;
+        using const_iterator = internal::soa_iterator<basic_soa_array const, const_reference_type>;
+
+        template<std::size_t index>
+        using field_type = std::tuple_element_t<index, value_type>;
+
+        //VARIABLES
+    public:
+        static std::size_t constexpr max_lanes{ 16 };                    /**< Largest chunk for_each_chunk can hand out. */
+        static std::size_t constexpr stream_alignment{ cache_line_size }; /**< Alignment of the start of each stream. */
+
+    private:
+        std::byte *memory{ nullptr };        /**< Single allocation holding every stream. */
+        std::tuple<fields_t *...> streams{}; /**< Start of each field's stream inside memory. */
+
+        std::size_t elems{ 0 }; /**< How many items are currently stored. */
+        std::size_t cap{ 0 };   /**< How many items each stream has room for. Always a multiple of max_lanes. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the streams are allocated from. */
+
+        //FUNCTIONS
+    public:
+        basic_soa_array() noexcept requires std::is_default_constructible_v<allocator_t>;
+        explicit basic_soa_array(allocator_t allocator) noexcept;
+
+        basic_soa_array(basic_soa_array const &other);
+        basic_soa_array(basic_soa_array &&other) noexcept;
+
+        basic_soa_array &operator=(basic_soa_array const &other);
+        basic_soa_array &operator=(basic_soa_array &&other) noexcept;
+
+        ~basic_soa_array();
+
+        /**
+         * @brief Copies an item made up of values onto the end of the array.
+         * @param values One value for each field.
+         */
+        void push_back(fields_t const &...values);
+        /**
+         * @brief Copies value onto the end of the array.
+         * @param value
+         */
+        void push_back(value_type const &value);
+
+        /**
+         * @brief Constructs a new item on the end of the array, constructing each field from its matching arg.
+         * @tparam args_t
+         * @param args One argument for each field.
+         * @return Returns a reference to the new item.
+         */
+        template<typename... args_t>
+        reference_type emplace_back(args_t &&...args) requires(sizeof...(args_t) == sizeof...(fields_t));
+
+        /**
+         * @brief Removes the item at the end of the array.
+         */
+        void pop_back();
+
+        /**
+         * @brief Erases the item at index, moving every item after it down to keep them in order.
+         * @param index
+         */
+        void erase(std::size_t const index);
+        /**
+         * @brief Erases the item at index by moving the last item into its place. Doesn't keep the items in
+         * order but only touches one item in each stream.
+         * @param index
+         */
+        void swap_remove(std::size_t const index);
+
+        /**
+         * @brief Increases the capacity of the array to meet new_capacity. If the current capacity is already
+         * larger then this function does nothing.
+         * @param new_capacity
+         */
+        void reserve(std::size_t const new_capacity);
+
+        /**
+         * @brief Changes the number of items stored to size. Extra items are default constructed.
+         * @param size
+         */
+        void resize(std::size_t const size) requires(std::is_default_constructible_v<fields_t> && ...);
+
+        /**
+         * @brief Clears all of the items in the array.
+         */
+        void clear();
+
+        /**
+         * @brief Returns the values of field index for every item in the array.
+         * @tparam index
+         * @return
+         */
+        template<std::size_t index>
+        std::span<field_type<index>> get_field() noexcept;
+        template<std::size_t index>
+        std::span<field_type<index> const> get_field() const noexcept;
+
+        /**
+         * @brief Calls function with each consecutive chunk of lanes items, in order.
+         * @details Fields must be trivially copyable so the lanes past the end of the array can be handed out.
+         * Kernels vectorise best when each loop only writes to one stream, as the compiler cannot prove streams do not alias.
+         * @tparam lanes Must be a power of two no larger than max_lanes.
+         * @param function Invoked with a soa_chunk<lanes, fields_t...>.
+         */
+        template<std::size_t lanes, typename function_t>
+        void for_each_chunk(function_t &&function) requires(std::is_trivially_copyable_v<fields_t> && ...);
+        template<std::size_t lanes, typename function_t>
+        void for_each_chunk(function_t &&function) const requires(std::is_trivially_copyable_v<fields_t> && ...);
+
+        reference_type operator[](std::size_t const index);
+        const_reference_type operator[](std::size_t const index) const;
+
+        reference_type front();
+        const_reference_type front() const;
+
+        reference_type back();
+        const_reference_type back() const;
+
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept;
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the allocator this array allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+        iterator begin() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator cbegin() const noexcept;
+
+        iterator end() noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cend() const noexcept;
+
+        template<typename allocator_t_1, typename... fields_t_1>
+        friend bool operator==(basic_soa_array<allocator_t_1, fields_t_1...> const &lhs, basic_soa_array<allocator_t_1, fields_t_1...> const &rhs);
+        template<typename allocator_t_1, typename... fields_t_1>
+        friend bool operator!=(basic_soa_array<allocator_t_1, fields_t_1...> const &lhs, basic_soa_array<allocator_t_1, fields_t_1...> const &rhs);
+
+    private:
+        /**
+         * @brief Moves every item into a new allocation with room for new_capacity items.
+         */
+        void reallocate(std::size_t const new_capacity);
+        void grow_if_full();
+
+        void destruct_items();
+        void free_memory();
+
+        /**
+         * @brief Returns how many bytes a stream of field_t needs to hold capacity items, padded so the next stream
+         * starts on a stream_alignment boundary.
+         */
+        template<typename field_t>
+        static std::size_t get_stream_bytes(std::size_t const capacity);
+    };
+
+    /**
+     * @brief basic_soa_array using the global allocator.
+     */
+    template<typename... fields_t>
+    using soa_array = basic_soa_array<global_allocator_ref, fields_t...>;
+}
+
+namespace std {
+    //Lets structured bindings unpack soa references into their fields.
+    template<typename... fields_t>
+    struct tuple_size<ember::containers::internal::soa_reference<fields_t...>> : std::integral_constant<std::size_t, sizeof...(fields_t)> {};
+
+    template<std::size_t index, typename... fields_t>
+    struct tuple_element<index, ember::containers::internal::soa_reference<fields_t...>> {
+        using type = std::tuple_element_t<index, std::tuple<fields_t...>> &;
+    };
+
+    //Specialised iterator traits for certain std algorithms.
+    template<typename array_t, typename reference_t>
+    struct iterator_traits<ember::containers::internal::soa_iterator<array_t, reference_t>> {
+        using iterator_category = typename ember::containers::internal::soa_iterator<array_t, reference_t>::iterator_category;
+
+        using value_type = typename ember::containers::internal::soa_iterator<array_t, reference_t>::value_type;
+        using pointer    = void;
+        using reference  = typename ember::containers::internal::soa_iterator<array_t, reference_t>::reference_type;
+
+        using difference_type = typename ember::containers::internal::soa_iterator<array_t, reference_t>::difference_type;
+    };
+}
+
+#include "soa_array.inl"
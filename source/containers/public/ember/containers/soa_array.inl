@@ -0,0 +1,563 @@
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <memory>
+#include <new>
+
+namespace ember::inline containers {
+    template<std::size_t lanes, typename... fields_t>
+    soa_chunk<lanes, fields_t...>::soa_chunk(std::tuple<fields_t *...> streams, std::size_t const first, std::size_t const count)
+        : streams{ streams }
+        , first{ first }
+        , count{ count } {
+    }
+
+    template<std::size_t lanes, typename... fields_t>
+    template<std::size_t index>
+    std::span<std::tuple_element_t<index, std::tuple<fields_t...>>, lanes> soa_chunk<lanes, fields_t...>::get() const {
+        using field_t = std::tuple_element_t<index, std::tuple<fields_t...>>;
+
+        //Streams are cache line aligned, so each chunk is aligned to the largest power of two dividing it's size.
+        std::size_t constexpr chunk_bytes{ sizeof(field_t) * lanes };
+        std::size_t constexpr alignment{ std::min(chunk_bytes & (~chunk_bytes + 1), cache_line_size) };
+
+        return std::span<field_t, lanes>{ std::assume_aligned<alignment>(std::get<index>(streams)), lanes };
+    }
+
+    template<std::size_t lanes, typename... fields_t>
+    std::size_t soa_chunk<lanes, fields_t...>::get_first() const noexcept {
+        return first;
+    }
+
+    template<std::size_t lanes, typename... fields_t>
+    std::size_t soa_chunk<lanes, fields_t...>::size() const noexcept {
+        return count;
+    }
+
+    namespace internal {
+        template<typename... fields_t>
+        soa_reference<fields_t...>::soa_reference(fields_t &...fields)
+            : fields{ fields... } {
+        }
+
+        template<typename... fields_t>
+        template<typename... other_fields_t>
+        soa_reference<fields_t...>::soa_reference(soa_reference<other_fields_t...> const &other) requires(std::same_as<fields_t, other_fields_t const> && ...)
+            : fields{ other.fields } {
+        }
+
+        template<typename... fields_t>
+        soa_reference<fields_t...>::soa_reference(soa_reference const &other) = default;
+
+        template<typename... fields_t>
+        soa_reference<fields_t...> &soa_reference<fields_t...>::operator=(soa_reference const &other) requires(!std::is_const_v<fields_t> && ...) {
+            fields = other.fields;
+            return *this;
+        }
+
+        template<typename... fields_t>
+        soa_reference<fields_t...> &soa_reference<fields_t...>::operator=(value_type const &value) requires(!std::is_const_v<fields_t> && ...) {
+            fields = value;
+            return *this;
+        }
+
+        template<typename... fields_t>
+        soa_reference<fields_t...> &soa_reference<fields_t...>::operator=(value_type &&value) requires(!std::is_const_v<fields_t> && ...) {
+            fields = std::move(value);
+            return *this;
+        }
+
+        template<typename... fields_t>
+        soa_reference<fields_t...>::~soa_reference() = default;
+
+        template<typename... fields_t>
+        template<std::size_t index>
+        std::tuple_element_t<index, std::tuple<fields_t...>> &soa_reference<fields_t...>::get() const noexcept {
+            return std::get<index>(fields);
+        }
+
+        template<typename... fields_t>
+        soa_reference<fields_t...>::operator value_type() const {
+            return value_type{ fields };
+        }
+
+        template<typename... fields_t_1, typename... fields_t_2>
+        bool operator==(soa_reference<fields_t_1...> const &lhs, soa_reference<fields_t_2...> const &rhs) {
+            return lhs.fields == rhs.fields;
+        }
+
+        template<typename... fields_t_1, typename... fields_t_2>
+        bool operator!=(soa_reference<fields_t_1...> const &lhs, soa_reference<fields_t_2...> const &rhs) {
+            return !(lhs == rhs);
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t>::soa_iterator() = default;
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t>::soa_iterator(array_t *array, std::size_t const index)
+            : array{ array }
+            , index{ index } {
+        }
+
+        template<typename array_t, typename reference_t>
+        template<typename other_array_t, typename other_reference_t>
+        soa_iterator<array_t, reference_t>::soa_iterator(soa_iterator<other_array_t, other_reference_t> const &other) requires std::same_as<array_t, other_array_t const>
+            : array{ other.array }
+            , index{ other.index } {
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t>::soa_iterator(soa_iterator const &other) = default;
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t>::soa_iterator(soa_iterator &&other) noexcept = default;
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> &soa_iterator<array_t, reference_t>::operator=(soa_iterator const &other) = default;
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> &soa_iterator<array_t, reference_t>::operator=(soa_iterator &&other) noexcept = default;
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t>::~soa_iterator() = default;
+
+        template<typename array_t, typename reference_t>
+        typename soa_iterator<array_t, reference_t>::reference_type soa_iterator<array_t, reference_t>::operator*() const {
+            EMBER_CHECK(array != nullptr);
+            return (*array)[index];
+        }
+
+        template<typename array_t, typename reference_t>
+        typename soa_iterator<array_t, reference_t>::reference_type soa_iterator<array_t, reference_t>::operator[](difference_type const offset) const {
+            EMBER_CHECK(array != nullptr);
+            return (*array)[index + offset];
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> &soa_iterator<array_t, reference_t>::operator++() {
+            ++index;
+            return *this;
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> soa_iterator<array_t, reference_t>::operator++(int) {
+            soa_iterator previous{ *this };
+            ++index;
+            return previous;
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> &soa_iterator<array_t, reference_t>::operator--() {
+            --index;
+            return *this;
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> soa_iterator<array_t, reference_t>::operator--(int) {
+            soa_iterator previous{ *this };
+            --index;
+            return previous;
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> &soa_iterator<array_t, reference_t>::operator+=(difference_type const offset) {
+            index += offset;
+            return *this;
+        }
+
+        template<typename array_t, typename reference_t>
+        soa_iterator<array_t, reference_t> &soa_iterator<array_t, reference_t>::operator-=(difference_type const offset) {
+            index -= offset;
+            return *this;
+        }
+
+        template<typename array_t, typename reference_t>
+        std::size_t soa_iterator<array_t, reference_t>::get_index() const noexcept {
+            return index;
+        }
+
+        template<typename array_t_1, typename reference_t_1>
+        soa_iterator<array_t_1, reference_t_1> operator+(soa_iterator<array_t_1, reference_t_1> const &lhs, typename soa_iterator<array_t_1, reference_t_1>::difference_type const offset) {
+            return soa_iterator<array_t_1, reference_t_1>{ lhs.array, lhs.index + offset };
+        }
+
+        template<typename array_t_1, typename reference_t_1>
+        soa_iterator<array_t_1, reference_t_1> operator-(soa_iterator<array_t_1, reference_t_1> const &lhs, typename soa_iterator<array_t_1, reference_t_1>::difference_type const offset) {
+            return soa_iterator<array_t_1, reference_t_1>{ lhs.array, lhs.index - offset };
+        }
+
+        template<typename array_t_1, typename reference_t_1>
+        typename soa_iterator<array_t_1, reference_t_1>::difference_type operator-(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) {
+            return static_cast<typename soa_iterator<array_t_1, reference_t_1>::difference_type>(lhs.index) - static_cast<typename soa_iterator<array_t_1, reference_t_1>::difference_type>(rhs.index);
+        }
+
+        template<typename array_t_1, typename reference_t_1>
+        bool operator==(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) noexcept {
+            return lhs.array == rhs.array && lhs.index == rhs.index;
+        }
+
+        template<typename array_t_1, typename reference_t_1>
+        bool operator!=(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) noexcept {
+            return !(lhs == rhs);
+        }
+
+        template<typename array_t_1, typename reference_t_1>
+        bool operator<(soa_iterator<array_t_1, reference_t_1> const &lhs, soa_iterator<array_t_1, reference_t_1> const &rhs) noexcept {
+            return lhs.index < rhs.index;
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...>::basic_soa_array() noexcept requires std::is_default_constructible_v<allocator_t> = default;
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...>::basic_soa_array(allocator_t allocator) noexcept
+        : allocator{ std::move(allocator) } {
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...>::basic_soa_array(basic_soa_array const &other)
+        : allocator{ other.allocator } {
+        reserve(other.elems);
+
+        [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+            (internal::copy_construct_items(std::get<indices>(other.streams), std::get<indices>(other.streams) + other.elems, std::get<indices>(streams)), ...);
+        }(std::index_sequence_for<fields_t...>{});
+        elems = other.elems;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...>::basic_soa_array(basic_soa_array &&other) noexcept
+        : memory{ std::exchange(other.memory, nullptr) }
+        , streams{ std::exchange(other.streams, {}) }
+        , elems{ std::exchange(other.elems, 0) }
+        , cap{ std::exchange(other.cap, 0) }
+        , allocator{ std::move(other.allocator) } {
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...> &basic_soa_array<allocator_t, fields_t...>::operator=(basic_soa_array const &other) {
+        if(this == &other) {
+            return *this;
+        }
+
+        clear();
+        reserve(other.elems);
+
+        [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+            (internal::copy_construct_items(std::get<indices>(other.streams), std::get<indices>(other.streams) + other.elems, std::get<indices>(streams)), ...);
+        }(std::index_sequence_for<fields_t...>{});
+        elems = other.elems;
+
+        return *this;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...> &basic_soa_array<allocator_t, fields_t...>::operator=(basic_soa_array &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        bool can_take_memory{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_memory = allocator == other.allocator;
+        }
+
+        if(can_take_memory) {
+            destruct_items();
+            free_memory();
+
+            memory  = std::exchange(other.memory, nullptr);
+            streams = std::exchange(other.streams, {});
+            elems   = std::exchange(other.elems, 0);
+            cap     = std::exchange(other.cap, 0);
+        } else {
+            //Our allocator can't free other's memory, so move each item across instead.
+            clear();
+            reserve(other.elems);
+
+            [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+                (internal::relocate_items(std::get<indices>(other.streams), std::get<indices>(streams), other.elems), ...);
+            }(std::index_sequence_for<fields_t...>{});
+            elems = std::exchange(other.elems, 0);
+        }
+
+        return *this;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    basic_soa_array<allocator_t, fields_t...>::~basic_soa_array() {
+        destruct_items();
+        free_memory();
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::push_back(fields_t const &...values) {
+        emplace_back(values...);
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::push_back(value_type const &value) {
+        std::apply([&](fields_t const &...values) { emplace_back(values...); }, value);
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    template<typename... args_t>
+    typename basic_soa_array<allocator_t, fields_t...>::reference_type basic_soa_array<allocator_t, fields_t...>::emplace_back(args_t &&...args) requires(sizeof...(args_t) == sizeof...(fields_t)) {
+        grow_if_full();
+
+        [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+            (new(std::get<indices>(streams) + elems) field_type<indices>{ std::forward<args_t>(args) }, ...);
+        }(std::index_sequence_for<fields_t...>{});
+
+        return (*this)[elems++];
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::pop_back() {
+        EMBER_CHECK(!empty());
+
+        --elems;
+        std::apply([&](fields_t *...stream) { (std::destroy_at(stream + elems), ...); }, streams);
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::erase(std::size_t const index) {
+        EMBER_CHECK(index < elems);
+
+        std::apply([&](fields_t *...stream) {
+            ((std::destroy_at(stream + index), internal::relocate_items(stream + index + 1, stream + index, elems - index - 1)), ...);
+        },
+                   streams);
+        --elems;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::swap_remove(std::size_t const index) {
+        EMBER_CHECK(index < elems);
+
+        std::size_t const last{ elems - 1 };
+        std::apply([&](fields_t *...stream) {
+            ((std::destroy_at(stream + index), internal::relocate_items(stream + last, stream + index, index != last ? 1 : 0)), ...);
+        },
+                   streams);
+        --elems;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::reserve(std::size_t const new_capacity) {
+        if(new_capacity > cap) {
+            reallocate(new_capacity);
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::resize(std::size_t const size) requires(std::is_default_constructible_v<fields_t> && ...) {
+        while(elems > size) {
+            pop_back();
+        }
+
+        reserve(size);
+        for(; elems < size; ++elems) {
+            std::apply([&](fields_t *...stream) { (new(stream + elems) fields_t{}, ...); }, streams);
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::clear() {
+        destruct_items();
+        elems = 0;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    template<std::size_t index>
+    std::span<typename basic_soa_array<allocator_t, fields_t...>::template field_type<index>> basic_soa_array<allocator_t, fields_t...>::get_field() noexcept {
+        return { std::get<index>(streams), elems };
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    template<std::size_t index>
+    std::span<typename basic_soa_array<allocator_t, fields_t...>::template field_type<index> const> basic_soa_array<allocator_t, fields_t...>::get_field() const noexcept {
+        return { std::get<index>(streams), elems };
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    template<std::size_t lanes, typename function_t>
+    void basic_soa_array<allocator_t, fields_t...>::for_each_chunk(function_t &&function) requires(std::is_trivially_copyable_v<fields_t> && ...) {
+        static_assert(std::has_single_bit(lanes) && lanes <= max_lanes, "Chunks must be a power of two lanes no larger than max_lanes.");
+
+        for(std::size_t first{ 0 }; first < elems; first += lanes) {
+            auto const chunk_streams{ std::apply([&](fields_t *...stream) { return std::tuple<fields_t *...>{ (stream + first)... }; }, streams) };
+            function(soa_chunk<lanes, fields_t...>{ chunk_streams, first, std::min(lanes, elems - first) });
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    template<std::size_t lanes, typename function_t>
+    void basic_soa_array<allocator_t, fields_t...>::for_each_chunk(function_t &&function) const requires(std::is_trivially_copyable_v<fields_t> && ...) {
+        static_assert(std::has_single_bit(lanes) && lanes <= max_lanes, "Chunks must be a power of two lanes no larger than max_lanes.");
+
+        for(std::size_t first{ 0 }; first < elems; first += lanes) {
+            auto const chunk_streams{ std::apply([&](fields_t *...stream) { return std::tuple<fields_t const *...>{ (stream + first)... }; }, streams) };
+            function(soa_chunk<lanes, fields_t const...>{ chunk_streams, first, std::min(lanes, elems - first) });
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::reference_type basic_soa_array<allocator_t, fields_t...>::operator[](std::size_t const index) {
+        EMBER_CHECK(index < elems);
+        return std::apply([&](fields_t *...stream) { return reference_type{ stream[index]... }; }, streams);
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_reference_type basic_soa_array<allocator_t, fields_t...>::operator[](std::size_t const index) const {
+        EMBER_CHECK(index < elems);
+        return std::apply([&](fields_t *...stream) { return const_reference_type{ stream[index]... }; }, streams);
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::reference_type basic_soa_array<allocator_t, fields_t...>::front() {
+        return (*this)[0];
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_reference_type basic_soa_array<allocator_t, fields_t...>::front() const {
+        return (*this)[0];
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::reference_type basic_soa_array<allocator_t, fields_t...>::back() {
+        return (*this)[elems - 1];
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_reference_type basic_soa_array<allocator_t, fields_t...>::back() const {
+        return (*this)[elems - 1];
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    std::size_t basic_soa_array<allocator_t, fields_t...>::size() const noexcept {
+        return elems;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    std::size_t basic_soa_array<allocator_t, fields_t...>::capacity() const noexcept {
+        return cap;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    bool basic_soa_array<allocator_t, fields_t...>::empty() const noexcept {
+        return elems == 0;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    allocator_t basic_soa_array<allocator_t, fields_t...>::get_allocator() const {
+        return allocator;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::iterator basic_soa_array<allocator_t, fields_t...>::begin() noexcept {
+        return iterator{ this, 0 };
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_iterator basic_soa_array<allocator_t, fields_t...>::begin() const noexcept {
+        return const_iterator{ this, 0 };
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_iterator basic_soa_array<allocator_t, fields_t...>::cbegin() const noexcept {
+        return begin();
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::iterator basic_soa_array<allocator_t, fields_t...>::end() noexcept {
+        return iterator{ this, elems };
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_iterator basic_soa_array<allocator_t, fields_t...>::end() const noexcept {
+        return const_iterator{ this, elems };
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    typename basic_soa_array<allocator_t, fields_t...>::const_iterator basic_soa_array<allocator_t, fields_t...>::cend() const noexcept {
+        return end();
+    }
+
+    template<typename allocator_t_1, typename... fields_t_1>
+    bool operator==(basic_soa_array<allocator_t_1, fields_t_1...> const &lhs, basic_soa_array<allocator_t_1, fields_t_1...> const &rhs) {
+        if(lhs.size() != rhs.size()) {
+            return false;
+        }
+
+        return [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+            return (std::ranges::equal(lhs.template get_field<indices>(), rhs.template get_field<indices>()) && ...);
+        }(std::index_sequence_for<fields_t_1...>{});
+    }
+
+    template<typename allocator_t_1, typename... fields_t_1>
+    bool operator!=(basic_soa_array<allocator_t_1, fields_t_1...> const &lhs, basic_soa_array<allocator_t_1, fields_t_1...> const &rhs) {
+        return !(lhs == rhs);
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::reallocate(std::size_t const new_capacity) {
+        //Rounding up to whole chunks means for_each_chunk never hands out lanes past the end of a stream.
+        std::size_t const padded_capacity{ (new_capacity + max_lanes - 1) / max_lanes * max_lanes };
+        std::size_t const bytes{ (get_stream_bytes<fields_t>(padded_capacity) + ...) };
+        std::size_t constexpr alignment{ std::max({ stream_alignment, alignof(fields_t)... }) };
+
+        std::byte *new_memory{ allocator.alloc(bytes, alignment) };
+        EMBER_THROW_IF_FAILED(new_memory != nullptr, exception{ "Failed to allocate soa_array streams." });
+
+        if constexpr((std::is_trivially_copyable_v<fields_t> && ...)) {
+            //Gives the padding lanes handed out by for_each_chunk defined values.
+            std::memset(new_memory, 0, bytes);
+        }
+
+        std::tuple<fields_t *...> new_streams{};
+        std::size_t offset{ 0 };
+        [&]<std::size_t... indices>(std::index_sequence<indices...>) {
+            ((std::get<indices>(new_streams) = reinterpret_cast<field_type<indices> *>(new_memory + offset), offset += get_stream_bytes<field_type<indices>>(padded_capacity)), ...);
+            (internal::relocate_items(std::get<indices>(streams), std::get<indices>(new_streams), elems), ...);
+        }(std::index_sequence_for<fields_t...>{});
+
+        free_memory();
+
+        memory  = new_memory;
+        streams = new_streams;
+        cap     = padded_capacity;
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::grow_if_full() {
+        if(elems == cap) {
+            reallocate(std::max(max_lanes, cap * 2));
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::destruct_items() {
+        if constexpr(!(std::is_trivially_destructible_v<fields_t> && ...)) {
+            std::apply([&](fields_t *...stream) { (std::destroy(stream, stream + elems), ...); }, streams);
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    void basic_soa_array<allocator_t, fields_t...>::free_memory() {
+        if(memory != nullptr) {
+            allocator.free(memory);
+            memory = nullptr;
+        }
+    }
+
+    template<allocator allocator_t, typename... fields_t>
+    template<typename field_t>
+    std::size_t basic_soa_array<allocator_t, fields_t...>::get_stream_bytes(std::size_t const capacity) {
+        return (sizeof(field_t) * capacity + stream_alignment - 1) / stream_alignment * stream_alignment;
+    }
+}
@@ -2,6 +2,8 @@
 
 #include "ember/containers/array.hpp"
 
+#include <cstdint>
+
 namespace ember::inline containers {
     template<typename T>
     concept integral_t = std::is_integral_v<T>;
@@ -12,21 +14,26 @@ namespace ember::inline containers {
     /**
      * @brief A sparse set allows for O(1) insertion/deletion/look up while also mainting an
      * O(n) iteration time.
+     * @details Keys are mapped to items through fixed size pages that are only allocated when a key
+     * inside them is used and are freed once they're empty. This keeps memory proportional to the
+     * number of live keys rather than the value of the largest key.
      * @tparam key_type Used to look up objects. Must be an integral type.
      * @tparam value_type 
+     * @tparam allocator_t Allocator used for the set's internal arrays.
      */
-    template<integral_t key_t, moveable_t value_t>
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t = global_allocator_ref>
     class sparse_set {
         //TYPES
     public:
         using value_type           = value_t;
+        using allocator_type       = allocator_t;
         using pointer_type         = value_type *;
         using const_pointer_type   = value_type const *;
         using reference_type       = value_type &;
         using const_reference_type = value_type const &;
 
-        using sparse_array_type = array<std::size_t>;
-        using dense_array_type  = array<value_type>;//Store the key/value pair here so we can index back into the sparse array
+        using index_type       = std::uint32_t;//Limits a set to ~4 billion items but halves the size of each page.
+        using dense_array_type = array<value_type, allocator_t>;
 
         using iterator       = typename dense_array_type::iterator;
         using const_iterator = typename dense_array_type::const_iterator;
@@ -35,19 +42,31 @@ namespace ember::inline containers {
         friend const_iterator;
 
     private:
-        using index_to_key_array_type = array<key_t>;
+        struct sparse_page {
+            index_type *indices{ nullptr }; /**< Maps each key in the page to an index in item_array. Null if the page hasn't been allocated. */
+            std::size_t live_keys{ 0 };     /**< How many keys in this page are in the set. The page is freed when this reaches 0. */
+        };
+
+        using sparse_array_type       = array<sparse_page, allocator_t>;
+        using index_to_key_array_type = array<key_t, allocator_t>;
 
         //VARIABLES
+    public:
+        static std::size_t constexpr page_size{ 256 }; /**< How many keys each page covers. */
+
     private:
-        static std::size_t constexpr invalid_index{ ~0u };
+        static index_type constexpr invalid_index{ ~index_type{ 0 } };
 
-        sparse_array_type key_to_index{};       /**< Sparse array that maps key_t into an index in item_array. */
+        sparse_array_type key_to_index{};       /**< Pages that map key_t into an index in item_array. */
         dense_array_type item_array{};          /**< Densely packed contiguous container of value_type. */
-        index_to_key_array_type index_to_key{}; /**< A second sprase array that maps and index back into a key_t. */
+        index_to_key_array_type index_to_key{}; /**< Maps an index in item_array back into a key_t. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the pages are allocated from. */
 
         //FUNCTIONS
     public:
-        sparse_set();
+        sparse_set() requires std::is_default_constructible_v<allocator_t>;
+        explicit sparse_set(allocator_t allocator);
 
         sparse_set(sparse_set const &other);
         sparse_set(sparse_set &&other) noexcept;
@@ -67,6 +86,17 @@ namespace ember::inline containers {
         template<typename... args_t>
         void emplace(key_t key, args_t &&...args);
 
+        /**
+         * @brief Emplaces a copy of each item in [values_begin, values_begin + count) at the key in the same
+         * position of [keys_begin, keys_end). Faster than emplacing each item individually.
+         * @details keys must be sorted in ascending order so that each page is only looked up once.
+         * @param keys_begin 
+         * @param keys_end 
+         * @param values_begin 
+         */
+        template<typename key_iterator_t, typename value_iterator_t>
+        void emplace_sorted(key_iterator_t keys_begin, key_iterator_t keys_end, value_iterator_t values_begin);
+
         /**
          * @brief Erases the item at key.
          * @param key 
@@ -74,10 +104,25 @@ namespace ember::inline containers {
         void erase(key_t key);
 
         /**
-         * @brief Clears all of the elements in the set
+         * @brief Erases the item at each key in [keys_begin, keys_end). Keys that aren't in the set are ignored.
+         * @details keys must be sorted in ascending order so that each page is only looked up once.
+         * @param keys_begin 
+         * @param keys_end 
+         */
+        template<typename key_iterator_t>
+        void erase_sorted(key_iterator_t keys_begin, key_iterator_t keys_end);
+
+        /**
+         * @brief Clears all of the elements in the set and frees all of the pages.
          */
         void clear();
 
+        /**
+         * @brief Reserves memory for at least capacity items. Pages are still allocated on demand.
+         * @param capacity 
+         */
+        void reserve(std::size_t const capacity);
+
         /**
          * @brief Returns the number of elements.
          * @return 
@@ -91,6 +136,12 @@ namespace ember::inline containers {
          */
         bool contains(key_t key) const noexcept;
 
+        /**
+         * @brief Returns the allocator this set allocates it's memory from.
+         * @return 
+         */
+        allocator_t get_allocator() const;
+
         /**
          * @brief Returns an iterator to the beginning of this set.
          * @return 
@@ -117,6 +168,31 @@ namespace ember::inline containers {
          * @return 
          */
         reference_type operator[](key_t key);
+
+    private:
+        static std::size_t get_page_index(key_t const key);
+        static std::size_t get_page_offset(key_t const key);
+
+        index_type *find_index(key_t const key);
+        index_type const *find_index(key_t const key) const;
+
+        /**
+         * @brief Returns the page key lives in, allocating it if it doesn't exist yet.
+         */
+        sparse_page &get_or_allocate_page(key_t const key);
+
+        /**
+         * @brief Swaps the item at index with the last item and removes it. Leaves the removed key's page untouched.
+         */
+        void remove_item(index_type const index);
+
+        /**
+         * @brief Frees the page if there are no more keys in it.
+         */
+        void release_page_key(sparse_page &page);
+
+        void copy_pages(sparse_array_type const &other_pages);
+        void free_pages();
     };
 }
 
@@ -1,103 +1,354 @@
+#include <algorithm>
+#include <cstring>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <iterator>
+#include <new>
+
 namespace ember::inline containers {
-    template<integral_t key_t, moveable_t value_t>
-    sparse_set<key_t, value_t>::sparse_set() = default;
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t>::sparse_set() requires std::is_default_constructible_v<allocator_t> = default;
 
-    template<integral_t key_t, moveable_t value_t>
-    sparse_set<key_t, value_t>::sparse_set(sparse_set const &other) = default;
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t>::sparse_set(allocator_t allocator)
+        : key_to_index{ allocator }
+        , item_array{ allocator }
+        , index_to_key{ allocator }
+        , allocator{ std::move(allocator) } {
+    }
 
-    template<integral_t key_t, moveable_t value_t>
-    sparse_set<key_t, value_t>::sparse_set(sparse_set &&other) noexcept = default;
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t>::sparse_set(sparse_set const &other)
+        : key_to_index{ other.allocator }
+        , item_array{ other.item_array }
+        , index_to_key{ other.index_to_key }
+        , allocator{ other.allocator } {
+        copy_pages(other.key_to_index);
+    }
 
-    template<integral_t key_t, moveable_t value_t>
-    sparse_set<key_t, value_t> &sparse_set<key_t, value_t>::operator=(sparse_set const &other) = default;
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t>::sparse_set(sparse_set &&other) noexcept
+        : key_to_index{ std::move(other.key_to_index) }
+        , item_array{ std::move(other.item_array) }
+        , index_to_key{ std::move(other.index_to_key) }
+        , allocator{ other.allocator } {
+    }
 
-    template<integral_t key_t, moveable_t value_t>
-    sparse_set<key_t, value_t> &sparse_set<key_t, value_t>::operator=(sparse_set &&other) noexcept = default;
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t> &sparse_set<key_t, value_t, allocator_t>::operator=(sparse_set const &other) {
+        if(this == &other) {
+            return *this;
+        }
 
-    template<integral_t key_t, moveable_t value_t>
-    sparse_set<key_t, value_t>::~sparse_set() = default;
+        free_pages();
+        copy_pages(other.key_to_index);
 
-    template<integral_t key_t, moveable_t value_t>
-    template<typename... args_t>
-    void sparse_set<key_t, value_t>::emplace(key_t key, args_t &&...args) {
-        if(key_to_index.size() <= key) {
-            key_to_index.resize(key + 1, invalid_index);
+        item_array   = other.item_array;
+        index_to_key = other.index_to_key;
+
+        return *this;
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t> &sparse_set<key_t, value_t, allocator_t>::operator=(sparse_set &&other) noexcept {
+        if(this == &other) {
+            return *this;
+        }
+
+        free_pages();
+
+        //The pages can only be taken if they can be freed through this set's allocator.
+        bool can_take_pages{ std::is_empty_v<allocator_t> };
+        if constexpr(!std::is_empty_v<allocator_t> && std::equality_comparable<allocator_t>) {
+            can_take_pages = allocator == other.allocator;
         }
 
+        if(can_take_pages) {
+            key_to_index = std::move(other.key_to_index);
+        } else {
+            copy_pages(other.key_to_index);
+            other.free_pages();
+        }
+
+        item_array   = std::move(other.item_array);
+        index_to_key = std::move(other.index_to_key);
+
+        return *this;
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    sparse_set<key_t, value_t, allocator_t>::~sparse_set() {
+        free_pages();
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    template<typename... args_t>
+    void sparse_set<key_t, value_t, allocator_t>::emplace(key_t key, args_t &&...args) {
         //We always erase here to avoid situations where an assignment operator might be deleted if we do
         //item_array[key_to_index[key]] = value_type{ std::forward<args_t>(args)... };
         //When a key already exists.
         erase(key);
         EMBER_CHECK(!contains(key));
+        EMBER_CHECK(item_array.size() < invalid_index);
 
         item_array.emplace_back(value_type{ std::forward<args_t>(args)... });
         index_to_key.push_back(key);
-        key_to_index[key] = item_array.size() - 1;
+
+        sparse_page &page{ get_or_allocate_page(key) };
+        page.indices[get_page_offset(key)] = static_cast<index_type>(item_array.size() - 1);
+        ++page.live_keys;
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    void sparse_set<key_t, value_t>::erase(key_t key) {
-        if(contains(key)) {
-            key_t const to_remove_index{ key_to_index[key] };//Index of the item we will remove.
-            key_t const last_index{ item_array.size() - 1 }; //Index of the item we will replace it with.
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    template<typename key_iterator_t, typename value_iterator_t>
+    void sparse_set<key_t, value_t, allocator_t>::emplace_sorted(key_iterator_t keys_begin, key_iterator_t keys_end, value_iterator_t values_begin) {
+        EMBER_CHECK(std::is_sorted(keys_begin, keys_end));
+
+        reserve(item_array.size() + static_cast<std::size_t>(std::distance(keys_begin, keys_end)));
+
+        sparse_page *page{ nullptr };
+        std::size_t page_index{ 0 };
 
-            if(to_remove_index < last_index) {
-                key_t const moved_key{ index_to_key[last_index] };
+        for(; keys_begin != keys_end; ++keys_begin, ++values_begin) {
+            key_t const key{ *keys_begin };
 
-                key_to_index[moved_key]       = to_remove_index;
-                item_array[to_remove_index]   = std::move(item_array.back());
-                index_to_key[to_remove_index] = std::move(index_to_key.back());
+            if(page == nullptr || get_page_index(key) != page_index) {
+                page       = &get_or_allocate_page(key);
+                page_index = get_page_index(key);
             }
 
-            key_to_index[key] = invalid_index;
-            item_array.pop_back();
-            index_to_key.pop_back();
+            index_type &index{ page->indices[get_page_offset(key)] };
+            if(index != invalid_index) {
+                //Destroy and reconstruct existing items for the same reason emplace erases them.
+                item_array[index].~value_type();
+                new(&item_array[index]) value_type{ *values_begin };
+            } else {
+                EMBER_CHECK(item_array.size() < invalid_index);
+
+                item_array.emplace_back(*values_begin);
+                index_to_key.push_back(key);
+
+                index = static_cast<index_type>(item_array.size() - 1);
+                ++page->live_keys;
+            }
         }
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    void sparse_set<key_t, value_t>::clear() {
-        key_to_index.clear();
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::erase(key_t key) {
+        index_type *const index{ find_index(key) };
+        if(index == nullptr || *index == invalid_index) {
+            return;
+        }
+
+        remove_item(*index);
+
+        *index = invalid_index;
+        release_page_key(key_to_index[get_page_index(key)]);
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    template<typename key_iterator_t>
+    void sparse_set<key_t, value_t, allocator_t>::erase_sorted(key_iterator_t keys_begin, key_iterator_t keys_end) {
+        EMBER_CHECK(std::is_sorted(keys_begin, keys_end));
+
+        for(; keys_begin != keys_end;) {
+            std::size_t const page_index{ get_page_index(*keys_begin) };
+            if(page_index >= key_to_index.size() || key_to_index[page_index].indices == nullptr) {
+                //Nothing to erase in this page so skip past all of the keys in it.
+                do {
+                    ++keys_begin;
+                } while(keys_begin != keys_end && get_page_index(*keys_begin) == page_index);
+                continue;
+            }
+
+            sparse_page &page{ key_to_index[page_index] };
+
+            //Keep the page alive until every key in it has been processed.
+            for(; keys_begin != keys_end && get_page_index(*keys_begin) == page_index; ++keys_begin) {
+                index_type &index{ page.indices[get_page_offset(*keys_begin)] };
+                if(index != invalid_index) {
+                    remove_item(index);
+
+                    index = invalid_index;
+                    --page.live_keys;
+                }
+            }
+
+            if(page.live_keys == 0) {
+                std::byte *memory{ reinterpret_cast<std::byte *>(page.indices) };
+                allocator.free(memory);
+                page.indices = nullptr;
+            }
+        }
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::clear() {
+        free_pages();
         item_array.clear();
         index_to_key.clear();
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    std::size_t sparse_set<key_t, value_t>::size() const noexcept {
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::reserve(std::size_t const capacity) {
+        item_array.reserve(capacity);
+        index_to_key.reserve(capacity);
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    std::size_t sparse_set<key_t, value_t, allocator_t>::size() const noexcept {
         return item_array.size();
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    bool sparse_set<key_t, value_t>::contains(key_t key) const noexcept {
-        return key_to_index.size() > key && key_to_index[key] != invalid_index;
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    bool sparse_set<key_t, value_t, allocator_t>::contains(key_t key) const noexcept {
+        index_type const *const index{ find_index(key) };
+        return index != nullptr && *index != invalid_index;
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    typename sparse_set<key_t, value_t>::iterator sparse_set<key_t, value_t>::begin() noexcept {
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    allocator_t sparse_set<key_t, value_t, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::iterator sparse_set<key_t, value_t, allocator_t>::begin() noexcept {
         return item_array.begin();
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    typename sparse_set<key_t, value_t>::const_iterator sparse_set<key_t, value_t>::begin() const noexcept {
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::const_iterator sparse_set<key_t, value_t, allocator_t>::begin() const noexcept {
         return item_array.begin();
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    typename sparse_set<key_t, value_t>::iterator sparse_set<key_t, value_t>::end() noexcept {
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::iterator sparse_set<key_t, value_t, allocator_t>::end() noexcept {
         return item_array.end();
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    typename sparse_set<key_t, value_t>::const_iterator sparse_set<key_t, value_t>::end() const noexcept {
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::const_iterator sparse_set<key_t, value_t, allocator_t>::end() const noexcept {
         return item_array.end();
     }
 
-    template<integral_t key_t, moveable_t value_t>
-    typename sparse_set<key_t, value_t>::reference_type sparse_set<key_t, value_t>::operator[](key_t key) {
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::reference_type sparse_set<key_t, value_t, allocator_t>::operator[](key_t key) {
         if(!contains(key)) {
             emplace(key);
         }
 
-        return item_array[key_to_index[key]];
+        return item_array[*find_index(key)];
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    std::size_t sparse_set<key_t, value_t, allocator_t>::get_page_index(key_t const key) {
+        return static_cast<std::size_t>(key) / page_size;
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    std::size_t sparse_set<key_t, value_t, allocator_t>::get_page_offset(key_t const key) {
+        return static_cast<std::size_t>(key) % page_size;
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::index_type *sparse_set<key_t, value_t, allocator_t>::find_index(key_t const key) {
+        std::size_t const page_index{ get_page_index(key) };
+        if(page_index >= key_to_index.size() || key_to_index[page_index].indices == nullptr) {
+            return nullptr;
+        }
+
+        return &key_to_index[page_index].indices[get_page_offset(key)];
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::index_type const *sparse_set<key_t, value_t, allocator_t>::find_index(key_t const key) const {
+        std::size_t const page_index{ get_page_index(key) };
+        if(page_index >= key_to_index.size() || key_to_index[page_index].indices == nullptr) {
+            return nullptr;
+        }
+
+        return &key_to_index[page_index].indices[get_page_offset(key)];
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    typename sparse_set<key_t, value_t, allocator_t>::sparse_page &sparse_set<key_t, value_t, allocator_t>::get_or_allocate_page(key_t const key) {
+        std::size_t const page_index{ get_page_index(key) };
+        if(page_index >= key_to_index.size()) {
+            //Grow geometrically so inserting increasing keys doesn't reallocate every time.
+            if(key_to_index.capacity() <= page_index) {
+                key_to_index.reserve(std::max<std::size_t>(page_index + 1, key_to_index.capacity() * 2));
+            }
+            key_to_index.resize(page_index + 1);
+        }
+
+        sparse_page &page{ key_to_index[page_index] };
+        if(page.indices == nullptr) {
+            std::byte *const memory{ allocator.alloc(sizeof(index_type) * page_size, alignof(index_type)) };
+            EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate sparse_set page." });
+
+            std::memset(memory, 0xff, sizeof(index_type) * page_size);//Every byte set makes every index invalid_index.
+            page.indices   = reinterpret_cast<index_type *>(memory);
+            page.live_keys = 0;
+        }
+
+        return page;
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::remove_item(index_type const index) {
+        index_type const last_index{ static_cast<index_type>(item_array.size() - 1) };
+
+        if(index < last_index) {
+            key_t const moved_key{ index_to_key[last_index] };
+
+            *find_index(moved_key) = index;
+            item_array[index]      = std::move(item_array.back());
+            index_to_key[index]    = moved_key;
+        }
+
+        item_array.pop_back();
+        index_to_key.pop_back();
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::release_page_key(sparse_page &page) {
+        EMBER_CHECK(page.live_keys > 0);
+
+        if(--page.live_keys == 0) {
+            std::byte *memory{ reinterpret_cast<std::byte *>(page.indices) };
+            allocator.free(memory);
+            page.indices = nullptr;
+        }
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::copy_pages(sparse_array_type const &other_pages) {
+        key_to_index.resize(other_pages.size());
+
+        for(std::size_t i{ 0 }; i < other_pages.size(); ++i) {
+            if(other_pages[i].indices == nullptr) {
+                continue;
+            }
+
+            std::byte *const memory{ allocator.alloc(sizeof(index_type) * page_size, alignof(index_type)) };
+            EMBER_THROW_IF_FAILED(memory != nullptr, exception{ "Failed to allocate sparse_set page." });
+
+            std::memcpy(memory, other_pages[i].indices, sizeof(index_type) * page_size);
+            key_to_index[i].indices   = reinterpret_cast<index_type *>(memory);
+            key_to_index[i].live_keys = other_pages[i].live_keys;
+        }
+    }
+
+    template<integral_t key_t, moveable_t value_t, allocator allocator_t>
+    void sparse_set<key_t, value_t, allocator_t>::free_pages() {
+        for(sparse_page &page : key_to_index) {
+            if(page.indices != nullptr) {
+                std::byte *memory{ reinterpret_cast<std::byte *>(page.indices) };
+                allocator.free(memory);
+                page.indices = nullptr;
+            }
+        }
+        key_to_index.clear();
     }
-}
\ No newline at end of file
+}
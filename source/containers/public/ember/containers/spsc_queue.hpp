@@ -0,0 +1,138 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/memory.hpp>
+#include <optional>
+#include <type_traits>
+
+namespace ember::inline containers {
+    /**
+     * @brief Bounded lock-free queue for passing items from exactly one producer thread to exactly one
+     * consumer thread.
+     * @details Every operation is wait-free. The producer and consumer indices live on their own cache lines
+     * and each side keeps a cached copy of the other's index so it only touches the shared line when the
+     * queue looks full (or empty). Capacity is rounded up to a power of two.
+     * @tparam T
+     * @tparam allocator_t Allocator used for the ring buffer.
+     */
+    template<typename T, allocator allocator_t = global_allocator_ref>
+    class spsc_queue {
+        //TYPES
+    public:
+        using value_type     = T;
+        using allocator_type = allocator_t;
+
+        //VARIABLES
+    private:
+        T *items{ nullptr };   /**< Ring buffer of capacity items. */
+        std::size_t mask{ 0 }; /**< capacity - 1, used to wrap indices into the ring buffer. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the ring buffer is allocated from. */
+
+        alignas(cache_line_size) std::atomic<std::size_t> head{ 0 }; /**< Next index to pop. Only written by the consumer. */
+        std::size_t cached_tail{ 0 };                                /**< The consumer's last view of tail. */
+
+        alignas(cache_line_size) std::atomic<std::size_t> tail{ 0 }; /**< Next index to push. Only written by the producer. */
+        std::size_t cached_head{ 0 };                                /**< The producer's last view of head. */
+
+        //FUNCTIONS
+    public:
+        /**
+         * @brief Creates a queue that can hold at least capacity items.
+         * @param capacity
+         */
+        explicit spsc_queue(std::size_t const capacity) requires std::is_default_constructible_v<allocator_t>;
+        spsc_queue(std::size_t const capacity, allocator_t allocator);
+
+        spsc_queue(spsc_queue const &other) = delete;
+        spsc_queue(spsc_queue &&other)      = delete;
+
+        spsc_queue &operator=(spsc_queue const &other) = delete;
+        spsc_queue &operator=(spsc_queue &&other)      = delete;
+
+        ~spsc_queue();
+
+        /**
+         * @brief Constructs a new item at the back of the queue with args. Producer only.
+         * @tparam args_t
+         * @param args
+         * @return Returns false if the queue is full.
+         */
+        template<typename... args_t>
+        bool try_emplace(args_t &&...args);
+
+        /**
+         * @brief Copies val onto the back of the queue. Producer only.
+         * @param val
+         * @return Returns false if the queue is full.
+         */
+        bool try_push(T const &val);
+        /**
+         * @brief Moves val onto the back of the queue. Producer only.
+         * @param val
+         * @return Returns false if the queue is full.
+         */
+        bool try_push(T &&val);
+        /**
+         * @brief Copies as many items from [begin, end) onto the back of the queue as will fit, publishing
+         * them to the consumer all at once. Producer only.
+         * @param begin
+         * @param end
+         * @return Returns how many items were pushed.
+         */
+        template<typename iterator_type>
+        std::size_t try_push(iterator_type begin, iterator_type end);
+
+        /**
+         * @brief Removes the item at the front of the queue. Consumer only.
+         * @return Returns an empty optional if the queue is empty.
+         */
+        std::optional<T> try_pop();
+        /**
+         * @brief Moves up to max_count items from the front of the queue into out. Consumer only.
+         * @param out Output iterator to write the items to.
+         * @param max_count
+         * @return Returns how many items were popped.
+         */
+        template<typename output_iterator_type>
+        std::size_t try_pop(output_iterator_type out, std::size_t const max_count);
+
+        /**
+         * @brief Returns how many items are in the queue. Only exact when called from the producer or consumer
+         * while the other side is idle.
+         * @return
+         */
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns the maximum number of items the queue can hold.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns true if the queue contains no items. Same caveats as size().
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the allocator this queue allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+
+    private:
+        /**
+         * @brief Returns how many items the producer can push, refreshing cached_head if it needs more than count.
+         */
+        std::size_t get_free_count(std::size_t const current_tail, std::size_t const count);
+        /**
+         * @brief Returns how many items the consumer can pop, refreshing cached_tail if it needs more than count.
+         */
+        std::size_t get_ready_count(std::size_t const current_head, std::size_t const count);
+    };
+}
+
+#include "spsc_queue.inl"
@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <bit>
+#include <ember/core/exception.hpp>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace ember::inline containers {
+    template<typename T, allocator allocator_t>
+    spsc_queue<T, allocator_t>::spsc_queue(std::size_t const capacity) requires std::is_default_constructible_v<allocator_t>
+        : spsc_queue{ capacity, allocator_t{} } {
+    }
+
+    template<typename T, allocator allocator_t>
+    spsc_queue<T, allocator_t>::spsc_queue(std::size_t const capacity, allocator_t allocator)
+        : allocator{ std::move(allocator) } {
+        std::size_t const ring_capacity{ std::bit_ceil(std::max<std::size_t>(capacity, 1)) };
+
+        items = reinterpret_cast<T *>(this->allocator.alloc(sizeof(T) * ring_capacity, alignof(T)));
+        EMBER_THROW_IF_FAILED(items != nullptr, exception{ "Failed to allocate spsc_queue ring buffer." });
+
+        mask = ring_capacity - 1;
+    }
+
+    template<typename T, allocator allocator_t>
+    spsc_queue<T, allocator_t>::~spsc_queue() {
+        if constexpr(!std::is_trivially_destructible_v<T>) {
+            std::size_t const current_tail{ tail.load(std::memory_order_acquire) };
+            for(std::size_t index{ head.load(std::memory_order_relaxed) }; index != current_tail; ++index) {
+                items[index & mask].~T();
+            }
+        }
+
+        std::byte *memory{ reinterpret_cast<std::byte *>(items) };
+        allocator.free(memory);
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename... args_t>
+    bool spsc_queue<T, allocator_t>::try_emplace(args_t &&...args) {
+        std::size_t const current_tail{ tail.load(std::memory_order_relaxed) };
+        if(get_free_count(current_tail, 1) == 0) {
+            return false;
+        }
+
+        new(&items[current_tail & mask]) T{ std::forward<args_t>(args)... };
+        tail.store(current_tail + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template<typename T, allocator allocator_t>
+    bool spsc_queue<T, allocator_t>::try_push(T const &val) {
+        return try_emplace(val);
+    }
+
+    template<typename T, allocator allocator_t>
+    bool spsc_queue<T, allocator_t>::try_push(T &&val) {
+        return try_emplace(std::move(val));
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename iterator_type>
+    std::size_t spsc_queue<T, allocator_t>::try_push(iterator_type begin, iterator_type end) {
+        std::size_t const current_tail{ tail.load(std::memory_order_relaxed) };
+        std::size_t const requested_count{ static_cast<std::size_t>(std::distance(begin, end)) };
+        std::size_t const count{ std::min(get_free_count(current_tail, requested_count), requested_count) };
+
+        for(std::size_t i{ 0 }; i < count; ++i, ++begin) {
+            new(&items[(current_tail + i) & mask]) T(*begin);
+        }
+        tail.store(current_tail + count, std::memory_order_release);
+
+        return count;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::optional<T> spsc_queue<T, allocator_t>::try_pop() {
+        std::size_t const current_head{ head.load(std::memory_order_relaxed) };
+        if(get_ready_count(current_head, 1) == 0) {
+            return std::nullopt;
+        }
+
+        T &item{ items[current_head & mask] };
+        std::optional<T> result{ std::move(item) };
+        item.~T();
+
+        head.store(current_head + 1, std::memory_order_release);
+
+        return result;
+    }
+
+    template<typename T, allocator allocator_t>
+    template<typename output_iterator_type>
+    std::size_t spsc_queue<T, allocator_t>::try_pop(output_iterator_type out, std::size_t const max_count) {
+        std::size_t const current_head{ head.load(std::memory_order_relaxed) };
+        std::size_t const count{ std::min(get_ready_count(current_head, max_count), max_count) };
+
+        for(std::size_t i{ 0 }; i < count; ++i, ++out) {
+            T &item{ items[(current_head + i) & mask] };
+            *out = std::move(item);
+            item.~T();
+        }
+        head.store(current_head + count, std::memory_order_release);
+
+        return count;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t spsc_queue<T, allocator_t>::size() const noexcept {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t spsc_queue<T, allocator_t>::capacity() const noexcept {
+        return mask + 1;
+    }
+
+    template<typename T, allocator allocator_t>
+    bool spsc_queue<T, allocator_t>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template<typename T, allocator allocator_t>
+    allocator_t spsc_queue<T, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t spsc_queue<T, allocator_t>::get_free_count(std::size_t const current_tail, std::size_t const count) {
+        std::size_t free_count{ capacity() - (current_tail - cached_head) };
+        if(free_count < count) {
+            cached_head = head.load(std::memory_order_acquire);
+            free_count  = capacity() - (current_tail - cached_head);
+        }
+
+        return free_count;
+    }
+
+    template<typename T, allocator allocator_t>
+    std::size_t spsc_queue<T, allocator_t>::get_ready_count(std::size_t const current_head, std::size_t const count) {
+        std::size_t ready_count{ cached_tail - current_head };
+        if(ready_count < count) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            ready_count = cached_tail - current_head;
+        }
+
+        return ready_count;
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/memory.hpp>
+#include <optional>
+#include <type_traits>
+
+namespace ember::inline containers {
+    /**
+     * @brief Bounded lock-free deque where one owning thread pushes and pops at the bottom while any thread can
+     * steal from the top.
+     * @details Based on the Chase-Lev deque. The owner works through its own items newest first, which keeps them
+     * warm in its cache, while thieves take the oldest items which tend to be the largest pieces of work. Only the
+     * last item causes the owner and thieves to contend. Capacity is rounded up to a power of two.
+     * @tparam T Must be trivially copyable as thieves can read an item before they know if they have won it.
+     * Usually a pointer to the work item.
+     * @tparam allocator_t Allocator used for the ring buffer.
+     */
+    template<typename T, allocator allocator_t = global_allocator_ref>
+    requires std::is_trivially_copyable_v<T>
+    class work_stealing_deque {
+        //TYPES
+    public:
+        using value_type     = T;
+        using allocator_type = allocator_t;
+
+        //VARIABLES
+    private:
+        std::atomic<T> *items{ nullptr }; /**< Ring buffer of capacity items. */
+        std::size_t mask{ 0 };            /**< capacity - 1, used to wrap positions into the ring buffer. */
+
+        [[no_unique_address]] allocator_t allocator{}; /**< Where the ring buffer is allocated from. */
+
+        alignas(cache_line_size) std::atomic<std::int64_t> top{ 0 };    /**< Next position thieves will steal from. */
+        alignas(cache_line_size) std::atomic<std::int64_t> bottom{ 0 }; /**< Next position the owner will push to. */
+
+        //FUNCTIONS
+    public:
+        /**
+         * @brief Creates a deque that can hold at least capacity items.
+         * @param capacity
+         */
+        explicit work_stealing_deque(std::size_t const capacity) requires std::is_default_constructible_v<allocator_t>;
+        work_stealing_deque(std::size_t const capacity, allocator_t allocator);
+
+        work_stealing_deque(work_stealing_deque const &other) = delete;
+        work_stealing_deque(work_stealing_deque &&other)      = delete;
+
+        work_stealing_deque &operator=(work_stealing_deque const &other) = delete;
+        work_stealing_deque &operator=(work_stealing_deque &&other)      = delete;
+
+        ~work_stealing_deque();
+
+        /**
+         * @brief Pushes val onto the bottom of the deque. Must only be called by the owning thread.
+         * @param val
+         * @return Returns false if the deque is full.
+         */
+        bool try_push(T const val);
+
+        /**
+         * @brief Removes the newest item from the bottom of the deque. Must only be called by the owning thread.
+         * @return Returns an empty optional if the deque is empty or a thief took the last item.
+         */
+        std::optional<T> try_pop();
+
+        /**
+         * @brief Removes the oldest item from the top of the deque. Can be called from any thread.
+         * @return Returns an empty optional if the deque is empty or another thread won the item.
+         */
+        std::optional<T> try_steal();
+
+        /**
+         * @brief Returns an approximate number of items in the deque. Can be out of date as soon as it returns.
+         * @return
+         */
+        std::size_t size() const noexcept;
+        /**
+         * @brief Returns the maximum number of items the deque can hold.
+         * @return
+         */
+        std::size_t capacity() const noexcept;
+
+        /**
+         * @brief Returns true if the deque appeared to contain no items. Same caveats as size().
+         * @return
+         */
+        [[nodiscard]] bool empty() const noexcept;
+
+        /**
+         * @brief Returns the allocator this deque allocates it's memory from.
+         * @return
+         */
+        allocator_t get_allocator() const;
+    };
+}
+
+#include "work_stealing_deque.inl"
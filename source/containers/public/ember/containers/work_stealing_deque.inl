@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <bit>
+#include <ember/core/exception.hpp>
+#include <new>
+#include <utility>
+
+namespace ember::inline containers {
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    work_stealing_deque<T, allocator_t>::work_stealing_deque(std::size_t const capacity) requires std::is_default_constructible_v<allocator_t>
+        : work_stealing_deque{ capacity, allocator_t{} } {
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    work_stealing_deque<T, allocator_t>::work_stealing_deque(std::size_t const capacity, allocator_t allocator)
+        : allocator{ std::move(allocator) } {
+        std::size_t const ring_capacity{ std::bit_ceil(std::max<std::size_t>(capacity, 1)) };
+
+        items = reinterpret_cast<std::atomic<T> *>(this->allocator.alloc(sizeof(std::atomic<T>) * ring_capacity, alignof(std::atomic<T>)));
+        EMBER_THROW_IF_FAILED(items != nullptr, exception{ "Failed to allocate work_stealing_deque ring buffer." });
+
+        for(std::size_t i{ 0 }; i < ring_capacity; ++i) {
+            new(&items[i]) std::atomic<T>{};
+        }
+
+        mask = ring_capacity - 1;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    work_stealing_deque<T, allocator_t>::~work_stealing_deque() {
+        for(std::size_t i{ 0 }; i < capacity(); ++i) {
+            items[i].~atomic();
+        }
+
+        std::byte *memory{ reinterpret_cast<std::byte *>(items) };
+        allocator.free(memory);
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    bool work_stealing_deque<T, allocator_t>::try_push(T const val) {
+        std::int64_t const current_bottom{ bottom.load(std::memory_order_relaxed) };
+        std::int64_t const current_top{ top.load(std::memory_order_acquire) };
+
+        if(static_cast<std::size_t>(current_bottom - current_top) >= capacity()) {
+            return false;
+        }
+
+        items[current_bottom & mask].store(val, std::memory_order_relaxed);
+        bottom.store(current_bottom + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    std::optional<T> work_stealing_deque<T, allocator_t>::try_pop() {
+        //Reserve the bottom item before looking at top. Both need to be sequentially consistent so a thief
+        //can't read the old bottom while the owner reads the old top, letting them both take the last item.
+        std::int64_t const new_bottom{ bottom.load(std::memory_order_relaxed) - 1 };
+        bottom.store(new_bottom, std::memory_order_seq_cst);
+        std::int64_t current_top{ top.load(std::memory_order_seq_cst) };
+
+        if(current_top > new_bottom) {
+            bottom.store(new_bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T const item{ items[new_bottom & mask].load(std::memory_order_relaxed) };
+        if(current_top != new_bottom) {
+            return item;
+        }
+
+        //Taking the last item so race the thieves for it.
+        bool const won{ top.compare_exchange_strong(current_top, current_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed) };
+        bottom.store(new_bottom + 1, std::memory_order_relaxed);
+
+        return won ? std::optional<T>{ item } : std::nullopt;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    std::optional<T> work_stealing_deque<T, allocator_t>::try_steal() {
+        std::int64_t current_top{ top.load(std::memory_order_seq_cst) };
+        std::int64_t const current_bottom{ bottom.load(std::memory_order_seq_cst) };
+
+        if(current_top >= current_bottom) {
+            return std::nullopt;
+        }
+
+        T const item{ items[current_top & mask].load(std::memory_order_relaxed) };
+        if(!top.compare_exchange_strong(current_top, current_top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+
+        return item;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    std::size_t work_stealing_deque<T, allocator_t>::size() const noexcept {
+        std::int64_t const current_top{ top.load(std::memory_order_relaxed) };
+        std::int64_t const current_bottom{ bottom.load(std::memory_order_relaxed) };
+
+        //The owner briefly moves bottom below top when popping the last item.
+        return current_bottom > current_top ? static_cast<std::size_t>(current_bottom - current_top) : 0;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    std::size_t work_stealing_deque<T, allocator_t>::capacity() const noexcept {
+        return mask + 1;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    bool work_stealing_deque<T, allocator_t>::empty() const noexcept {
+        return size() == 0;
+    }
+
+    template<typename T, allocator allocator_t>
+    requires std::is_trivially_copyable_v<T>
+    allocator_t work_stealing_deque<T, allocator_t>::get_allocator() const {
+        return allocator;
+    }
+}
@@ -0,0 +1,235 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ember/containers/array.hpp>
+#include <ember/containers/sparse_set.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <gtest/gtest.h>
+#include <type_traits>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr frame_count{ 200 };
+    std::size_t constexpr arrays_per_frame{ 64 };
+    std::size_t constexpr pushes_per_array{ 256 };
+
+    /**
+     * @brief Simulates a frame's worth of temporary arrays being built up and thrown away.
+     */
+    template<typename array_t, typename make_array_t, typename end_frame_t>
+    double run_push_heavy_frames(make_array_t make_array, end_frame_t end_frame) {
+        std::size_t checksum{ 0 };
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::size_t frame{ 0 }; frame < frame_count; ++frame) {
+            for(std::size_t i{ 0 }; i < arrays_per_frame; ++i) {
+                array_t items{ make_array() };
+                for(std::size_t j{ 0 }; j < pushes_per_array; ++j) {
+                    items.push_back(static_cast<int>(j));
+                }
+                checksum += items.size();
+            }
+            end_frame();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        EXPECT_EQ(checksum, frame_count * arrays_per_frame * pushes_per_array);
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    template<typename set_t, typename make_set_t, typename end_frame_t>
+    double run_sparse_set_frames(make_set_t make_set, end_frame_t end_frame) {
+        std::size_t checksum{ 0 };
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::size_t frame{ 0 }; frame < frame_count; ++frame) {
+            set_t set{ make_set() };
+            for(std::size_t i{ 0 }; i < arrays_per_frame * pushes_per_array / 4; ++i) {
+                set.emplace(i, static_cast<int>(i));
+            }
+            checksum += set.size();
+            end_frame();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        EXPECT_EQ(checksum, frame_count * arrays_per_frame * pushes_per_array / 4);
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+TEST(array_benchmarks, growing_array_avoids_copies_by_reallocating_in_place) {
+    std::size_t constexpr item_count{ 1000000 };
+
+    array<int> items{};
+    std::size_t growths{ 0 };
+    std::size_t avoided_copies{ 0 };
+
+    auto const start{ std::chrono::steady_clock::now() };
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        int const *const previous_data{ items.data() };
+        std::size_t const previous_capacity{ items.capacity() };
+
+        items.push_back(static_cast<int>(i));
+
+        if(items.capacity() != previous_capacity && previous_data != nullptr) {
+            ++growths;
+            if(items.data() == previous_data) {
+                ++avoided_copies;
+            }
+        }
+    }
+    auto const end{ std::chrono::steady_clock::now() };
+
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        ASSERT_EQ(items[i], static_cast<int>(i));
+    }
+
+    double const milliseconds{ std::chrono::duration<double, std::milli>(end - start).count() };
+    std::printf("%zu push_backs in %.2fms. %zu of %zu growths reallocated in place.\n", item_count, milliseconds, avoided_copies, growths);
+
+    EXPECT_GT(avoided_copies, 0);
+}
+
+TEST(array_benchmarks, push_heavy_workloads_on_default_allocator_and_linear_arena) {
+    linear_allocator arena{ EMBER_MB(1) };
+    auto const reset_arena{ [&arena]() { arena.reset(); } };
+    auto const do_nothing{ []() {} };
+
+    double const default_array{ run_push_heavy_frames<array<int>>([]() { return array<int>{}; }, do_nothing) };
+    double const arena_array{ run_push_heavy_frames<array<int, allocator_ref<linear_allocator>>>([&arena]() { return array<int, allocator_ref<linear_allocator>>{ allocator_ref{ arena } }; }, reset_arena) };
+    double const polymorphic_array{ run_push_heavy_frames<array<int, polymorphic_allocator>>([&arena]() { return array<int, polymorphic_allocator>{ polymorphic_allocator{ arena } }; }, reset_arena) };
+
+    double const default_set{ run_sparse_set_frames<sparse_set<std::size_t, int>>([]() { return sparse_set<std::size_t, int>{}; }, do_nothing) };
+    double const arena_set{ run_sparse_set_frames<sparse_set<std::size_t, int, allocator_ref<linear_allocator>>>([&arena]() { return sparse_set<std::size_t, int, allocator_ref<linear_allocator>>{ allocator_ref{ arena } }; }, reset_arena) };
+
+    std::printf("%24s %16s %16s\n", "workload", "allocator", "ms");
+    std::printf("%24s %16s %16.2f\n", "array push_back", "default", default_array);
+    std::printf("%24s %16s %16.2f\n", "array push_back", "linear", arena_array);
+    std::printf("%24s %16s %16.2f\n", "array push_back", "polymorphic", polymorphic_array);
+    std::printf("%24s %16s %16.2f\n", "sparse_set emplace", "default", default_set);
+    std::printf("%24s %16s %16.2f\n", "sparse_set emplace", "linear", arena_set);
+}
+
+namespace {
+    using command_buffer_handle = struct command_buffer_handle_t *; /**< Stands in for VkCommandBuffer. */
+    using component_id          = std::size_t;                      /**< Stands in for ecs::component_id_t. */
+
+    /**
+     * @brief Wraps a POD payload with user provided copy and move constructors so arrays of it
+     * have to take the item by item path. Used as the baseline for the bulk paths.
+     */
+    template<typename payload_t>
+    struct item_by_item {
+        payload_t value{};
+
+        item_by_item() = default;
+        item_by_item(payload_t value)
+            : value{ value } {}
+        item_by_item(item_by_item const &other)
+            : value{ other.value } {}
+        item_by_item(item_by_item &&other) noexcept
+            : value{ other.value } {}
+
+        item_by_item &operator=(item_by_item const &other) = default;
+        item_by_item &operator=(item_by_item &&other) noexcept = default;
+
+        ~item_by_item() = default;
+    };
+
+    template<typename payload_t>
+    payload_t make_payload(std::size_t const index) {
+        if constexpr(std::is_pointer_v<payload_t>) {
+            return reinterpret_cast<payload_t>(index * 8);
+        } else {
+            return static_cast<payload_t>(index);
+        }
+    }
+
+    struct bulk_results {
+        double push{ 0.0 };
+        double copy{ 0.0 };
+        double append{ 0.0 };
+        double insert{ 0.0 };
+    };
+
+    template<typename item_t, typename payload_t>
+    bulk_results run_bulk_workloads() {
+        std::size_t constexpr iterations{ 2000 };
+        std::size_t constexpr items_per_array{ 1024 };
+
+        std::size_t checksum{ 0 };
+        bulk_results results{};
+
+        array<item_t> source{};
+        for(std::size_t i{ 0 }; i < items_per_array; ++i) {
+            source.emplace_back(make_payload<payload_t>(i));
+        }
+
+        auto start{ std::chrono::steady_clock::now() };
+        for(std::size_t i{ 0 }; i < iterations; ++i) {
+            array<item_t> items{};
+            for(std::size_t j{ 0 }; j < items_per_array; ++j) {
+                items.emplace_back(make_payload<payload_t>(j));
+            }
+            checksum += items.size();
+        }
+        results.push = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for(std::size_t i{ 0 }; i < iterations; ++i) {
+            array<item_t> copy{ source };
+            array<item_t> moved{ std::move(copy) };
+            checksum += moved.size();
+        }
+        results.copy = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for(std::size_t i{ 0 }; i < iterations; ++i) {
+            array<item_t> items{};
+            for(std::size_t j{ 0 }; j < 8; ++j) {
+                items.append(source.begin() + j * (items_per_array / 8), source.begin() + (j + 1) * (items_per_array / 8));
+            }
+            checksum += items.size();
+        }
+        results.append = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for(std::size_t i{ 0 }; i < iterations / 10; ++i) {
+            array<item_t> items{ source };
+            for(std::size_t j{ 0 }; j < 16; ++j) {
+                items.insert(items.begin(), source.begin(), source.begin() + 16);
+                items.erase(items.begin() + 16, items.begin() + 32);
+            }
+            checksum += items.size();
+        }
+        results.insert = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+        EXPECT_EQ(checksum, iterations * items_per_array * 3 + (iterations / 10) * items_per_array);
+
+        return results;
+    }
+
+    template<typename payload_t>
+    void print_bulk_workloads(char const *const name) {
+        static_assert(is_trivially_relocatable_v<payload_t>);
+        static_assert(!is_trivially_relocatable_v<item_by_item<payload_t>>);
+
+        bulk_results const bulk{ run_bulk_workloads<payload_t, payload_t>() };
+        bulk_results const baseline{ run_bulk_workloads<item_by_item<payload_t>, payload_t>() };
+
+        std::printf("%24s %16s %16s %16s\n", name, "bulk ms", "item by item ms", "speedup");
+        std::printf("%24s %16.2f %16.2f %15.2fx\n", "push_back", bulk.push, baseline.push, baseline.push / bulk.push);
+        std::printf("%24s %16.2f %16.2f %15.2fx\n", "copy + move", bulk.copy, baseline.copy, baseline.copy / bulk.copy);
+        std::printf("%24s %16.2f %16.2f %15.2fx\n", "append", bulk.append, baseline.append, baseline.append / bulk.append);
+        std::printf("%24s %16.2f %16.2f %15.2fx\n", "insert + erase", bulk.insert, baseline.insert, baseline.insert / bulk.insert);
+    }
+}
+
+TEST(array_benchmarks, trivially_relocatable_payloads_take_bulk_paths) {
+    print_bulk_workloads<command_buffer_handle>("command buffer handles");
+    print_bulk_workloads<component_id>("component ids");
+    print_bulk_workloads<std::uint32_t>("uint32");
+}
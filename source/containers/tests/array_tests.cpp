@@ -1,5 +1,7 @@
 #include <ember/containers/array.hpp>
+#include <ember/memory/linear_allocator.hpp>
 #include <gtest/gtest.h>
+#include <string>
 #include <vector>
 
 using namespace ember;
@@ -238,7 +240,24 @@ TEST(array_tests, can_erase_items) {
 
     dtor_arr.erase(dtor_arr.begin() + 1, dtor_arr.end() - 1);
     EXPECT_EQ(dtor_arr.size(), 2);
-    EXPECT_EQ(count, 1);
+    EXPECT_EQ(count, 2);
+}
+
+TEST(array_tests, erasing_keeps_remaining_items_alive) {
+    array<std::string> arr{ "zero", "one", "two", "three", "four" };
+
+    arr.erase(arr.begin() + 1, arr.begin() + 3);
+
+    ASSERT_EQ(arr.size(), 3);
+    EXPECT_EQ(arr[0], "zero");
+    EXPECT_EQ(arr[1], "three");
+    EXPECT_EQ(arr[2], "four");
+
+    arr.erase(std::string{ "zero" });
+
+    ASSERT_EQ(arr.size(), 2);
+    EXPECT_EQ(arr[0], "three");
+    EXPECT_EQ(arr[1], "four");
 }
 
 TEST(array_tests, calls_destructor) {
@@ -333,6 +352,101 @@ TEST(array_tests, can_move) {
     EXPECT_EQ(arr_1.data(), nullptr);
 }
 
+TEST(array_tests, moving_takes_memory) {
+    array<std::string> arr_1{ "a", "b", "c" };
+    std::string const *const data{ arr_1.data() };
+
+    array<std::string> arr_2{ std::move(arr_1) };
+
+    EXPECT_EQ(arr_2.data(), data);
+    EXPECT_EQ(arr_2.size(), 3);
+    EXPECT_EQ(arr_1.data(), nullptr);
+    EXPECT_EQ(arr_1.size(), 0);
+
+    array<std::string> arr_3{ "d" };
+    arr_3 = std::move(arr_2);
+
+    EXPECT_EQ(arr_3.data(), data);
+    EXPECT_EQ(arr_3[2], "c");
+    EXPECT_EQ(arr_2.data(), nullptr);
+}
+
+TEST(array_tests, can_insert_ranges) {
+    std::vector<std::uint32_t> const items{ 10, 11, 12 };
+
+    array<std::uint32_t> arr{ 0, 1, 2 };
+
+    auto iter_1{ arr.insert(arr.begin() + 1, items.begin(), items.end()) };
+    EXPECT_EQ(*iter_1, 10);
+    EXPECT_EQ(arr, (array<std::uint32_t>{ 0, 10, 11, 12, 1, 2 }));
+
+    arr.insert(arr.end(), items.begin(), items.begin() + 1);
+    EXPECT_EQ(arr, (array<std::uint32_t>{ 0, 10, 11, 12, 1, 2, 10 }));
+
+    array<std::string> strings{ "a", "d" };
+    array<std::string> const middle{ "b", "c" };
+
+    auto iter_2{ strings.insert(strings.begin() + 1, middle.begin(), middle.end()) };
+    EXPECT_EQ(*iter_2, "b");
+    EXPECT_EQ(strings, (array<std::string>{ "a", "b", "c", "d" }));
+}
+
+TEST(array_tests, can_append_and_assign_ranges) {
+    array<std::uint32_t> arr{ 0, 1 };
+    array<std::uint32_t> const other{ 2, 3, 4 };
+
+    arr.append(other.begin(), other.end());
+    EXPECT_EQ(arr, (array<std::uint32_t>{ 0, 1, 2, 3, 4 }));
+
+    std::vector<std::uint32_t> const items{ 7, 8 };
+    arr.assign(items.begin(), items.end());
+    EXPECT_EQ(arr, (array<std::uint32_t>{ 7, 8 }));
+
+    array<std::string> strings{ "a" };
+    array<std::string> const words{ "b", "c", "d" };
+    strings.assign(words.begin(), words.end());
+    EXPECT_EQ(strings, (array<std::string>{ "b", "c", "d" }));
+
+    strings.assign(words.begin(), words.begin());
+    EXPECT_TRUE(strings.empty());
+}
+
+namespace {
+    struct relocatable_helper {
+        inline static std::uint32_t moves{ 0 };
+
+        std::uint32_t value{ 0 };
+
+        relocatable_helper(std::uint32_t value)
+            : value{ value } {}
+        relocatable_helper(relocatable_helper const &other) = default;
+        relocatable_helper(relocatable_helper &&other) noexcept
+            : value{ other.value } {
+            ++moves;
+        }
+        ~relocatable_helper() {}
+    };
+}
+
+template<>
+struct ember::is_trivially_relocatable<relocatable_helper> : std::true_type {};
+
+TEST(array_tests, relocates_trivially_relocatable_items_without_moving) {
+    array<relocatable_helper> arr{};
+    relocatable_helper::moves = 0;
+
+    for(std::uint32_t i{ 0 }; i < 64; ++i) {
+        arr.emplace_back(i);
+    }
+    arr.erase(arr.begin());
+
+    EXPECT_EQ(relocatable_helper::moves, 0);
+    ASSERT_EQ(arr.size(), 63);
+    for(std::uint32_t i{ 0 }; i < arr.size(); ++i) {
+        EXPECT_EQ(arr[i].value, i + 1);
+    }
+}
+
 struct resize_destruct_helper {
     inline static std::uint32_t x{ 0 };
 
@@ -499,4 +613,60 @@ TEST(array_tests, can_check_equality) {
 
 // TEST(array_tests, can_shrink_to_fit) {
 //     EXPECT_TRUE(false);
-// }
\ No newline at end of file
+// }
+
+TEST(array_tests, can_use_custom_allocator) {
+    linear_allocator allocator{ EMBER_KB(1) };
+
+    array<std::uint32_t, allocator_ref<linear_allocator>> arr{ allocator_ref{ allocator } };
+    for(std::uint32_t i{ 0 }; i < 32; ++i) {
+        arr.push_back(i);
+    }
+
+    ASSERT_EQ(arr.size(), 32);
+    for(std::uint32_t i{ 0 }; i < 32; ++i) {
+        EXPECT_EQ(arr[i], i);
+    }
+
+    EXPECT_EQ(arr.get_allocator(), allocator_ref{ allocator });
+
+    array<std::uint32_t, allocator_ref<linear_allocator>> copy{ arr };
+    EXPECT_EQ(copy, arr);
+    EXPECT_EQ(copy.get_allocator(), arr.get_allocator());
+}
+TEST(array_tests, can_use_polymorphic_allocator) {
+    struct counting_resource final : public memory_resource {
+        std::size_t allocations{ 0 };
+        std::size_t frees{ 0 };
+
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment) override {
+            ++allocations;
+            return memory::alloc(bytes, alignment);
+        }
+
+        void free(std::byte *&memory) override {
+            ++frees;
+            memory::free(memory);
+        }
+    };
+
+    counting_resource resource{};
+
+    {
+        array<std::uint32_t, polymorphic_allocator> arr{ polymorphic_allocator{ resource } };
+        for(std::uint32_t i{ 0 }; i < 32; ++i) {
+            arr.push_back(i);
+        }
+
+        for(std::uint32_t i{ 0 }; i < 32; ++i) {
+            EXPECT_EQ(arr[i], i);
+        }
+        EXPECT_EQ(&arr.get_allocator().get_resource(), &resource);
+    }
+
+    EXPECT_GT(resource.allocations, 0);
+    EXPECT_EQ(resource.allocations, resource.frees);
+
+    array<std::uint32_t, polymorphic_allocator> default_arr{};
+    EXPECT_EQ(&default_arr.get_allocator().get_resource(), &get_global_memory_resource());
+}
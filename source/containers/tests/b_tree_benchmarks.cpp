@@ -0,0 +1,147 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ember/containers/ordered_map.hpp>
+#include <ember/containers/set.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <numeric>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr lookup_count{ 1000000 };
+
+    struct timings {
+        double insert{ 0.0 };
+        double lookup{ 0.0 };
+        double iterate{ 0.0 };
+        double range{ 0.0 };
+        double erase{ 0.0 };
+    };
+
+    template<typename function_t>
+    double time_ms(function_t function) {
+        auto const start{ std::chrono::steady_clock::now() };
+        function();
+        auto const end{ std::chrono::steady_clock::now() };
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    /**
+     * @brief Runs the same workload against any map type with a std::map like interface.
+     * @param keys Keys to insert, in random order.
+     * @param lookups Keys to look up. All of them are in keys.
+     */
+    template<typename map_t>
+    timings run_map_workload(std::vector<std::uint64_t> const &keys, std::vector<std::uint64_t> const &lookups) {
+        timings result{};
+        std::uint64_t checksum{ 0 };
+
+        map_t map{};
+
+        result.insert = time_ms([&]() {
+            for(auto const key : keys) {
+                map.emplace(key, key);
+            }
+        });
+        EXPECT_EQ(map.size(), keys.size());
+
+        result.lookup = time_ms([&]() {
+            for(auto const key : lookups) {
+                checksum += map.find(key)->second;
+            }
+        });
+
+        result.iterate = time_ms([&]() {
+            for(auto const &[key, value] : map) {
+                checksum += value;
+            }
+        });
+
+        //Walk a 1% slice of the key space starting from a lookup.
+        result.range = time_ms([&]() {
+            std::size_t const range_length{ std::max<std::size_t>(1, keys.size() / 100) };
+            for(std::size_t i{ 0 }; i < 100; ++i) {
+                auto iter{ map.lower_bound(lookups[i]) };
+                for(std::size_t j{ 0 }; j < range_length && iter != map.end(); ++j, ++iter) {
+                    checksum += iter->second;
+                }
+            }
+        });
+
+        result.erase = time_ms([&]() {
+            for(auto const key : keys) {
+                checksum += map.erase(key);
+            }
+        });
+        EXPECT_TRUE(map.empty());
+
+        EXPECT_NE(checksum, 0);
+
+        return result;
+    }
+
+    void print_comparison(char const *name, std::size_t const item_count, timings const &std_timings, timings const &ember_timings) {
+        std::printf("%-12s %10zu %10s %10s %10s %10s %10s\n", name, item_count, "insert", "lookup", "iterate", "range", "erase");
+        std::printf("%-12s %10s %10.2f %10.2f %10.2f %10.2f %10.2f\n", "", "std", std_timings.insert, std_timings.lookup, std_timings.iterate, std_timings.range, std_timings.erase);
+        std::printf("%-12s %10s %10.2f %10.2f %10.2f %10.2f %10.2f\n", "", "b_tree", ember_timings.insert, ember_timings.lookup, ember_timings.iterate, ember_timings.range, ember_timings.erase);
+    }
+}
+
+TEST(b_tree_benchmarks, ordered_map_against_std_map) {
+    for(std::size_t const item_count : { 1000u, 100000u, 1000000u, 10000000u }) {
+        std::mt19937_64 generator{ item_count };
+
+        std::vector<std::uint64_t> keys(item_count);
+        std::iota(keys.begin(), keys.end(), 0);
+        std::shuffle(keys.begin(), keys.end(), generator);
+
+        std::vector<std::uint64_t> lookups(lookup_count);
+        std::uniform_int_distribution<std::size_t> index_distribution{ 0, item_count - 1 };
+        for(auto &lookup : lookups) {
+            lookup = keys[index_distribution(generator)];
+        }
+
+        timings const std_timings{ run_map_workload<std::map<std::uint64_t, std::uint64_t>>(keys, lookups) };
+        timings const ember_timings{ run_map_workload<ordered_map<std::uint64_t, std::uint64_t>>(keys, lookups) };
+
+        print_comparison("ordered_map", item_count, std_timings, ember_timings);
+    }
+}
+
+TEST(b_tree_benchmarks, bulk_load_against_inserting_sorted_items) {
+    std::printf("%10s %16s %16s %16s\n", "items", "std::set ms", "insert ms", "bulk_load ms");
+
+    for(std::size_t const item_count : { 1000u, 100000u, 1000000u, 10000000u }) {
+        std::vector<std::uint32_t> keys(item_count);
+        std::iota(keys.begin(), keys.end(), 0);
+
+        double const std_time{ time_ms([&]() {
+            std::set<std::uint32_t> keys_set(keys.begin(), keys.end());
+            EXPECT_EQ(keys_set.size(), item_count);
+        }) };
+
+        double const insert_time{ time_ms([&]() {
+            set<std::uint32_t> keys_set{};
+            for(auto const key : keys) {
+                keys_set.insert(key);
+            }
+            EXPECT_EQ(keys_set.size(), item_count);
+        }) };
+
+        double const bulk_load_time{ time_ms([&]() {
+            set<std::uint32_t> keys_set{};
+            keys_set.bulk_load(keys.begin(), keys.end());
+            EXPECT_EQ(keys_set.size(), item_count);
+        }) };
+
+        std::printf("%10zu %16.2f %16.2f %16.2f\n", item_count, std_time, insert_time, bulk_load_time);
+    }
+}
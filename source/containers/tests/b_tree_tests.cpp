@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cstdint>
+#include <ember/containers/ordered_map.hpp>
+#include <ember/containers/set.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    template<typename tree_t, typename std_map_t>
+    void expect_same_items(tree_t const &tree, std_map_t const &expected) {
+        ASSERT_EQ(tree.size(), expected.size());
+
+        auto expected_iter{ expected.begin() };
+        for(auto const &[key, value] : tree) {
+            ASSERT_EQ(key, expected_iter->first);
+            ASSERT_EQ(value, expected_iter->second);
+            ++expected_iter;
+        }
+    }
+}
+
+TEST(b_tree_tests, can_default_initialise) {
+    ordered_map<std::uint32_t, std::uint32_t> map{};
+
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_EQ(map.rbegin(), map.rend());
+    EXPECT_FALSE(map.contains(0));
+}
+
+TEST(b_tree_tests, iterates_in_order) {
+    std::size_t constexpr item_count{ 5000 };
+    ordered_map<std::size_t, std::size_t> map{};
+
+    //Insert out of order so nodes split at every position.
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        std::size_t const key{ (i * 7919) % item_count };
+        auto const [iter, inserted]{ map.emplace(key, key * 2) };
+
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(iter->first, key);
+        EXPECT_EQ(iter->second, key * 2);
+    }
+
+    EXPECT_EQ(map.size(), item_count);
+
+    std::size_t expected{ 0 };
+    for(auto const &[key, value] : map) {
+        EXPECT_EQ(key, expected);
+        EXPECT_EQ(value, expected * 2);
+        ++expected;
+    }
+    EXPECT_EQ(expected, item_count);
+
+    for(auto iter{ map.rbegin() }; iter != map.rend(); ++iter) {
+        --expected;
+        EXPECT_EQ(iter->first, expected);
+    }
+}
+
+TEST(b_tree_tests, does_not_replace_existing_items) {
+    ordered_map<std::uint32_t, std::string> map{};
+
+    EXPECT_TRUE(map.emplace(1u, "one").second);
+    EXPECT_FALSE(map.emplace(1u, "uno").second);
+    EXPECT_FALSE(map.try_emplace(1u, "eins").second);
+    EXPECT_FALSE(map.insert({ 1u, "un" }).second);
+
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.at(1), "one");
+}
+
+TEST(b_tree_tests, can_index_into_map) {
+    ordered_map<std::string, std::int32_t> map{};
+
+    map["b"] = 2;
+    map["a"] = 1;
+    map["a"] += 10;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map["a"], 11);
+    EXPECT_EQ(map["b"], 2);
+    EXPECT_EQ(map.begin()->first, "a");
+    EXPECT_EQ(map.rbegin()->first, "b");
+}
+
+TEST(b_tree_tests, matches_std_map_under_random_operations) {
+    std::mt19937 generator{ 12345 };
+    std::uniform_int_distribution<std::int32_t> key_distribution{ 0, 4000 };
+
+    ordered_map<std::int32_t, std::string> map{};
+    std::map<std::int32_t, std::string> expected{};
+
+    for(std::size_t i{ 0 }; i < 40000; ++i) {
+        std::int32_t const key{ key_distribution(generator) };
+
+        //Bias towards inserting early on, then towards erasing so nodes merge back together.
+        bool const insert{ (generator() % 100) < (i < 20000 ? 70u : 30u) };
+        if(insert) {
+            EXPECT_EQ(map.emplace(key, std::to_string(key)).second, expected.emplace(key, std::to_string(key)).second);
+        } else {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        }
+    }
+
+    expect_same_items(map, expected);
+
+    for(std::int32_t key{ 0 }; key <= 4000; ++key) {
+        EXPECT_EQ(map.contains(key), expected.contains(key));
+    }
+
+    while(!expected.empty()) {
+        std::int32_t const key{ expected.begin()->first };
+        EXPECT_EQ(map.erase(key), 1);
+        expected.erase(key);
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+}
+
+TEST(b_tree_tests, can_erase_while_iterating) {
+    ordered_map<std::int32_t, std::int32_t> map{};
+    for(std::int32_t i{ 0 }; i < 1000; ++i) {
+        map.emplace(i, i);
+    }
+
+    for(auto iter{ map.begin() }; iter != map.end();) {
+        if(iter->first % 3 == 0) {
+            iter = map.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    EXPECT_EQ(map.size(), 666);
+    for(auto const &[key, value] : map) {
+        EXPECT_NE(key % 3, 0);
+    }
+}
+
+TEST(b_tree_tests, can_iterate_over_ranges) {
+    ordered_map<std::int32_t, std::int32_t> map{};
+    for(std::int32_t i{ 0 }; i < 1000; i += 2) {
+        map.emplace(i, i);
+    }
+
+    EXPECT_EQ(map.lower_bound(100)->first, 100);
+    EXPECT_EQ(map.lower_bound(101)->first, 102);
+    EXPECT_EQ(map.upper_bound(100)->first, 102);
+    EXPECT_EQ(map.lower_bound(999), map.end());
+    EXPECT_EQ(map.lower_bound(-5), map.begin());
+
+    std::int32_t sum{ 0 };
+    for(auto iter{ map.lower_bound(200) }; iter != map.upper_bound(300); ++iter) {
+        sum += iter->second;
+    }
+    EXPECT_EQ(sum, 51 * 250);
+}
+
+TEST(b_tree_tests, can_bulk_load_sorted_items) {
+    for(std::int32_t const item_count : { 1, 7, 100, 10000 }) {
+        std::vector<std::pair<std::int32_t, std::int32_t>> items{};
+        std::map<std::int32_t, std::int32_t> expected{};
+        for(std::int32_t i{ 0 }; i < item_count; ++i) {
+            items.emplace_back(i * 3, i);
+            expected.emplace(i * 3, i);
+        }
+
+        ordered_map<std::int32_t, std::int32_t> map{};
+        map.emplace(-1, -1);//Replaced by the bulk load.
+        map.bulk_load(items.begin(), items.end());
+
+        expect_same_items(map, expected);
+        EXPECT_EQ(map.find(-1), map.end());
+
+        //The tree stays valid after a bulk load.
+        for(std::int32_t i{ 0 }; i < item_count; ++i) {
+            map.emplace(i * 3 + 1, i);
+            expected.emplace(i * 3 + 1, i);
+            if(i % 2 == 0) {
+                map.erase(i * 3);
+                expected.erase(i * 3);
+            }
+        }
+        expect_same_items(map, expected);
+    }
+}
+
+TEST(b_tree_tests, can_copy) {
+    ordered_map<std::int32_t, std::string> map{};
+    for(std::int32_t i{ 0 }; i < 500; ++i) {
+        map.emplace(i, std::to_string(i));
+    }
+
+    ordered_map<std::int32_t, std::string> copy{ map };
+    EXPECT_EQ(copy, map);
+
+    copy.erase(10);
+    EXPECT_NE(copy, map);
+    EXPECT_TRUE(map.contains(10));
+
+    copy = map;
+    EXPECT_EQ(copy, map);
+    EXPECT_EQ(copy.rbegin()->second, "499");
+}
+
+TEST(b_tree_tests, can_move) {
+    ordered_map<std::int32_t, std::unique_ptr<std::int32_t>> map{};
+    for(std::int32_t i{ 0 }; i < 500; ++i) {
+        map.emplace(i, std::make_unique<std::int32_t>(i));
+    }
+
+    ordered_map<std::int32_t, std::unique_ptr<std::int32_t>> moved{ std::move(map) };
+    EXPECT_EQ(moved.size(), 500);
+    EXPECT_EQ(*moved.at(250), 250);
+
+    map = std::move(moved);
+    EXPECT_EQ(map.size(), 500);
+    EXPECT_EQ(*map.at(499), 499);
+}
+
+TEST(b_tree_tests, set_stores_unique_keys) {
+    set<std::uint32_t> unique_indices{ 2, 0, 2, 1, 0 };
+
+    EXPECT_EQ(unique_indices.size(), 3);
+    EXPECT_EQ(*unique_indices.begin(), 0);
+
+    unique_indices.erase(0);
+    EXPECT_EQ(*unique_indices.begin(), 1);
+    EXPECT_FALSE(unique_indices.emplace(2u).second);
+
+    std::vector<std::uint32_t> const values(unique_indices.begin(), unique_indices.end());
+    EXPECT_EQ(values, (std::vector<std::uint32_t>{ 1, 2 }));
+}
+
+TEST(b_tree_tests, can_use_custom_allocator) {
+    linear_allocator allocator{ EMBER_KB(64) };
+
+    ordered_map<std::int32_t, std::int32_t, std::greater<std::int32_t>, allocator_ref<linear_allocator>> map{ allocator_ref{ allocator } };
+    for(std::int32_t i{ 0 }; i < 200; ++i) {
+        map.emplace(i, i);
+    }
+
+    EXPECT_EQ(map.begin()->first, 199);
+    EXPECT_EQ(map.get_allocator(), allocator_ref{ allocator });
+}
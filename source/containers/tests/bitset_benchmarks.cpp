@@ -0,0 +1,109 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ember/containers/bitset.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr iteration_count{ 200 };
+
+    template<typename function_t>
+    double time_ms(function_t function) {
+        auto const start{ std::chrono::steady_clock::now() };
+        function();
+        auto const end{ std::chrono::steady_clock::now() };
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+TEST(bitset_benchmarks, set_operations_against_vector_of_bool) {
+    std::printf("%10s %18s %18s %18s %18s %18s %18s\n", "bits", "vector and ms", "bitset and ms", "vector count ms", "bitset count ms", "vector find ms", "bitset find ms");
+
+    for(std::size_t const bit_count : { 1024u, 65536u, 1048576u }) {
+        std::vector<bool> vector_lhs(bit_count);
+        std::vector<bool> vector_rhs(bit_count);
+        dynamic_bitset bitset_lhs{ bit_count };
+        dynamic_bitset bitset_rhs{ bit_count };
+
+        for(std::size_t i{ 0 }; i < bit_count; i += 3) {
+            vector_lhs[i] = true;
+            bitset_lhs.set(i);
+        }
+        for(std::size_t i{ 0 }; i < bit_count; i += 5) {
+            vector_rhs[i] = true;
+            bitset_rhs.set(i);
+        }
+
+        //Keeps every intersection in a fresh copy so the and is measured rather than folded away.
+        std::size_t vector_total{ 0 };
+        double const vector_and{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                std::vector<bool> result{ vector_lhs };
+                for(std::size_t i{ 0 }; i < bit_count; ++i) {
+                    result[i] = result[i] && vector_rhs[i];
+                }
+                vector_total += result[iteration % bit_count] ? 1 : 0;
+            }
+        }) };
+
+        std::size_t bitset_total{ 0 };
+        double const bitset_and{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                dynamic_bitset result{ bitset_lhs };
+                result &= bitset_rhs;
+                bitset_total += result.test(iteration % bit_count) ? 1 : 0;
+            }
+        }) };
+        EXPECT_EQ(vector_total, bitset_total);
+
+        std::size_t vector_count{ 0 };
+        double const vector_count_time{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                for(bool const bit : vector_lhs) {
+                    vector_count += bit ? 1 : 0;
+                }
+            }
+        }) };
+
+        std::size_t bitset_count{ 0 };
+        double const bitset_count_time{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                bitset_count += bitset_lhs.count();
+            }
+        }) };
+        EXPECT_EQ(vector_count, bitset_count);
+
+        //Searches for the only set bit, right at the end, like looking for a free slot in a full pool.
+        std::vector<bool> vector_sparse(bit_count);
+        dynamic_bitset bitset_sparse{ bit_count };
+        vector_sparse[bit_count - 1] = true;
+        bitset_sparse.set(bit_count - 1);
+
+        std::size_t vector_found{ 0 };
+        double const vector_find{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                for(std::size_t i{ 0 }; i < bit_count; ++i) {
+                    if(vector_sparse[i]) {
+                        vector_found += i;
+                        break;
+                    }
+                }
+            }
+        }) };
+
+        std::size_t bitset_found{ 0 };
+        double const bitset_find{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                bitset_found += bitset_sparse.find_first_set();
+            }
+        }) };
+        EXPECT_EQ(vector_found, bitset_found);
+
+        std::printf("%10zu %18.3f %18.3f %18.3f %18.3f %18.3f %18.3f\n", bit_count, vector_and, bitset_and, vector_count_time, bitset_count_time, vector_find, bitset_find);
+    }
+}
@@ -0,0 +1,179 @@
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/bitset.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace ember;
+
+TEST(bitset_tests, static_bitset_can_set_and_test_bits) {
+    static_bitset<200> bits{};
+
+    EXPECT_EQ(bits.size(), 200);
+    EXPECT_TRUE(bits.none());
+    EXPECT_EQ(bits.count(), 0);
+
+    bits.set(0);
+    bits.set(63);
+    bits.set(64);
+    bits.set(199);
+    bits.flip(100);
+    EXPECT_TRUE(bits.test(63));
+    EXPECT_TRUE(bits[100]);
+    EXPECT_FALSE(bits.test(1));
+    EXPECT_EQ(bits.count(), 5);
+
+    bits.reset(63);
+    bits.set(64, false);
+    EXPECT_EQ(bits.count(), 3);
+
+    //Setting every bit must not set the bits past the end of the last word.
+    bits.set();
+    EXPECT_TRUE(bits.all());
+    EXPECT_EQ(bits.count(), 200);
+
+    bits.flip();
+    EXPECT_TRUE(bits.none());
+}
+
+TEST(bitset_tests, static_bitset_can_find_bits) {
+    static_bitset<500> bits{};
+
+    EXPECT_EQ(bits.find_first_set(), static_bitset<500>::npos);
+    EXPECT_EQ(bits.find_first_unset(), 0);
+
+    bits.set(3);
+    bits.set(130);
+    bits.set(499);
+    EXPECT_EQ(bits.find_first_set(), 3);
+    EXPECT_EQ(bits.find_first_set(4), 130);
+    EXPECT_EQ(bits.find_first_set(131), 499);
+    EXPECT_EQ(bits.find_first_set(500), static_bitset<500>::npos);
+
+    std::vector<std::size_t> visited{};
+    bits.for_each_set([&](std::size_t const index) { visited.push_back(index); });
+    EXPECT_EQ(visited, (std::vector<std::size_t>{ 3, 130, 499 }));
+
+    bits.set();
+    bits.reset(321);
+    EXPECT_EQ(bits.find_first_unset(), 321);
+    EXPECT_EQ(bits.find_first_unset(322), static_bitset<500>::npos);
+}
+
+TEST(bitset_tests, static_bitset_set_operations) {
+    static_bitset<300> lhs{};
+    static_bitset<300> rhs{};
+    for(std::size_t i{ 0 }; i < 300; i += 2) {
+        lhs.set(i);
+    }
+    for(std::size_t i{ 0 }; i < 300; i += 3) {
+        rhs.set(i);
+    }
+
+    EXPECT_EQ((lhs & rhs).count(), 50);
+    EXPECT_EQ((lhs | rhs).count(), 200);
+    EXPECT_EQ((lhs ^ rhs).count(), 150);
+    EXPECT_TRUE(lhs.intersects(rhs));
+    EXPECT_FALSE(lhs.is_subset_of(rhs));
+    EXPECT_TRUE((lhs & rhs).is_subset_of(rhs));
+
+    static_bitset<300> difference{ lhs };
+    difference.and_not(rhs);
+    EXPECT_EQ(difference.count(), 100);
+    EXPECT_FALSE(difference.intersects(rhs));
+
+    EXPECT_EQ(lhs, lhs);
+    EXPECT_NE(lhs, rhs);
+}
+
+TEST(bitset_tests, dynamic_bitset_can_resize) {
+    dynamic_bitset bits{};
+
+    EXPECT_TRUE(bits.empty());
+    EXPECT_EQ(bits.find_first_set(), dynamic_bitset<>::npos);
+
+    bits.resize(70, true);
+    EXPECT_EQ(bits.size(), 70);
+    EXPECT_EQ(bits.count(), 70);
+    EXPECT_TRUE(bits.all());
+
+    bits.resize(10);
+    EXPECT_EQ(bits.count(), 10);
+
+    //Growing again must not bring back the bits that were cut off.
+    bits.resize(100);
+    EXPECT_EQ(bits.count(), 10);
+    EXPECT_EQ(bits.find_first_unset(), 10);
+
+    bits.resize(130, true);
+    EXPECT_EQ(bits.count(), 40);
+    EXPECT_EQ(bits.find_first_set(10), 100);
+
+    bits.clear();
+    EXPECT_TRUE(bits.empty());
+    EXPECT_GE(bits.capacity(), 130);
+}
+
+TEST(bitset_tests, dynamic_bitsets_of_different_sizes_act_like_sets) {
+    dynamic_bitset small{ 10 };
+    dynamic_bitset large{ 1000 };
+
+    small.set(5);
+    large.set(5);
+    EXPECT_EQ(small, large);
+    EXPECT_TRUE(small.is_subset_of(large));
+    EXPECT_TRUE(large.is_subset_of(small));
+
+    large.set(900);
+    EXPECT_NE(small, large);
+    EXPECT_TRUE(small.is_subset_of(large));
+    EXPECT_FALSE(large.is_subset_of(small));
+    EXPECT_TRUE(large.intersects(small));
+
+    dynamic_bitset combined{ small };
+    combined |= large;
+    EXPECT_EQ(combined.size(), 1000);
+    EXPECT_EQ(combined, large);
+
+    combined &= small;
+    EXPECT_EQ(combined.count(), 1);
+
+    large.and_not(small);
+    EXPECT_EQ(large.find_first_set(), 900);
+}
+
+TEST(bitset_tests, dynamic_bitset_can_copy_and_move) {
+    dynamic_bitset bits{ 300 };
+    bits.set(299);
+
+    dynamic_bitset copy{ bits };
+    EXPECT_EQ(copy, bits);
+    copy.reset(299);
+    EXPECT_NE(copy, bits);
+
+    copy = bits;
+    EXPECT_EQ(copy, bits);
+
+    dynamic_bitset moved{ std::move(copy) };
+    EXPECT_TRUE(copy.empty());
+    EXPECT_TRUE(moved.test(299));
+
+    copy = std::move(moved);
+    EXPECT_EQ(copy.count(), 1);
+}
+
+TEST(bitset_tests, dynamic_bitset_can_use_custom_allocator) {
+    linear_allocator first_allocator{ EMBER_KB(4) };
+    linear_allocator second_allocator{ EMBER_KB(4) };
+
+    dynamic_bitset<allocator_ref<linear_allocator>> first{ allocator_ref{ first_allocator } };
+    dynamic_bitset<allocator_ref<linear_allocator>> second{ allocator_ref{ second_allocator } };
+    first.resize(1000);
+    first.set(512);
+
+    second = std::move(first);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(second.find_first_set(), 512);
+    EXPECT_EQ(second.get_allocator(), allocator_ref{ second_allocator });
+}
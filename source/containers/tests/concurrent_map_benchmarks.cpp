@@ -0,0 +1,149 @@
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ember/containers/concurrent_map.hpp>
+#include <ember/containers/map.hpp>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::uint64_t constexpr operations_per_thread{ 100000 };
+    std::uint64_t constexpr prefilled_key_count{ 10000 };
+
+    /**
+     * @brief What a shared cache would look like with a single lock around a map. Used as a baseline.
+     */
+    class locked_map {
+    private:
+        mutable std::shared_mutex mutex{};
+        map<std::uint64_t, std::uint64_t> items{};
+
+    public:
+        bool try_emplace(std::uint64_t const key, std::uint64_t const value) {
+            std::unique_lock const lock{ mutex };
+            return items.try_emplace(key, value).second;
+        }
+
+        template<typename factory_t>
+        std::uint64_t find_or_insert(std::uint64_t const key, factory_t factory) {
+            {
+                std::shared_lock const lock{ mutex };
+                if(auto const iter{ items.find(key) }; iter != items.end()) {
+                    return iter->second;
+                }
+            }
+
+            std::unique_lock const lock{ mutex };
+            return items.try_emplace(key, factory()).first->second;
+        }
+
+        std::size_t size() const {
+            std::shared_lock const lock{ mutex };
+            return items.size();
+        }
+    };
+
+    /**
+     * @brief Runs thread_count threads that each call function(map, thread_index, operation_index) operations_per_thread times.
+     * @return Returns millions of operations per second across all threads.
+     */
+    template<typename map_t, typename function_t>
+    double run_throughput(map_t &map, std::uint32_t const thread_count, function_t function) {
+        std::atomic<bool> start_flag{ false };
+        std::atomic<std::uint64_t> checksum{ 0 };
+
+        std::vector<std::thread> threads{};
+        for(std::uint32_t thread{ 0 }; thread < thread_count; ++thread) {
+            threads.emplace_back([&, thread]() {
+                while(!start_flag.load(std::memory_order_acquire)) {
+                    std::this_thread::yield();
+                }
+
+                std::uint64_t local_checksum{ 0 };
+                for(std::uint64_t operation{ 0 }; operation < operations_per_thread; ++operation) {
+                    local_checksum += function(map, thread, operation);
+                }
+                checksum.fetch_add(local_checksum, std::memory_order_relaxed);
+            });
+        }
+
+        auto const start{ std::chrono::steady_clock::now() };
+        start_flag.store(true, std::memory_order_release);
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        EXPECT_NE(checksum.load(), 0);
+
+        double const seconds{ std::chrono::duration<double>(end - start).count() };
+        return (static_cast<double>(operations_per_thread * thread_count) / 1000000.0) / seconds;
+    }
+
+    template<typename map_t>
+    void prefill(map_t &map) {
+        for(std::uint64_t key{ 0 }; key < prefilled_key_count; ++key) {
+            map.try_emplace(key, key + 1);
+        }
+    }
+
+    /**
+     * @brief Only looks up keys that already exist, like a warm shader cache.
+     */
+    template<typename map_t>
+    std::uint64_t read_operation(map_t &map, std::uint32_t const thread, std::uint64_t const operation) {
+        std::uint64_t const key{ (operation * 7919 + thread * 104729) % prefilled_key_count };
+        return map.find_or_insert(key, []() { return std::uint64_t{ 0 }; });
+    }
+
+    /**
+     * @brief Every thread inserts it's own unique keys, like a cold cache being filled from many threads.
+     */
+    template<typename map_t>
+    std::uint64_t write_operation(map_t &map, std::uint32_t const thread, std::uint64_t const operation) {
+        return map.try_emplace(static_cast<std::uint64_t>(thread) * operations_per_thread + operation, operation) ? 1 : 0;
+    }
+}
+
+TEST(concurrent_map_benchmarks, read_and_write_scaling_across_thread_counts) {
+    std::printf("%10s %20s %20s %20s %20s\n", "threads", "locked read M/s", "sharded read M/s", "locked write M/s", "sharded write M/s");
+
+    std::array<std::uint32_t, 6> constexpr thread_counts{ 1, 2, 4, 8, 16, 32 };
+    for(std::uint32_t const thread_count : thread_counts) {
+        double locked_read{ 0.0 };
+        double sharded_read{ 0.0 };
+        double locked_write{ 0.0 };
+        double sharded_write{ 0.0 };
+
+        {
+            locked_map map{};
+            prefill(map);
+            locked_read = run_throughput(map, thread_count, read_operation<locked_map>);
+        }
+        {
+            concurrent_map<std::uint64_t, std::uint64_t> map{};
+            prefill(map);
+            sharded_read = run_throughput(map, thread_count, read_operation<concurrent_map<std::uint64_t, std::uint64_t>>);
+        }
+        {
+            locked_map map{};
+            locked_write = run_throughput(map, thread_count, write_operation<locked_map>);
+            EXPECT_EQ(map.size(), operations_per_thread * thread_count);
+        }
+        {
+            concurrent_map<std::uint64_t, std::uint64_t> map{};
+            sharded_write = run_throughput(map, thread_count, write_operation<concurrent_map<std::uint64_t, std::uint64_t>>);
+            EXPECT_EQ(map.size(), operations_per_thread * thread_count);
+        }
+
+        std::printf("%10u %20.2f %20.2f %20.2f %20.2f\n", thread_count, locked_read, sharded_read, locked_write, sharded_write);
+    }
+}
@@ -0,0 +1,132 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/concurrent_map.hpp>
+#include <ember/memory/unique_ptr.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+TEST(concurrent_map_tests, can_default_initialise) {
+    concurrent_map<std::int32_t, std::int32_t> map{};
+
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(0));
+    EXPECT_FALSE(map.find(0).has_value());
+}
+
+TEST(concurrent_map_tests, can_insert_and_find) {
+    concurrent_map<std::string, std::int32_t> map{};
+
+    EXPECT_TRUE(map.try_emplace("one", 1));
+    EXPECT_FALSE(map.try_emplace("one", 100));
+    EXPECT_TRUE(map.insert_or_assign("two", 2));
+    EXPECT_FALSE(map.insert_or_assign("two", 20));
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.find("one"), 1);
+    EXPECT_EQ(map.at("two"), 20);
+    EXPECT_TRUE(map.contains("two"));
+    EXPECT_FALSE(map.contains("three"));
+
+    EXPECT_EQ(map.erase("one"), 1);
+    EXPECT_EQ(map.erase("one"), 0);
+    EXPECT_EQ(map.size(), 1);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+TEST(concurrent_map_tests, find_or_insert_only_creates_missing_values) {
+    concurrent_map<std::int32_t, std::string> map{};
+    std::int32_t factory_calls{ 0 };
+
+    auto const factory{ [&]() {
+        ++factory_calls;
+        return std::string{ "value" };
+    } };
+
+    EXPECT_EQ(map.find_or_insert(1, factory), "value");
+    EXPECT_EQ(map.find_or_insert(1, factory), "value");
+    EXPECT_EQ(factory_calls, 1);
+
+    std::size_t const length{ map.find_or_insert(2, factory, [](std::string const &value) { return value.size(); }) };
+    EXPECT_EQ(length, 5);
+    EXPECT_EQ(factory_calls, 2);
+}
+
+TEST(concurrent_map_tests, can_visit_and_update_values) {
+    concurrent_map<std::int32_t, unique_ptr<std::int32_t>> map{};
+    map.try_emplace(1, make_unique<std::int32_t>(10));
+
+    EXPECT_TRUE(map.update(1, [](unique_ptr<std::int32_t> &value) { *value += 5; }));
+    EXPECT_FALSE(map.update(2, [](unique_ptr<std::int32_t> &) {}));
+
+    std::int32_t seen{ 0 };
+    EXPECT_TRUE(map.visit(1, [&](unique_ptr<std::int32_t> const &value) { seen = *value; }));
+    EXPECT_EQ(seen, 15);
+
+    for(std::int32_t i{ 2 }; i < 200; ++i) {
+        map.try_emplace(i, make_unique<std::int32_t>(i));
+    }
+
+    std::int32_t sum{ 0 };
+    map.for_each([&](std::int32_t const key, unique_ptr<std::int32_t> const &value) {
+        sum += *value - key;
+    });
+    EXPECT_EQ(sum, 14);
+}
+
+TEST(concurrent_map_tests, can_move) {
+    concurrent_map<std::int32_t, unique_ptr<std::int32_t>> map{};
+    for(std::int32_t i{ 0 }; i < 100; ++i) {
+        map.try_emplace(i, make_unique<std::int32_t>(i));
+    }
+
+    concurrent_map<std::int32_t, unique_ptr<std::int32_t>> moved{ std::move(map) };
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(moved.size(), 100);
+
+    map = std::move(moved);
+    EXPECT_EQ(map.size(), 100);
+    EXPECT_TRUE(map.visit(42, [](unique_ptr<std::int32_t> const &value) { EXPECT_EQ(*value, 42); }));
+}
+
+TEST(concurrent_map_tests, factory_runs_once_per_key_across_threads) {
+    std::uint32_t constexpr thread_count{ 8 };
+    std::int32_t constexpr key_count{ 2000 };
+
+    concurrent_map<std::int32_t, std::int32_t> map{};
+    std::vector<std::atomic<std::int32_t>> factory_calls(key_count);
+
+    std::vector<std::thread> threads{};
+    for(std::uint32_t thread{ 0 }; thread < thread_count; ++thread) {
+        threads.emplace_back([&, thread]() {
+            //Every thread walks the keys from a different starting point so they collide on inserts and lookups.
+            for(std::int32_t i{ 0 }; i < key_count; ++i) {
+                std::int32_t const key{ (i + static_cast<std::int32_t>(thread) * 250) % key_count };
+                std::int32_t const value{ map.find_or_insert(key, [&]() {
+                    factory_calls[key].fetch_add(1, std::memory_order_relaxed);
+                    return key * 2;
+                }) };
+                EXPECT_EQ(value, key * 2);
+
+                if(i % 64 == 0) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for(auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(map.size(), key_count);
+    for(std::int32_t key{ 0 }; key < key_count; ++key) {
+        EXPECT_EQ(factory_calls[key].load(), 1);
+    }
+}
@@ -0,0 +1,173 @@
+#include <array>
+#include <cstdint>
+#include <ember/containers/intrusive_list.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    struct free_tag {};
+
+    struct object : public intrusive_list_node<>, public intrusive_list_node<free_tag> {
+        std::int32_t value{ 0 };
+
+        explicit object(std::int32_t value)
+            : value{ value } {
+        }
+    };
+
+    template<typename list_t>
+    std::vector<std::int32_t> get_values(list_t const &list) {
+        std::vector<std::int32_t> values{};
+        for(object const &obj : list) {
+            values.push_back(obj.value);
+        }
+        return values;
+    }
+}
+
+TEST(intrusive_list_tests, can_default_initialise) {
+    intrusive_list<object> list{};
+
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(list.rbegin(), list.rend());
+}
+
+TEST(intrusive_list_tests, links_objects_in_place) {
+    object a{ 1 };
+    object b{ 2 };
+    object c{ 3 };
+
+    intrusive_list<object> list{};
+    list.push_back(b);
+    list.push_front(a);
+    list.push_back(c);
+
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(&list.front(), &a);
+    EXPECT_EQ(&list.back(), &c);
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 1, 2, 3 }));
+
+    //The list refers to the objects themselves.
+    b.value = 20;
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 1, 20, 3 }));
+
+    std::vector<std::int32_t> reversed{};
+    for(auto iter{ list.rbegin() }; iter != list.rend(); ++iter) {
+        reversed.push_back(iter->value);
+    }
+    EXPECT_EQ(reversed, (std::vector<std::int32_t>{ 3, 20, 1 }));
+}
+
+TEST(intrusive_list_tests, can_insert_and_erase) {
+    std::array<object, 5> objects{ object{ 0 }, object{ 1 }, object{ 2 }, object{ 3 }, object{ 4 } };
+
+    intrusive_list<object> list{};
+    list.push_back(objects[0]);
+    list.push_back(objects[4]);
+
+    auto iter{ list.insert(list.iterator_to(objects[4]), objects[2]) };
+    EXPECT_EQ(&*iter, &objects[2]);
+    list.insert(iter, objects[1]);
+    list.insert(list.iterator_to(objects[4]), objects[3]);
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 0, 1, 2, 3, 4 }));
+
+    for(auto erase_iter{ list.begin() }; erase_iter != list.end();) {
+        if(erase_iter->value % 2 == 0) {
+            erase_iter = list.erase(erase_iter);
+        } else {
+            ++erase_iter;
+        }
+    }
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 1, 3 }));
+    EXPECT_FALSE(objects[0].intrusive_list_node<>::is_linked());
+    EXPECT_TRUE(objects[1].intrusive_list_node<>::is_linked());
+
+    list.remove(objects[3]);
+    list.pop_front();
+    EXPECT_TRUE(list.empty());
+    EXPECT_FALSE(objects[1].intrusive_list_node<>::is_linked());
+}
+
+TEST(intrusive_list_tests, objects_can_be_in_lists_with_different_tags) {
+    std::array<object, 4> objects{ object{ 0 }, object{ 1 }, object{ 2 }, object{ 3 } };
+
+    intrusive_list<object> all{};
+    intrusive_list<object, free_tag> free{};
+
+    for(object &obj : objects) {
+        all.push_back(obj);
+    }
+    free.push_back(objects[3]);
+    free.push_back(objects[1]);
+
+    EXPECT_EQ(get_values(all), (std::vector<std::int32_t>{ 0, 1, 2, 3 }));
+    EXPECT_EQ(get_values(free), (std::vector<std::int32_t>{ 3, 1 }));
+
+    free.clear();
+    EXPECT_EQ(all.size(), 4);
+    EXPECT_FALSE(objects[3].intrusive_list_node<free_tag>::is_linked());
+    EXPECT_TRUE(objects[3].intrusive_list_node<>::is_linked());
+}
+
+TEST(intrusive_list_tests, can_splice_between_lists) {
+    std::array<object, 4> objects{ object{ 0 }, object{ 1 }, object{ 2 }, object{ 3 } };
+
+    intrusive_list<object> first{};
+    intrusive_list<object> second{};
+    first.push_back(objects[0]);
+    first.push_back(objects[1]);
+    second.push_back(objects[2]);
+    second.push_back(objects[3]);
+
+    first.splice(first.begin(), second, second.iterator_to(objects[3]));
+    EXPECT_EQ(get_values(first), (std::vector<std::int32_t>{ 3, 0, 1 }));
+    EXPECT_EQ(get_values(second), (std::vector<std::int32_t>{ 2 }));
+
+    first.splice(first.end(), first, first.begin());
+    EXPECT_EQ(get_values(first), (std::vector<std::int32_t>{ 0, 1, 3 }));
+
+    first.splice(first.iterator_to(objects[1]), second);
+    EXPECT_EQ(get_values(first), (std::vector<std::int32_t>{ 0, 2, 1, 3 }));
+    EXPECT_EQ(first.size(), 4);
+    EXPECT_TRUE(second.empty());
+}
+
+TEST(intrusive_list_tests, can_move) {
+    std::array<object, 3> objects{ object{ 0 }, object{ 1 }, object{ 2 } };
+    object front{ 5 };
+
+    intrusive_list<object> list{};
+    for(object &obj : objects) {
+        list.push_back(obj);
+    }
+
+    intrusive_list<object> moved{ std::move(list) };
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(get_values(moved), (std::vector<std::int32_t>{ 0, 1, 2 }));
+
+    //Links have to point at the new list's root.
+    moved.push_front(front);
+    EXPECT_EQ(&moved.back(), &objects[2]);
+    EXPECT_EQ(&*std::prev(moved.end()), &objects[2]);
+
+    list = std::move(moved);
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 5, 0, 1, 2 }));
+    EXPECT_EQ(&*std::prev(list.end()), &objects[2]);
+}
+
+TEST(intrusive_list_tests, copied_objects_are_unlinked) {
+    object a{ 1 };
+
+    intrusive_list<object> list{};
+    list.push_back(a);
+
+    object copy{ a };
+    EXPECT_EQ(copy.value, 1);
+    EXPECT_FALSE(copy.intrusive_list_node<>::is_linked());
+    EXPECT_EQ(list.size(), 1);
+}
@@ -0,0 +1,207 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/linked_list.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    struct counting_resource final : public memory_resource {
+        std::size_t allocations{ 0 };
+        std::size_t frees{ 0 };
+
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment) override {
+            ++allocations;
+            return memory::alloc(bytes, alignment);
+        }
+
+        void free(std::byte *&memory) override {
+            if(memory != nullptr) {
+                ++frees;
+            }
+            memory::free(memory);
+        }
+    };
+
+    template<typename list_t>
+    std::vector<std::int32_t> get_values(list_t const &list) {
+        return std::vector<std::int32_t>(list.begin(), list.end());
+    }
+}
+
+TEST(linked_list_tests, can_default_initialise) {
+    linked_list<std::int32_t> list{};
+
+    EXPECT_EQ(list.size(), 0);
+    EXPECT_EQ(list.capacity(), 0);
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+}
+
+TEST(linked_list_tests, can_push_and_pop_at_both_ends) {
+    linked_list<std::int32_t> list{};
+
+    list.push_back(2);
+    list.push_front(1);
+    list.emplace_back(3);
+    list.emplace_front(0);
+
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_EQ(list.front(), 0);
+    EXPECT_EQ(list.back(), 3);
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 0, 1, 2, 3 }));
+
+    std::vector<std::int32_t> reversed(list.rbegin(), list.rend());
+    EXPECT_EQ(reversed, (std::vector<std::int32_t>{ 3, 2, 1, 0 }));
+
+    list.pop_front();
+    list.pop_back();
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 1, 2 }));
+}
+
+TEST(linked_list_tests, can_insert_and_erase_in_the_middle) {
+    linked_list<std::int32_t> list{ 0, 2, 4 };
+
+    auto iter{ list.insert(std::next(list.begin()), 1) };
+    EXPECT_EQ(*iter, 1);
+    list.emplace(std::prev(list.end()), 3);
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 0, 1, 2, 3, 4 }));
+
+    iter = list.erase(std::next(list.begin()));
+    EXPECT_EQ(*iter, 2);
+    iter = list.erase(iter, std::prev(list.end()));
+    EXPECT_EQ(*iter, 4);
+    EXPECT_EQ(get_values(list), (std::vector<std::int32_t>{ 0, 4 }));
+}
+
+TEST(linked_list_tests, items_do_not_move) {
+    linked_list<std::int32_t> list{};
+
+    std::vector<std::int32_t *> items{};
+    for(std::int32_t i{ 0 }; i < 100; ++i) {
+        items.push_back(&list.emplace_back(i));
+    }
+
+    for(std::int32_t i{ 0 }; i < 100; i += 2) {
+        list.erase(list.iterator_to(*items[i]));
+    }
+
+    EXPECT_EQ(list.size(), 50);
+    for(std::int32_t i{ 1 }; i < 100; i += 2) {
+        EXPECT_EQ(*items[i], i);
+        EXPECT_EQ(&*list.iterator_to(*items[i]), items[i]);
+    }
+}
+
+TEST(linked_list_tests, nodes_are_handed_out_in_address_order) {
+    linked_list<std::uint64_t> list{};
+    list.reserve(64);
+
+    for(std::uint64_t i{ 0 }; i < 64; ++i) {
+        list.push_back(i);
+    }
+
+    EXPECT_EQ(list.capacity(), 64);
+
+    std::uint64_t const *previous{ nullptr };
+    for(auto const &item : list) {
+        if(previous != nullptr) {
+            EXPECT_LT(previous, &item);
+        }
+        previous = &item;
+    }
+}
+
+TEST(linked_list_tests, reuses_erased_nodes_without_allocating) {
+    counting_resource resource{};
+
+    {
+        linked_list<std::int32_t, polymorphic_allocator> list{ polymorphic_allocator{ resource } };
+        for(std::int32_t i{ 0 }; i < 100; ++i) {
+            list.push_back(i);
+        }
+        std::size_t const allocations{ resource.allocations };
+
+        //Repeatedly split and merge items like a free list of memory chunks would.
+        auto iter{ list.begin() };
+        for(std::int32_t round{ 0 }; round < 1000; ++round) {
+            list.erase(list.insert(std::next(iter), round));
+
+            if(++iter == list.end()) {
+                iter = list.begin();
+            }
+        }
+
+        EXPECT_EQ(resource.allocations, allocations);
+        EXPECT_EQ(list.size(), 100);
+
+        list.clear();
+        for(std::int32_t i{ 0 }; i < 100; ++i) {
+            list.push_back(i);
+        }
+        EXPECT_EQ(resource.allocations, allocations);
+    }
+
+    EXPECT_EQ(resource.allocations, resource.frees);
+}
+
+TEST(linked_list_tests, can_copy) {
+    linked_list<std::string> list{};
+    for(std::int32_t i{ 0 }; i < 50; ++i) {
+        list.push_back(std::to_string(i));
+    }
+
+    linked_list<std::string> copy{ list };
+    EXPECT_EQ(copy, list);
+    EXPECT_EQ(copy.capacity(), list.size());
+
+    copy.pop_front();
+    EXPECT_NE(copy, list);
+
+    copy = list;
+    EXPECT_EQ(copy, list);
+    EXPECT_EQ(copy.back(), "49");
+}
+
+TEST(linked_list_tests, can_move) {
+    linked_list<std::unique_ptr<std::int32_t>> list{};
+    for(std::int32_t i{ 0 }; i < 50; ++i) {
+        list.push_back(std::make_unique<std::int32_t>(i));
+    }
+    std::int32_t *const first{ list.front().get() };
+
+    linked_list<std::unique_ptr<std::int32_t>> moved{ std::move(list) };
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(moved.size(), 50);
+    EXPECT_EQ(moved.front().get(), first);
+
+    list = std::move(moved);
+    EXPECT_EQ(list.size(), 50);
+    EXPECT_EQ(*list.back(), 49);
+
+    //Moved from lists can still be used.
+    moved.push_back(std::make_unique<std::int32_t>(100));
+    EXPECT_EQ(*moved.front(), 100);
+}
+
+TEST(linked_list_tests, can_move_between_allocators) {
+    linear_allocator first_allocator{ EMBER_KB(4) };
+    linear_allocator second_allocator{ EMBER_KB(4) };
+
+    linked_list<std::unique_ptr<std::int32_t>, allocator_ref<linear_allocator>> first{ allocator_ref{ first_allocator } };
+    linked_list<std::unique_ptr<std::int32_t>, allocator_ref<linear_allocator>> second{ allocator_ref{ second_allocator } };
+    for(std::int32_t i{ 0 }; i < 10; ++i) {
+        first.push_back(std::make_unique<std::int32_t>(i));
+    }
+
+    second = std::move(first);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(second.size(), 10);
+    EXPECT_EQ(*second.back(), 9);
+    EXPECT_EQ(second.get_allocator(), allocator_ref{ second_allocator });
+}
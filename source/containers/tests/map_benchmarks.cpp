@@ -0,0 +1,152 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ember/containers/map.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr large_item_count{ 200000 };
+    std::size_t constexpr small_item_count{ 1000 };
+    std::size_t constexpr lookup_count{ 1000000 };
+
+    struct timings {
+        double insert{ 0.0 };
+        double lookup_hit{ 0.0 };
+        double lookup_miss{ 0.0 };
+        double erase{ 0.0 };
+    };
+
+    template<typename function_t>
+    double time_ms(function_t function) {
+        auto const start{ std::chrono::steady_clock::now() };
+        function();
+        auto const end{ std::chrono::steady_clock::now() };
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    /**
+     * @brief Runs the same workload against any map type with an unordered_map like interface.
+     * @param keys Keys to insert. misses must not contain any of them.
+     */
+    template<typename map_t, typename key_t>
+    timings run_map_workload(std::vector<key_t> const &keys, std::vector<key_t> const &misses) {
+        timings result{};
+        std::size_t checksum{ 0 };
+
+        map_t map{};
+
+        result.insert = time_ms([&]() {
+            for(std::size_t i{ 0 }; i < keys.size(); ++i) {
+                map.emplace(keys[i], i);
+            }
+        });
+        EXPECT_EQ(map.size(), keys.size());
+
+        std::size_t const lookup_rounds{ lookup_count / keys.size() };
+
+        result.lookup_hit = time_ms([&]() {
+            for(std::size_t round{ 0 }; round < lookup_rounds; ++round) {
+                for(auto const &key : keys) {
+                    checksum += map.find(key)->second;
+                }
+            }
+        });
+
+        result.lookup_miss = time_ms([&]() {
+            for(std::size_t round{ 0 }; round < lookup_rounds; ++round) {
+                for(auto const &key : misses) {
+                    checksum += map.find(key) == map.end() ? 1 : 0;
+                }
+            }
+        });
+
+        result.erase = time_ms([&]() {
+            for(auto const &key : keys) {
+                checksum += map.erase(key);
+            }
+        });
+        EXPECT_TRUE(map.empty());
+
+        EXPECT_NE(checksum, 0);
+
+        return result;
+    }
+
+    void print_timings(char const *name, timings const &result) {
+        std::printf("%-32s %12.2f %12.2f %12.2f %12.2f\n", name, result.insert, result.lookup_hit, result.lookup_miss, result.erase);
+    }
+
+    void print_header() {
+        std::printf("%-32s %12s %12s %12s %12s\n", "", "insert ms", "hit ms", "miss ms", "erase ms");
+    }
+
+    std::vector<std::uint32_t> make_sequential_keys(std::size_t const item_count, std::uint32_t const first) {
+        std::vector<std::uint32_t> keys(item_count);
+        for(std::size_t i{ 0 }; i < item_count; ++i) {
+            keys[i] = first + static_cast<std::uint32_t>(i);
+        }
+        return keys;
+    }
+
+    std::vector<std::uint32_t> make_random_keys(std::size_t const item_count, std::uint32_t const offset) {
+        //Multiplying by an odd number and xor shifting are both reversible so every key is unique.
+        std::vector<std::uint32_t> keys(item_count);
+        for(std::size_t i{ 0 }; i < item_count; ++i) {
+            std::uint32_t key{ (static_cast<std::uint32_t>(i) * 2 + offset) * 2654435761u };
+            keys[i] = key ^ (key >> 16);
+        }
+        return keys;
+    }
+
+    std::vector<std::string> make_string_keys(std::size_t const item_count, char const *prefix) {
+        std::vector<std::string> keys(item_count);
+        for(std::size_t i{ 0 }; i < item_count; ++i) {
+            keys[i] = prefix + std::to_string(i);
+        }
+        return keys;
+    }
+}
+
+TEST(map_benchmarks, sequential_integer_keys) {
+    //Entity ids are handed out sequentially. This is std::unordered_map's best case as the identity hash puts
+    //consecutive keys in consecutive buckets.
+    for(std::size_t const item_count : { small_item_count, large_item_count }) {
+        std::vector<std::uint32_t> const keys{ make_sequential_keys(item_count, 1) };
+        std::vector<std::uint32_t> const misses{ make_sequential_keys(item_count, static_cast<std::uint32_t>(item_count) + 1) };
+
+        std::printf("%zu items\n", item_count);
+        print_header();
+        print_timings("ember::map", run_map_workload<map<std::uint32_t, std::size_t>>(keys, misses));
+        print_timings("std::unordered_map", run_map_workload<std::unordered_map<std::uint32_t, std::size_t>>(keys, misses));
+    }
+}
+
+TEST(map_benchmarks, random_integer_keys) {
+    for(std::size_t const item_count : { small_item_count, large_item_count }) {
+        std::vector<std::uint32_t> const keys{ make_random_keys(item_count, 0) };
+        std::vector<std::uint32_t> const misses{ make_random_keys(item_count, 1) };
+
+        std::printf("%zu items\n", item_count);
+        print_header();
+        print_timings("ember::map", run_map_workload<map<std::uint32_t, std::size_t>>(keys, misses));
+        print_timings("std::unordered_map", run_map_workload<std::unordered_map<std::uint32_t, std::size_t>>(keys, misses));
+    }
+}
+
+TEST(map_benchmarks, string_keys) {
+    for(std::size_t const item_count : { small_item_count, large_item_count }) {
+        std::vector<std::string> const keys{ make_string_keys(item_count, "shaders/forward_pass_") };
+        std::vector<std::string> const misses{ make_string_keys(item_count, "shaders/shadow_pass_") };
+
+        std::printf("%zu items\n", item_count);
+        print_header();
+        print_timings("ember::map", run_map_workload<map<std::string, std::size_t>>(keys, misses));
+        print_timings("std::unordered_map", run_map_workload<std::unordered_map<std::string, std::size_t>>(keys, misses));
+    }
+}
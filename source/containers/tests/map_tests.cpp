@@ -0,0 +1,211 @@
+#include <ember/containers/map.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_map>
+
+using namespace ember;
+
+TEST(map_tests, can_default_initialise) {
+    map<std::uint32_t, std::uint32_t> map{};
+
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(map.begin(), map.end());
+    EXPECT_FALSE(map.contains(0));
+}
+
+TEST(map_tests, can_insert_and_find_items) {
+    std::size_t constexpr item_count{ 1000 };
+    map<std::size_t, std::size_t> map{};
+
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        auto const [iter, inserted]{ map.emplace(i, i * 2) };
+        EXPECT_TRUE(inserted);
+        EXPECT_EQ(iter->first, i);
+        EXPECT_EQ(iter->second, i * 2);
+    }
+
+    EXPECT_EQ(map.size(), item_count);
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        ASSERT_TRUE(map.contains(i));
+        EXPECT_EQ(map.at(i), i * 2);
+        EXPECT_EQ(map.find(i)->second, i * 2);
+    }
+    EXPECT_FALSE(map.contains(item_count));
+    EXPECT_EQ(map.find(item_count), map.end());
+}
+
+TEST(map_tests, does_not_replace_existing_items) {
+    map<std::uint32_t, std::string> map{};
+
+    EXPECT_TRUE(map.emplace(1u, "one").second);
+    EXPECT_FALSE(map.emplace(1u, "uno").second);
+    EXPECT_FALSE(map.try_emplace(1u, "eins").second);
+    EXPECT_FALSE(map.insert({ 1u, "un" }).second);
+
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.at(1), "one");
+}
+
+TEST(map_tests, can_index_into_map) {
+    map<std::string, std::int32_t> map{};
+
+    map["a"] = 1;
+    map["b"] = 2;
+    map["a"] += 10;
+
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map["a"], 11);
+    EXPECT_EQ(map["b"], 2);
+    EXPECT_EQ(map["c"], 0);
+    EXPECT_EQ(map.size(), 3);
+}
+
+TEST(map_tests, can_erase_items) {
+    std::size_t constexpr item_count{ 500 };
+    map<std::size_t, std::string> map{};
+
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        map[i] = std::to_string(i);
+    }
+
+    for(std::size_t i{ 0 }; i < item_count; i += 2) {
+        EXPECT_EQ(map.erase(i), 1);
+    }
+    EXPECT_EQ(map.erase(0), 0);
+
+    EXPECT_EQ(map.size(), item_count / 2);
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        EXPECT_EQ(map.contains(i), i % 2 != 0);
+    }
+
+    //Erased slots should be reusable.
+    for(std::size_t i{ 0 }; i < item_count; i += 2) {
+        map[i] = std::to_string(i);
+    }
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        EXPECT_EQ(map.at(i), std::to_string(i));
+    }
+}
+
+TEST(map_tests, can_erase_while_iterating) {
+    map<std::int32_t, std::int32_t> map{};
+    for(std::int32_t i{ 0 }; i < 100; ++i) {
+        map[i] = i;
+    }
+
+    for(auto iter{ map.begin() }; iter != map.end();) {
+        if(iter->second % 3 == 0) {
+            iter = map.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    EXPECT_EQ(map.size(), 66);
+    for(auto const &[key, value] : map) {
+        EXPECT_NE(value % 3, 0);
+    }
+}
+
+TEST(map_tests, can_iterate_over_map) {
+    std::size_t constexpr item_count{ 300 };
+    map<std::size_t, std::size_t> map{};
+
+    for(std::size_t i{ 0 }; i < item_count; ++i) {
+        map[i] = i;
+    }
+
+    std::size_t count{ 0 };
+    std::size_t sum{ 0 };
+    for(auto &[key, value] : map) {
+        EXPECT_EQ(key, value);
+        value *= 2;
+
+        sum += key;
+        ++count;
+    }
+
+    EXPECT_EQ(count, item_count);
+    EXPECT_EQ(sum, (item_count * (item_count - 1)) / 2);
+    EXPECT_EQ(map.at(10), 20);
+}
+
+TEST(map_tests, can_churn_inserts_and_erases) {
+    //Repeatedly filling and emptying fills the map with deleted slots which need to be cleaned up.
+    map<std::uint32_t, std::uint32_t> map{};
+    std::unordered_map<std::uint32_t, std::uint32_t> expected{};
+
+    std::uint32_t seed{ 1 };
+    for(std::uint32_t i{ 0 }; i < 100000; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        std::uint32_t const key{ (seed >> 8) % 2048 };
+
+        if(seed & 1) {
+            map[key]      = i;
+            expected[key] = i;
+        } else {
+            EXPECT_EQ(map.erase(key), expected.erase(key));
+        }
+    }
+
+    EXPECT_EQ(map.size(), expected.size());
+    EXPECT_LE(map.capacity(), 4096);
+    for(auto const &[key, value] : expected) {
+        EXPECT_EQ(map.at(key), value);
+    }
+}
+
+TEST(map_tests, can_copy_and_move) {
+    map<std::string, std::string> original{
+        { "a", "1" },
+        { "b", "2" },
+        { "c", "3" },
+    };
+
+    map<std::string, std::string> copy{ original };
+    EXPECT_EQ(copy, original);
+
+    copy["d"] = "4";
+    EXPECT_NE(copy, original);
+    EXPECT_FALSE(original.contains("d"));
+
+    map<std::string, std::string> moved{ std::move(copy) };
+    EXPECT_EQ(moved.size(), 4);
+    EXPECT_EQ(moved.at("d"), "4");
+    EXPECT_TRUE(copy.empty());
+
+    copy = moved;
+    EXPECT_EQ(copy, moved);
+
+    original = std::move(moved);
+    EXPECT_EQ(original, copy);
+    EXPECT_TRUE(moved.empty());
+}
+
+TEST(map_tests, can_reserve) {
+    map<std::uint32_t, std::uint32_t> map{};
+    map.reserve(1000);
+
+    std::size_t const capacity{ map.capacity() };
+    EXPECT_GE(capacity, 1000);
+
+    for(std::uint32_t i{ 0 }; i < 1000; ++i) {
+        map[i] = i;
+    }
+    EXPECT_EQ(map.capacity(), capacity);
+}
+
+TEST(map_tests, can_use_custom_allocator) {
+    linear_allocator arena{ EMBER_KB(64) };
+    map<std::uint32_t, std::uint32_t, std::hash<std::uint32_t>, std::equal_to<std::uint32_t>, allocator_ref<linear_allocator>> map{ arena };
+
+    for(std::uint32_t i{ 0 }; i < 100; ++i) {
+        map[i] = i;
+    }
+
+    EXPECT_EQ(map.size(), 100);
+    EXPECT_EQ(map.at(50), 50);
+    EXPECT_EQ(&map.get_allocator().get(), &arena);
+}
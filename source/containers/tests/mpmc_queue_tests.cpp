@@ -0,0 +1,117 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/mpmc_queue.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+TEST(mpmc_queue_tests, rounds_capacity_to_power_of_two) {
+    mpmc_queue<std::int32_t> queue{ 100 };
+
+    EXPECT_EQ(queue.capacity(), 128);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_queue_tests, can_push_and_pop_in_order) {
+    mpmc_queue<std::int32_t> queue{ 2 };
+
+    EXPECT_TRUE(queue.try_push(1));
+    EXPECT_TRUE(queue.try_emplace(2));
+    EXPECT_FALSE(queue.try_push(3));
+    EXPECT_EQ(queue.size(), 2);
+
+    EXPECT_EQ(queue.try_pop(), 1);
+    EXPECT_TRUE(queue.try_push(3));
+    EXPECT_EQ(queue.try_pop(), 2);
+    EXPECT_EQ(queue.try_pop(), 3);
+    EXPECT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(mpmc_queue_tests, can_push_and_pop_batches) {
+    mpmc_queue<std::int32_t> queue{ 8 };
+
+    std::array<std::int32_t, 6> constexpr batch{ 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.try_push(batch.begin(), batch.end()), 6);
+    EXPECT_EQ(queue.try_push(batch.begin(), batch.end()), 2);
+
+    std::array<std::int32_t, 4> popped{};
+    EXPECT_EQ(queue.try_pop(popped.begin(), popped.size()), 4);
+    EXPECT_EQ(popped, (std::array<std::int32_t, 4>{ 0, 1, 2, 3 }));
+
+    EXPECT_EQ(queue.try_push(batch.begin(), batch.end()), 4);
+
+    std::vector<std::int32_t> rest{};
+    EXPECT_EQ(queue.try_pop(std::back_inserter(rest), 100), 8);
+    EXPECT_EQ(rest, (std::vector<std::int32_t>{ 4, 5, 0, 1, 0, 1, 2, 3 }));
+}
+
+TEST(mpmc_queue_tests, destroys_remaining_items) {
+    auto counter{ std::make_shared<std::int32_t>(0) };
+
+    {
+        mpmc_queue<std::shared_ptr<std::int32_t>> queue{ 4 };
+        queue.try_push(counter);
+        queue.try_push(counter);
+        EXPECT_EQ(counter.use_count(), 3);
+    }
+
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(mpmc_queue_tests, every_item_is_popped_exactly_once) {
+    std::uint32_t constexpr thread_count{ 4 };
+    std::uint64_t constexpr items_per_producer{ 50000 };
+
+    mpmc_queue<std::uint64_t> queue{ 256 };
+    std::vector<std::atomic<std::uint32_t>> seen(thread_count * items_per_producer);
+    std::atomic<std::uint64_t> popped_count{ 0 };
+
+    std::vector<std::thread> threads{};
+    for(std::uint32_t producer{ 0 }; producer < thread_count; ++producer) {
+        threads.emplace_back([&queue, producer]() {
+            std::array<std::uint64_t, 8> batch{};
+            for(std::uint64_t i{ 0 }; i < items_per_producer;) {
+                //Alternate between single and batched pushes so both paths race each other.
+                if(i % 2 == 0) {
+                    i += queue.try_push(producer * items_per_producer + i) ? 1 : 0;
+                } else {
+                    std::size_t const count{ std::min<std::size_t>(batch.size(), items_per_producer - i) };
+                    for(std::size_t j{ 0 }; j < count; ++j) {
+                        batch[j] = producer * items_per_producer + i + j;
+                    }
+                    i += queue.try_push(batch.begin(), batch.begin() + count);
+                }
+                std::this_thread::yield();
+            }
+        });
+    }
+    for(std::uint32_t consumer{ 0 }; consumer < thread_count; ++consumer) {
+        threads.emplace_back([&]() {
+            std::array<std::uint64_t, 8> batch{};
+            while(popped_count.load() < thread_count * items_per_producer) {
+                std::size_t const count{ queue.try_pop(batch.begin(), batch.size()) };
+                if(count == 0) {
+                    std::this_thread::yield();
+                }
+                for(std::size_t j{ 0 }; j < count; ++j) {
+                    seen[batch[j]].fetch_add(1);
+                }
+                popped_count.fetch_add(count);
+            }
+        });
+    }
+    for(auto &thread : threads) {
+        thread.join();
+    }
+
+    for(auto const &count : seen) {
+        EXPECT_EQ(count.load(), 1);
+    }
+    EXPECT_TRUE(queue.empty());
+}
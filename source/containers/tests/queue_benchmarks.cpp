@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ember/containers/mpmc_queue.hpp>
+#include <ember/containers/queue.hpp>
+#include <ember/containers/spsc_queue.hpp>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::uint64_t constexpr items_per_producer{ 200000 };
+    std::size_t constexpr queue_capacity{ 1024 };
+    std::size_t constexpr batch_size{ 32 };
+
+    /**
+     * @brief What a queue would look like without lock-free support. Used as a baseline.
+     */
+    class locked_queue {
+    private:
+        std::mutex mutex{};
+        queue<std::uint64_t> items{};
+
+    public:
+        bool try_push(std::uint64_t const item) {
+            std::scoped_lock lock{ mutex };
+            if(items.size() >= queue_capacity) {
+                return false;
+            }
+            items.push(item);
+            return true;
+        }
+
+        std::optional<std::uint64_t> try_pop() {
+            std::scoped_lock lock{ mutex };
+            if(items.empty()) {
+                return std::nullopt;
+            }
+            std::uint64_t const item{ items.front() };
+            items.pop();
+            return item;
+        }
+    };
+
+    /**
+     * @brief Runs producer_count threads pushing items_per_producer items each and consumer_count threads
+     * popping them until every item has been seen.
+     * @return Returns millions of items passed through the queue per second.
+     */
+    template<typename queue_t, typename push_function_t, typename pop_function_t>
+    double run_throughput(queue_t &queue, std::uint32_t const producer_count, std::uint32_t const consumer_count, push_function_t push, pop_function_t pop) {
+        std::uint64_t const total_items{ items_per_producer * producer_count };
+        std::atomic<std::uint64_t> popped_count{ 0 };
+        std::atomic<std::uint64_t> checksum{ 0 };
+
+        std::vector<std::thread> threads{};
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::uint32_t i{ 0 }; i < producer_count; ++i) {
+            threads.emplace_back([&queue, push]() {
+                push(queue);
+            });
+        }
+        for(std::uint32_t i{ 0 }; i < consumer_count; ++i) {
+            threads.emplace_back([&, pop]() {
+                std::uint64_t local_checksum{ 0 };
+                while(popped_count.load(std::memory_order_relaxed) < total_items) {
+                    std::uint64_t const count{ pop(queue, local_checksum) };
+                    if(count == 0) {
+                        std::this_thread::yield();//Don't starve the producers when there are more threads than cores.
+                    }
+                    popped_count.fetch_add(count, std::memory_order_relaxed);
+                }
+                checksum.fetch_add(local_checksum);
+            });
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        //Every producer pushes 1..items_per_producer.
+        EXPECT_EQ(checksum.load(), producer_count * (items_per_producer * (items_per_producer + 1) / 2));
+
+        double const seconds{ std::chrono::duration<double>(end - start).count() };
+        return (static_cast<double>(total_items) / 1000000.0) / seconds;
+    }
+
+    template<typename queue_t>
+    void push_single(queue_t &queue) {
+        for(std::uint64_t i{ 1 }; i <= items_per_producer;) {
+            if(queue.try_push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    template<typename queue_t>
+    void push_batched(queue_t &queue) {
+        std::array<std::uint64_t, batch_size> batch{};
+        for(std::uint64_t i{ 1 }; i <= items_per_producer;) {
+            std::size_t const count{ static_cast<std::size_t>(std::min<std::uint64_t>(batch_size, items_per_producer - i + 1)) };
+            for(std::size_t j{ 0 }; j < count; ++j) {
+                batch[j] = i + j;
+            }
+            std::size_t const pushed{ queue.try_push(batch.begin(), batch.begin() + count) };
+            if(pushed == 0) {
+                std::this_thread::yield();
+            }
+            i += pushed;
+        }
+    }
+
+    template<typename queue_t>
+    std::uint64_t pop_single(queue_t &queue, std::uint64_t &checksum) {
+        if(auto item{ queue.try_pop() }) {
+            checksum += *item;
+            return 1;
+        }
+        return 0;
+    }
+
+    template<typename queue_t>
+    std::uint64_t pop_batched(queue_t &queue, std::uint64_t &checksum) {
+        std::array<std::uint64_t, batch_size> batch{};
+        std::size_t const count{ queue.try_pop(batch.begin(), batch.size()) };
+        for(std::size_t j{ 0 }; j < count; ++j) {
+            checksum += batch[j];
+        }
+        return count;
+    }
+}
+
+TEST(queue_benchmarks, spsc_throughput) {
+    std::printf("%16s %20s\n", "queue", "M items / second");
+
+    {
+        locked_queue queue{};
+        std::printf("%16s %20.2f\n", "mutex + queue", run_throughput(queue, 1, 1, push_single<locked_queue>, pop_single<locked_queue>));
+    }
+    {
+        spsc_queue<std::uint64_t> queue{ queue_capacity };
+        std::printf("%16s %20.2f\n", "spsc", run_throughput(queue, 1, 1, push_single<spsc_queue<std::uint64_t>>, pop_single<spsc_queue<std::uint64_t>>));
+    }
+    {
+        spsc_queue<std::uint64_t> queue{ queue_capacity };
+        std::printf("%16s %20.2f\n", "spsc batched", run_throughput(queue, 1, 1, push_batched<spsc_queue<std::uint64_t>>, pop_batched<spsc_queue<std::uint64_t>>));
+    }
+}
+
+TEST(queue_benchmarks, mpmc_throughput_across_thread_counts) {
+    std::printf("%10s %10s %20s %20s %20s\n", "producers", "consumers", "mutex M items / s", "mpmc M items / s", "batched M items / s");
+
+    std::array<std::pair<std::uint32_t, std::uint32_t>, 6> constexpr configurations{ { { 1, 1 }, { 1, 4 }, { 4, 1 }, { 2, 2 }, { 4, 4 }, { 8, 8 } } };
+    for(auto const &[producer_count, consumer_count] : configurations) {
+        double locked_throughput{ 0.0 };
+        double mpmc_throughput{ 0.0 };
+        double batched_throughput{ 0.0 };
+
+        {
+            locked_queue queue{};
+            locked_throughput = run_throughput(queue, producer_count, consumer_count, push_single<locked_queue>, pop_single<locked_queue>);
+        }
+        {
+            mpmc_queue<std::uint64_t> queue{ queue_capacity };
+            mpmc_throughput = run_throughput(queue, producer_count, consumer_count, push_single<mpmc_queue<std::uint64_t>>, pop_single<mpmc_queue<std::uint64_t>>);
+        }
+        {
+            mpmc_queue<std::uint64_t> queue{ queue_capacity };
+            batched_throughput = run_throughput(queue, producer_count, consumer_count, push_batched<mpmc_queue<std::uint64_t>>, pop_batched<mpmc_queue<std::uint64_t>>);
+        }
+
+        std::printf("%10u %10u %20.2f %20.2f %20.2f\n", producer_count, consumer_count, locked_throughput, mpmc_throughput, batched_throughput);
+    }
+}
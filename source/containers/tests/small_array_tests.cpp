@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <ember/containers/small_array.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace ember;
+
+TEST(small_array_tests, can_default_initialise) {
+    small_array<std::uint32_t, 4> arr{};
+
+    EXPECT_EQ(arr.size(), 0);
+    EXPECT_EQ(arr.capacity(), 4);
+    EXPECT_TRUE(arr.is_inline());
+}
+
+TEST(small_array_tests, can_initialiser_list_initialise) {
+    small_array<std::uint32_t, 4> arr{ 0, 1, 2 };
+
+    ASSERT_EQ(arr.size(), 3);
+    EXPECT_TRUE(arr.is_inline());
+    for(std::uint32_t i{ 0 }; i < arr.size(); ++i) {
+        EXPECT_EQ(arr[i], i);
+    }
+}
+
+TEST(small_array_tests, spills_when_inline_storage_is_full) {
+    small_array<std::uint32_t, 4> arr{};
+
+    for(std::uint32_t i{ 0 }; i < 4; ++i) {
+        arr.push_back(i);
+    }
+    EXPECT_TRUE(arr.is_inline());
+
+    arr.push_back(4);
+    EXPECT_FALSE(arr.is_inline());
+    EXPECT_GE(arr.capacity(), 5);
+
+    for(std::uint32_t i{ 5 }; i < 64; ++i) {
+        arr.push_back(i);
+    }
+
+    ASSERT_EQ(arr.size(), 64);
+    for(std::uint32_t i{ 0 }; i < arr.size(); ++i) {
+        EXPECT_EQ(arr[i], i);
+    }
+}
+
+TEST(small_array_tests, can_iterate_and_sort) {
+    small_array<std::uint32_t, 8> arr{ 5, 3, 7, 1 };
+
+    std::sort(arr.begin(), arr.end());
+
+    std::uint32_t previous{ 0 };
+    for(std::uint32_t const val : arr) {
+        EXPECT_GT(val, previous);
+        previous = val;
+    }
+    EXPECT_EQ(arr, (small_array<std::uint32_t, 8>{ 1, 3, 5, 7 }));
+}
+
+TEST(small_array_tests, can_insert_and_erase) {
+    small_array<std::string, 2> arr{ "a", "d" };
+    std::vector<std::string> const middle{ "b", "c" };
+
+    auto iter{ arr.insert(arr.begin() + 1, middle.begin(), middle.end()) };
+    EXPECT_EQ(*iter, "b");
+    EXPECT_EQ(arr, (small_array<std::string, 2>{ "a", "b", "c", "d" }));
+
+    arr.erase(arr.begin());
+    arr.erase(std::string{ "c" });
+    EXPECT_EQ(arr, (small_array<std::string, 2>{ "b", "d" }));
+
+    arr.pop_back();
+    ASSERT_EQ(arr.size(), 1);
+    EXPECT_EQ(arr.back(), "b");
+}
+
+TEST(small_array_tests, calls_destructor) {
+    struct helper_type {
+        std::uint32_t &count;
+        helper_type(std::uint32_t &count)
+            : count{ count } {};
+        helper_type(helper_type const &other) = default;
+        ~helper_type() {
+            ++count;
+        };
+    };
+
+    std::uint32_t count{ 0 };
+    {
+        small_array<helper_type, 2> arr{};
+        arr.emplace_back(count);
+        arr.emplace_back(count);
+    }
+    EXPECT_EQ(count, 2);
+}
+
+TEST(small_array_tests, can_copy_and_move_inline_items) {
+    small_array<std::string, 4> arr_1{ "a", "b" };
+
+    small_array<std::string, 4> arr_2{ arr_1 };
+    EXPECT_EQ(arr_1, arr_2);
+
+    small_array<std::string, 4> arr_3{ std::move(arr_1) };
+    EXPECT_EQ(arr_3, arr_2);
+    EXPECT_TRUE(arr_3.is_inline());
+    EXPECT_TRUE(arr_1.empty());
+
+    arr_1 = std::move(arr_3);
+    EXPECT_EQ(arr_1, arr_2);
+    EXPECT_TRUE(arr_3.empty());
+}
+
+TEST(small_array_tests, moving_spilled_array_takes_memory) {
+    small_array<std::string, 2> arr_1{ "a", "b", "c" };
+    ASSERT_FALSE(arr_1.is_inline());
+    std::string const *const data{ arr_1.data() };
+
+    small_array<std::string, 2> arr_2{ std::move(arr_1) };
+    EXPECT_EQ(arr_2.data(), data);
+    EXPECT_TRUE(arr_1.is_inline());
+    EXPECT_TRUE(arr_1.empty());
+
+    small_array<std::string, 2> arr_3{ "d" };
+    arr_3 = std::move(arr_2);
+    EXPECT_EQ(arr_3.data(), data);
+    EXPECT_EQ(arr_3, (small_array<std::string, 2>{ "a", "b", "c" }));
+
+    arr_1 = arr_3;
+    EXPECT_EQ(arr_1, arr_3);
+    EXPECT_NE(arr_1.data(), arr_3.data());
+}
+
+TEST(small_array_tests, can_resize) {
+    small_array<std::uint32_t, 4> arr{};
+
+    arr.resize(2, 7u);
+    EXPECT_TRUE(arr.is_inline());
+    EXPECT_EQ(arr, (small_array<std::uint32_t, 4>{ 7, 7 }));
+
+    arr.resize(6, 9u);
+    EXPECT_FALSE(arr.is_inline());
+    EXPECT_EQ(arr, (small_array<std::uint32_t, 4>{ 7, 7, 9, 9, 9, 9 }));
+
+    arr.resize(1);
+    EXPECT_EQ(arr.size(), 1);
+}
+
+TEST(small_array_tests, only_allocates_once_spilled) {
+    struct counting_resource final : public memory_resource {
+        std::size_t allocations{ 0 };
+        std::size_t frees{ 0 };
+
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment) override {
+            ++allocations;
+            return memory::alloc(bytes, alignment);
+        }
+
+        void free(std::byte *&memory) override {
+            ++frees;
+            memory::free(memory);
+        }
+    };
+
+    counting_resource resource{};
+
+    {
+        small_array<std::uint32_t, 8, polymorphic_allocator> arr{ polymorphic_allocator{ resource } };
+        for(std::uint32_t i{ 0 }; i < 8; ++i) {
+            arr.push_back(i);
+        }
+        EXPECT_EQ(resource.allocations, 0);
+
+        arr.push_back(8);
+        EXPECT_EQ(resource.allocations, 1);
+        EXPECT_EQ(&arr.get_allocator().get_resource(), &resource);
+    }
+
+    EXPECT_EQ(resource.allocations, resource.frees);
+}
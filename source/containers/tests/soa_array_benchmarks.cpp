@@ -0,0 +1,119 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ember/containers/array.hpp>
+#include <ember/containers/soa_array.hpp>
+#include <gtest/gtest.h>
+#include <span>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr iteration_count{ 100 };
+    float constexpr delta_time{ 1.0f / 60.0f };
+
+    struct particle {
+        float position_x{ 0.0f };
+        float position_y{ 0.0f };
+        float position_z{ 0.0f };
+        float velocity_x{ 0.0f };
+        float velocity_y{ 0.0f };
+        float velocity_z{ 0.0f };
+        float lifetime{ 0.0f };
+        std::uint32_t colour{ 0 };
+    };
+
+    using particle_soa = soa_array<float, float, float, float, float, float, float, std::uint32_t>;
+
+    template<std::size_t extent>
+    void integrate(std::span<float, extent> positions, std::span<float, extent> velocities) {
+        for(std::size_t i{ 0 }; i < positions.size(); ++i) {
+            positions[i] += velocities[i] * delta_time;
+        }
+    }
+
+    template<typename function_t>
+    double time_ms(function_t function) {
+        auto const start{ std::chrono::steady_clock::now() };
+        function();
+        auto const end{ std::chrono::steady_clock::now() };
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+}
+
+TEST(soa_array_benchmarks, particle_update_against_array_of_structs) {
+    std::printf("%10s %16s %16s %16s %16s %16s\n", "particles", "aos update ms", "field update ms", "chunk update ms", "aos cull ms", "soa cull ms");
+
+    for(std::size_t const particle_count : { 1000u, 100000u, 1000000u }) {
+        array<particle> aos{};
+        particle_soa soa{};
+        aos.reserve(particle_count);
+        soa.reserve(particle_count);
+
+        for(std::size_t i{ 0 }; i < particle_count; ++i) {
+            float const value{ static_cast<float>(i % 1000) };
+            aos.push_back(particle{ value, value, value, 1.0f, 2.0f, 3.0f, value, 0xffffffff });
+            soa.emplace_back(value, value, value, 1.0f, 2.0f, 3.0f, value, 0xffffffffu);
+        }
+
+        particle_soa chunked{ soa };
+
+        //Integrating touches six of the eight fields.
+        double const aos_update{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                for(particle &p : aos) {
+                    p.position_x += p.velocity_x * delta_time;
+                    p.position_y += p.velocity_y * delta_time;
+                    p.position_z += p.velocity_z * delta_time;
+                }
+            }
+        }) };
+
+        //Each field is updated in its own loop so the compiler only has to reason about two streams at a time.
+        double const soa_field_update{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                integrate(soa.get_field<0>(), soa.get_field<3>());
+                integrate(soa.get_field<1>(), soa.get_field<4>());
+                integrate(soa.get_field<2>(), soa.get_field<5>());
+            }
+        }) };
+
+        double const soa_chunk_update{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                chunked.for_each_chunk<16>([](auto chunk) {
+                    integrate(chunk.template get<0>(), chunk.template get<3>());
+                    integrate(chunk.template get<1>(), chunk.template get<4>());
+                    integrate(chunk.template get<2>(), chunk.template get<5>());
+                });
+            }
+        }) };
+
+        //Culling only reads one field.
+        std::size_t aos_alive{ 0 };
+        double const aos_cull{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                for(particle const &p : aos) {
+                    aos_alive += p.lifetime > 500.0f ? 1 : 0;
+                }
+            }
+        }) };
+
+        std::size_t soa_alive{ 0 };
+        double const soa_cull{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                for(float const lifetime : soa.get_field<6>()) {
+                    soa_alive += lifetime > 500.0f ? 1 : 0;
+                }
+            }
+        }) };
+
+        EXPECT_EQ(aos_alive, soa_alive);
+        for(std::size_t i{ 0 }; i < particle_count; i += particle_count / 10) {
+            EXPECT_FLOAT_EQ(aos[i].position_y, soa[i].get<1>());
+            EXPECT_FLOAT_EQ(aos[i].position_y, chunked[i].get<1>());
+        }
+
+        std::printf("%10zu %16.2f %16.2f %16.2f %16.2f %16.2f\n", particle_count, aos_update, soa_field_update, soa_chunk_update, aos_cull, soa_cull);
+    }
+}
@@ -0,0 +1,223 @@
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/soa_array.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <tuple>
+
+using namespace ember;
+
+TEST(soa_array_tests, can_default_initialise) {
+    soa_array<float, std::uint32_t> array{};
+
+    EXPECT_EQ(array.size(), 0);
+    EXPECT_EQ(array.capacity(), 0);
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(array.begin(), array.end());
+}
+
+TEST(soa_array_tests, can_access_items_through_proxies) {
+    soa_array<float, std::uint32_t, std::string> array{};
+
+    array.push_back(1.0f, 1u, "one");
+    array.emplace_back(2.0f, 2u, "two");
+    array.push_back(std::tuple{ 3.0f, 3u, std::string{ "three" } });
+
+    EXPECT_EQ(array.size(), 3);
+    EXPECT_EQ(array[1].get<0>(), 2.0f);
+    EXPECT_EQ(array[2].get<2>(), "three");
+
+    //Structured bindings refer to the values in the array.
+    auto [value, index, name]{ array[0] };
+    value = 10.0f;
+    name += "!";
+    EXPECT_EQ(array.front().get<0>(), 10.0f);
+    EXPECT_EQ(array.front().get<2>(), "one!");
+
+    array[2] = std::tuple{ 30.0f, 30u, std::string{ "thirty" } };
+    std::tuple<float, std::uint32_t, std::string> const back{ array.back() };
+    EXPECT_EQ(back, std::tuple(30.0f, 30u, std::string{ "thirty" }));
+
+    //Assigning one proxy to another copies the values, not the references.
+    array[1] = array[2];
+    EXPECT_EQ(array[1].get<2>(), "thirty");
+    array[2].get<2>() = "changed";
+    EXPECT_EQ(array[1].get<2>(), "thirty");
+}
+
+TEST(soa_array_tests, fields_are_separate_aligned_streams) {
+    soa_array<float, double, std::uint8_t> array{};
+    for(std::size_t i{ 0 }; i < 100; ++i) {
+        array.emplace_back(static_cast<float>(i), static_cast<double>(i) * 2.0, static_cast<std::uint8_t>(i));
+    }
+
+    std::span<float> const floats{ array.get_field<0>() };
+    std::span<double> const doubles{ array.get_field<1>() };
+    std::span<std::uint8_t> const bytes{ array.get_field<2>() };
+
+    EXPECT_EQ(floats.size(), 100);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(floats.data()) % cache_line_size, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(doubles.data()) % cache_line_size, 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(bytes.data()) % cache_line_size, 0);
+    EXPECT_EQ(array.capacity() % soa_array<float>::max_lanes, 0);
+
+    for(std::size_t i{ 0 }; i < 100; ++i) {
+        EXPECT_EQ(floats[i], static_cast<float>(i));
+        EXPECT_EQ(doubles[i], static_cast<double>(i) * 2.0);
+        EXPECT_EQ(bytes[i], static_cast<std::uint8_t>(i));
+    }
+}
+
+TEST(soa_array_tests, erase_keeps_items_in_order) {
+    soa_array<std::int32_t, std::string> array{};
+    for(std::int32_t i{ 0 }; i < 5; ++i) {
+        array.emplace_back(i, std::to_string(i));
+    }
+
+    array.erase(1);
+    array.erase(3);
+
+    ASSERT_EQ(array.size(), 3);
+    EXPECT_EQ(array[0].get<1>(), "0");
+    EXPECT_EQ(array[1].get<1>(), "2");
+    EXPECT_EQ(array[2].get<1>(), "3");
+    EXPECT_EQ(array[2].get<0>(), 3);
+
+    array.pop_back();
+    EXPECT_EQ(array.back().get<1>(), "2");
+}
+
+TEST(soa_array_tests, swap_remove_moves_the_last_item) {
+    soa_array<std::int32_t, std::unique_ptr<std::int32_t>> array{};
+    for(std::int32_t i{ 0 }; i < 5; ++i) {
+        array.emplace_back(i, std::make_unique<std::int32_t>(i));
+    }
+
+    array.swap_remove(1);
+    ASSERT_EQ(array.size(), 4);
+    EXPECT_EQ(array[1].get<0>(), 4);
+    EXPECT_EQ(*array[1].get<1>(), 4);
+
+    array.swap_remove(3);
+    ASSERT_EQ(array.size(), 3);
+    EXPECT_EQ(array.back().get<0>(), 2);
+}
+
+TEST(soa_array_tests, chunks_cover_every_item) {
+    soa_array<float, float> array{};
+    for(std::size_t i{ 0 }; i < 37; ++i) {
+        array.emplace_back(static_cast<float>(i), 1.0f);
+    }
+
+    auto const check_chunks{ [&]<std::size_t lanes>(std::integral_constant<std::size_t, lanes>) {
+        std::size_t visited{ 0 };
+        float sum{ 0.0f };
+
+        array.for_each_chunk<lanes>([&](soa_chunk<lanes, float, float> chunk) {
+            EXPECT_EQ(chunk.get_first(), visited);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(chunk.template get<0>().data()) % (lanes * sizeof(float)), 0);
+
+            //Kernels run over every lane, including the padding in the last chunk.
+            std::span<float, lanes> const positions{ chunk.template get<0>() };
+            std::span<float, lanes> const velocities{ chunk.template get<1>() };
+            for(std::size_t i{ 0 }; i < lanes; ++i) {
+                positions[i] += velocities[i];
+            }
+
+            for(std::size_t i{ 0 }; i < chunk.size(); ++i) {
+                sum += positions[i];
+            }
+            visited += chunk.size();
+        });
+
+        EXPECT_EQ(visited, 37);
+        return sum;
+    } };
+
+    //Each pass adds 1 to every position, so the sums step up by the item count.
+    EXPECT_EQ(check_chunks(std::integral_constant<std::size_t, 4>{}), 666.0f + 37.0f);
+    EXPECT_EQ(check_chunks(std::integral_constant<std::size_t, 8>{}), 666.0f + 74.0f);
+    EXPECT_EQ(check_chunks(std::integral_constant<std::size_t, 16>{}), 666.0f + 111.0f);
+
+    soa_array<float, float> const &const_array{ array };
+    std::size_t chunk_count{ 0 };
+    const_array.for_each_chunk<16>([&](soa_chunk<16, float const, float const> chunk) {
+        EXPECT_EQ(chunk.get<1>()[0], 1.0f);
+        ++chunk_count;
+    });
+    EXPECT_EQ(chunk_count, 3);
+}
+
+TEST(soa_array_tests, can_iterate) {
+    soa_array<std::int32_t, std::int32_t> array{};
+    array.resize(10);
+    EXPECT_EQ(array.size(), 10);
+
+    std::int32_t i{ 0 };
+    for(auto [first, second] : array) {
+        first  = i;
+        second = i * i;
+        ++i;
+    }
+
+    auto const &const_array{ array };
+    i = 0;
+    for(auto iter{ const_array.begin() }; iter != const_array.end(); ++iter) {
+        EXPECT_EQ((*iter).get<1>(), i * i);
+        ++i;
+    }
+    EXPECT_EQ(array.end() - array.begin(), 10);
+    EXPECT_EQ((array.begin() + 3)[1].get<0>(), 4);
+}
+
+TEST(soa_array_tests, can_copy) {
+    soa_array<std::int32_t, std::string> array{};
+    for(std::int32_t i{ 0 }; i < 40; ++i) {
+        array.emplace_back(i, std::to_string(i));
+    }
+
+    soa_array<std::int32_t, std::string> copy{ array };
+    EXPECT_EQ(copy, array);
+
+    copy.erase(0);
+    EXPECT_NE(copy, array);
+
+    copy = array;
+    EXPECT_EQ(copy, array);
+    EXPECT_EQ(copy.back().get<1>(), "39");
+}
+
+TEST(soa_array_tests, can_move) {
+    soa_array<std::int32_t, std::unique_ptr<std::int32_t>> array{};
+    for(std::int32_t i{ 0 }; i < 40; ++i) {
+        array.emplace_back(i, std::make_unique<std::int32_t>(i));
+    }
+
+    soa_array<std::int32_t, std::unique_ptr<std::int32_t>> moved{ std::move(array) };
+    EXPECT_TRUE(array.empty());
+    EXPECT_EQ(moved.size(), 40);
+    EXPECT_EQ(*moved.back().get<1>(), 39);
+
+    array = std::move(moved);
+    EXPECT_EQ(array.size(), 40);
+    EXPECT_EQ(*array[20].get<1>(), 20);
+}
+
+TEST(soa_array_tests, can_use_custom_allocator) {
+    linear_allocator first_allocator{ EMBER_KB(4) };
+    linear_allocator second_allocator{ EMBER_KB(4) };
+
+    basic_soa_array<allocator_ref<linear_allocator>, std::int32_t, std::unique_ptr<std::int32_t>> first{ allocator_ref{ first_allocator } };
+    basic_soa_array<allocator_ref<linear_allocator>, std::int32_t, std::unique_ptr<std::int32_t>> second{ allocator_ref{ second_allocator } };
+    for(std::int32_t i{ 0 }; i < 10; ++i) {
+        first.emplace_back(i, std::make_unique<std::int32_t>(i));
+    }
+
+    second = std::move(first);
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(second.size(), 10);
+    EXPECT_EQ(*second.back().get<1>(), 9);
+    EXPECT_EQ(second.get_allocator(), allocator_ref{ second_allocator });
+}
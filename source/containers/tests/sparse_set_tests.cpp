@@ -1,4 +1,8 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <ember/containers/sparse_set.hpp>
+#include <ember/memory/linear_allocator.hpp>
 #include <gtest/gtest.h>
 
 using namespace ember;
@@ -226,3 +230,123 @@ TEST(sprase_set_tests, can_clear) {
     EXPECT_EQ(set.size(), 0);
     EXPECT_EQ(clear_counter, 3);
 }
+
+TEST(sprase_set_tests, can_use_custom_allocator) {
+    linear_allocator allocator{ EMBER_KB(4) };
+
+    sparse_set<std::size_t, object, allocator_ref<linear_allocator>> set{ allocator_ref{ allocator } };
+    for(std::size_t i{ 0 }; i < 16; ++i) {
+        auto val{ static_cast<std::int32_t>(i) };
+        set.emplace(i, val, val + 1, val + 2);
+    }
+    set.erase(3);
+
+    EXPECT_EQ(set.size(), 15);
+    EXPECT_FALSE(set.contains(3));
+    EXPECT_EQ(set[7], object(7, 7 + 1, 7 + 2));
+    EXPECT_EQ(set.get_allocator(), allocator_ref{ allocator });
+}
+
+namespace {
+    struct counting_resource final : public memory_resource {
+        std::size_t live_bytes{ 0 };
+        std::size_t peak_bytes{ 0 };
+        std::size_t allocations{ 0 };
+        std::size_t frees{ 0 };
+
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment) override {
+            ++allocations;
+            live_bytes += bytes;
+            peak_bytes = std::max(peak_bytes, live_bytes);
+
+            //Store the size in front of the allocation so it can be removed from live_bytes when freed.
+            std::byte *memory{ memory::alloc(bytes + header_size, alignment > header_size ? alignment : header_size) };
+            *reinterpret_cast<std::size_t *>(memory) = bytes;
+            return memory + header_size;
+        }
+
+        void free(std::byte *&memory) override {
+            if(memory == nullptr) {
+                return;
+            }
+
+            ++frees;
+            memory -= header_size;
+            live_bytes -= *reinterpret_cast<std::size_t *>(memory);
+            memory::free(memory);
+        }
+
+    private:
+        static std::size_t constexpr header_size{ alignof(std::max_align_t) };
+    };
+}
+
+TEST(sprase_set_tests, large_keys_only_allocate_their_page) {
+    counting_resource resource{};
+
+    {
+        sparse_set<std::uint32_t, object, polymorphic_allocator> set{ polymorphic_allocator{ resource } };
+        set.emplace(50'000'000, 1, 2, 3);
+
+        EXPECT_TRUE(set.contains(50'000'000));
+        EXPECT_FALSE(set.contains(49'999'999));
+        EXPECT_FALSE(set.contains(0));
+        EXPECT_EQ(set[50'000'000], object(1, 2, 3));
+
+        //A flat sparse array would need 50 million indices.
+        EXPECT_LT(resource.peak_bytes, EMBER_MB(4));
+    }
+
+    EXPECT_EQ(resource.allocations, resource.frees);
+}
+
+TEST(sprase_set_tests, frees_pages_once_empty) {
+    counting_resource resource{};
+
+    sparse_set<std::uint32_t, object, polymorphic_allocator> set{ polymorphic_allocator{ resource } };
+    set.emplace(10'000, 1, 1, 1);
+    set.emplace(10'001, 2, 2, 2);
+
+    std::size_t const bytes_with_page{ resource.live_bytes };
+
+    set.erase(10'000);
+    EXPECT_EQ(resource.live_bytes, bytes_with_page);
+
+    set.erase(10'001);
+    EXPECT_LT(resource.live_bytes, bytes_with_page);
+    EXPECT_EQ(set.size(), 0);
+    EXPECT_FALSE(set.contains(10'001));
+
+    set.emplace(10'001, 3, 3, 3);
+    EXPECT_EQ(set[10'001], object(3, 3, 3));
+}
+
+TEST(sprase_set_tests, can_emplace_and_erase_sorted_keys) {
+    std::array<std::uint32_t, 6> constexpr keys{ 1, 5, 300, 301, 4000, 70'000 };
+    std::array<object, 6> const values{ object{ 1, 1, 1 }, object{ 5, 5, 5 }, object{ 300, 300, 300 }, object{ 301, 301, 301 }, object{ 4000, 4000, 4000 }, object{ 70'000, 70'000, 70'000 } };
+
+    sparse_set<std::uint32_t, object> set{};
+    set.emplace(5, 0, 0, 0);
+    set.emplace(2, 2, 2, 2);
+
+    set.emplace_sorted(keys.begin(), keys.end(), values.begin());
+
+    EXPECT_EQ(set.size(), 7);
+    for(std::size_t i{ 0 }; i < keys.size(); ++i) {
+        EXPECT_EQ(set[keys[i]], values[i]);
+    }
+    EXPECT_EQ(set[2], object(2, 2, 2));
+
+    std::array<std::uint32_t, 5> constexpr to_erase{ 1, 3, 300, 4000, 70'000 };
+    set.erase_sorted(to_erase.begin(), to_erase.end());
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_FALSE(set.contains(1));
+    EXPECT_FALSE(set.contains(300));
+    EXPECT_FALSE(set.contains(4000));
+    EXPECT_FALSE(set.contains(70'000));
+    EXPECT_EQ(set[2], object(2, 2, 2));
+    EXPECT_EQ(set[5], object(5, 5, 5));
+    EXPECT_EQ(set[301], object(301, 301, 301));
+    EXPECT_EQ(set[70'001], object());
+}
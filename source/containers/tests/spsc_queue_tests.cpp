@@ -0,0 +1,101 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/spsc_queue.hpp>
+#include <gtest/gtest.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+TEST(spsc_queue_tests, rounds_capacity_to_power_of_two) {
+    spsc_queue<std::int32_t> queue{ 5 };
+
+    EXPECT_EQ(queue.capacity(), 8);
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(spsc_queue_tests, can_push_and_pop_in_order) {
+    spsc_queue<std::int32_t> queue{ 4 };
+
+    EXPECT_TRUE(queue.try_push(1));
+    EXPECT_TRUE(queue.try_push(2));
+    EXPECT_TRUE(queue.try_emplace(3));
+    EXPECT_TRUE(queue.try_push(4));
+    EXPECT_FALSE(queue.try_push(5));
+    EXPECT_EQ(queue.size(), 4);
+
+    EXPECT_EQ(queue.try_pop(), 1);
+    EXPECT_TRUE(queue.try_push(5));
+
+    EXPECT_EQ(queue.try_pop(), 2);
+    EXPECT_EQ(queue.try_pop(), 3);
+    EXPECT_EQ(queue.try_pop(), 4);
+    EXPECT_EQ(queue.try_pop(), 5);
+    EXPECT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(spsc_queue_tests, can_push_and_pop_batches) {
+    spsc_queue<std::int32_t> queue{ 8 };
+
+    std::array<std::int32_t, 6> constexpr first_batch{ 0, 1, 2, 3, 4, 5 };
+    EXPECT_EQ(queue.try_push(first_batch.begin(), first_batch.end()), 6);
+    EXPECT_EQ(queue.try_push(first_batch.begin(), first_batch.end()), 2);//Only 2 slots left.
+
+    std::array<std::int32_t, 5> popped{};
+    EXPECT_EQ(queue.try_pop(popped.begin(), popped.size()), 5);
+    EXPECT_EQ(popped, (std::array<std::int32_t, 5>{ 0, 1, 2, 3, 4 }));
+
+    //Wraps around the end of the ring buffer.
+    EXPECT_EQ(queue.try_push(first_batch.begin(), first_batch.end()), 5);
+
+    std::vector<std::int32_t> rest{};
+    EXPECT_EQ(queue.try_pop(std::back_inserter(rest), 100), 8);
+    EXPECT_EQ(rest, (std::vector<std::int32_t>{ 5, 0, 1, 0, 1, 2, 3, 4 }));
+}
+
+TEST(spsc_queue_tests, destroys_remaining_items) {
+    auto counter{ std::make_shared<std::int32_t>(0) };
+
+    {
+        spsc_queue<std::shared_ptr<std::int32_t>> queue{ 4 };
+        queue.try_push(counter);
+        queue.try_push(counter);
+        queue.try_push(counter);
+        EXPECT_EQ(counter.use_count(), 4);
+
+        queue.try_pop();
+        EXPECT_EQ(counter.use_count(), 3);
+    }
+
+    EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(spsc_queue_tests, can_pass_items_between_threads) {
+    std::uint64_t constexpr item_count{ 100000 };
+    spsc_queue<std::uint64_t> queue{ 64 };
+
+    std::thread producer{ [&queue]() {
+        for(std::uint64_t i{ 0 }; i < item_count;) {
+            if(queue.try_push(i)) {
+                ++i;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    } };
+
+    std::uint64_t expected{ 0 };
+    while(expected < item_count) {
+        if(auto item{ queue.try_pop() }) {
+            ASSERT_EQ(*item, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,92 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/work_stealing_deque.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+TEST(work_stealing_deque_tests, rounds_capacity_to_power_of_two) {
+    work_stealing_deque<std::int32_t> deque{ 100 };
+
+    EXPECT_EQ(deque.capacity(), 128);
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(work_stealing_deque_tests, owner_pops_newest_and_thieves_steal_oldest) {
+    work_stealing_deque<std::int32_t> deque{ 4 };
+
+    EXPECT_TRUE(deque.try_push(1));
+    EXPECT_TRUE(deque.try_push(2));
+    EXPECT_TRUE(deque.try_push(3));
+    EXPECT_TRUE(deque.try_push(4));
+    EXPECT_FALSE(deque.try_push(5));
+    EXPECT_EQ(deque.size(), 4);
+
+    EXPECT_EQ(deque.try_pop(), 4);
+    EXPECT_EQ(deque.try_steal(), 1);
+    EXPECT_EQ(deque.try_steal(), 2);
+
+    //Space freed by stealing can be reused once the ring wraps.
+    EXPECT_TRUE(deque.try_push(5));
+    EXPECT_TRUE(deque.try_push(6));
+    EXPECT_EQ(deque.try_pop(), 6);
+    EXPECT_EQ(deque.try_pop(), 5);
+    EXPECT_EQ(deque.try_pop(), 3);
+
+    EXPECT_FALSE(deque.try_pop().has_value());
+    EXPECT_FALSE(deque.try_steal().has_value());
+    EXPECT_TRUE(deque.empty());
+}
+
+TEST(work_stealing_deque_tests, every_item_is_taken_exactly_once) {
+    std::uint32_t constexpr thief_count{ 3 };
+    std::uint64_t constexpr item_count{ 200000 };
+
+    work_stealing_deque<std::uint64_t> deque{ 64 };
+    std::vector<std::atomic<std::uint32_t>> seen(item_count);
+    std::atomic<std::uint64_t> taken_count{ 0 };
+
+    std::vector<std::thread> thieves{};
+    for(std::uint32_t thief{ 0 }; thief < thief_count; ++thief) {
+        thieves.emplace_back([&]() {
+            while(taken_count.load() < item_count) {
+                if(auto const item{ deque.try_steal() }; item.has_value()) {
+                    seen[*item].fetch_add(1);
+                    taken_count.fetch_add(1);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    //The owner keeps the deque short so it often races the thieves for the last item.
+    for(std::uint64_t i{ 0 }; i < item_count;) {
+        if(deque.try_push(i)) {
+            ++i;
+        }
+        if(i % 3 == 0) {
+            if(auto const item{ deque.try_pop() }; item.has_value()) {
+                seen[*item].fetch_add(1);
+                taken_count.fetch_add(1);
+            }
+            std::this_thread::yield();
+        }
+    }
+    while(auto const item{ deque.try_pop() }) {
+        seen[*item].fetch_add(1);
+        taken_count.fetch_add(1);
+    }
+
+    for(auto &thief : thieves) {
+        thief.join();
+    }
+
+    for(auto const &count : seen) {
+        EXPECT_EQ(count.load(), 1);
+    }
+    EXPECT_TRUE(deque.empty());
+}
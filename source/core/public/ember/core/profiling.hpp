@@ -18,10 +18,19 @@ namespace ember::inline core::internal {
     #define EMBER_PROFILE_FRAME FrameMark
     #define EMBER_PROFILE_SCOPE(name) ZoneNamedN(EMBER_INTERNAL_PROFILER_CONCAT(_ember_zone_marker_, __LINE__), name, true)
     #define EMBER_PROFILE_SCOPE_C(name, r, g, b) ZoneNamedNC(EMBER_INTERNAL_PROFILER_CONCAT(_ember_zone_marker_, __LINE__), name, ::ember::core::internal::rgb_to_32(r, g, b, 1.0f), true)
+    //Same as EMBER_PROFILE_SCOPE but name can be any null terminated string, not just a literal. Slower as the name is copied each time.
+    #define EMBER_PROFILE_SCOPE_DYNAMIC(name) ZoneTransientN(EMBER_INTERNAL_PROFILER_CONCAT(_ember_zone_marker_, __LINE__), name, true)
+
+    #define EMBER_PROFILE_ALLOC(ptr, size) TracyAlloc(ptr, size)
+    #define EMBER_PROFILE_FREE(ptr) TracyFree(ptr)
 #else
     #define EMBER_PROFILE_FRAME
     #define EMBER_PROFILE_SCOPE(name)
     #define EMBER_PROFILE_SCOPE_C(name, r, g, b)
+    #define EMBER_PROFILE_SCOPE_DYNAMIC(name)
+
+    #define EMBER_PROFILE_ALLOC(ptr, size)
+    #define EMBER_PROFILE_FREE(ptr)
 #endif
 
 #define EMBER_PROFILE_FUNCTION EMBER_PROFILE_SCOPE(__FUNCTION__)
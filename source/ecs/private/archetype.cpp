@@ -1,63 +1,97 @@
 #include "ember/ecs/archetype.hpp"
 
-#include <ember/memory/memory.hpp>
+#include <ember/memory/exception.hpp>
 
 namespace ember::inline ecs {
-    archetype::archetype(archetype_id_t id, map<component_id_t, unique_ptr<internal::component_helpers>> *component_helper_map)
+    archetype::archetype(archetype_id_t id, map<component_id_t, unique_ptr<internal::component_helpers>> *component_helper_map, polymorphic_allocator allocator)
         : id{ std::move(id) }
+        , component_mask{ make_component_mask(this->id) }
+        , chunk_alignment{ cache_line_size }
+        , allocator{ allocator }
         , component_helper_map{ component_helper_map } {
-        component_data.stride = 0;
+        std::size_t entity_size{ 0 };
         for(auto component_id : this->id) {
-            component_data.stride += component_helper_map->at(component_id)->get_size();
+            internal::component_helpers const *helpers{ component_helper_map->at(component_id).get() };
+
+            entity_size += helpers->get_size();
+            chunk_alignment = std::max(chunk_alignment, helpers->get_alignment());
+
+            column_indices[component_id] = columns.size();
+            columns.push_back(component_column{ .size = helpers->get_size(), .helpers = helpers });
         }
-        EMBER_CHECK(component_data.stride != 0);
+        EMBER_CHECK(entity_size != 0);
+        EMBER_CHECK(columns.size() != 0);
 
-        std::size_t offset{ 0 };
-        for(auto component_id : this->id) {
-            component_offsets[component_id] = offset;
-            offset += component_helper_map->at(component_id)->get_size();
+        //Lays out each column one after the other, returning how large a chunk needs to be to fit them all
+        auto const layout_columns{ [this](std::size_t const capacity) {
+            std::size_t offset{ 0 };
+            for(auto &column : columns) {
+                std::size_t const alignment{ column.helpers->get_alignment() };
+
+                column.offset = (offset + alignment - 1) & ~(alignment - 1);
+                offset        = column.offset + (column.size * capacity);
+            }
+            return offset;
+        } };
+
+        //Fit as many entities into a chunk as possible, backing off if aligning the columns pushed it over
+        chunk_capacity = std::max<std::size_t>(chunk_size / entity_size, 1);
+        chunk_bytes    = layout_columns(chunk_capacity);
+        while(chunk_bytes > chunk_size && chunk_capacity > 1) {
+            --chunk_capacity;
+            chunk_bytes = layout_columns(chunk_capacity);
         }
-        EMBER_CHECK(component_offsets.size() != 0);
     }
 
     archetype::archetype(archetype &&other) noexcept
         : id{ std::move(other.id) }
+        , component_mask{ std::move(other.component_mask) }
         , entity_to_index{ std::move(other.entity_to_index) }
-        , index_to_entity{ std::move(other.index_to_entity) }
+        , entities{ std::move(other.entities) }
+        , chunks{ std::move(other.chunks) }
+        , chunk_bytes{ other.chunk_bytes }
+        , chunk_capacity{ other.chunk_capacity }
+        , chunk_alignment{ other.chunk_alignment }
+        , allocator{ other.allocator }
         , component_helper_map{ other.component_helper_map }
-        , component_offsets{ std::move(other.component_offsets) } {
-        destruct_memory_arena();
-        component_data              = std::move(other.component_data);
-        other.component_data.memory = nullptr;
+        , columns{ std::move(other.columns) }
+        , column_indices{ std::move(other.column_indices) }
+        , add_edges{ std::move(other.add_edges) }
+        , remove_edges{ std::move(other.remove_edges) } {
     }
 
     archetype &archetype::operator=(archetype &&other) noexcept {
+        destruct_chunks();
+
         id                   = std::move(other.id);
+        component_mask       = std::move(other.component_mask);
         entity_to_index      = std::move(other.entity_to_index);
-        index_to_entity      = std::move(index_to_entity);
+        entities             = std::move(other.entities);
+        chunks               = std::move(other.chunks);
+        chunk_bytes          = other.chunk_bytes;
+        chunk_capacity       = other.chunk_capacity;
+        chunk_alignment      = other.chunk_alignment;
+        allocator            = other.allocator;
         component_helper_map = other.component_helper_map;
-        component_offsets    = std::move(other.component_offsets);
-
-        destruct_memory_arena();
-        component_data              = std::move(other.component_data);
-        other.component_data.memory = nullptr;
+        columns              = std::move(other.columns);
+        column_indices       = std::move(other.column_indices);
+        add_edges            = std::move(other.add_edges);
+        remove_edges         = std::move(other.remove_edges);
 
         return *this;
     }
 
     archetype::~archetype() {
-        destruct_memory_arena();
+        destruct_chunks();
     }
 
     void archetype::add_entity(entity const entity) {
-        if((component_data.allocations * component_data.stride) + component_data.stride > component_data.bytes) {
-            increase_arena_size();
+        if(entities.size() == chunks.size() * chunk_capacity) {
+            add_chunk();
         }
-        ++component_data.allocations;
 
-        std::size_t const index{ component_data.allocations - 1 };
-        entity_to_index[entity] = index;
-        index_to_entity[index]  = entity;
+        entity_to_index[entity] = entities.size();
+        entities.push_back(entity);
     }
 
     void archetype::transfer_entity(entity const entity, archetype &previous_archetype) {
@@ -79,81 +113,54 @@ namespace ember::inline ecs {
     }
 
     void archetype::remove_entity(entity const entity) {
-        for(auto &component_id : id) {
-            std::byte *component_memory{ get_component_memory(entity, component_id) };
-            component_helper_map->at(component_id)->destruct(component_memory);
-        }
+        std::size_t const index{ entity_to_index.at(entity) };
+        std::size_t const last_index{ entities.size() - 1 };
 
-        std::size_t const to_move_index{ component_data.allocations - 1 };
-        ecs::entity const to_move_entity{ index_to_entity.at(to_move_index) };
-        EMBER_CHECK(to_move_entity != null_entity);
+        for(auto const &column : columns) {
+            column.helpers->destruct(get_component_memory(index, column));
+        }
 
-        //If we removed from the middle of the array then move the components at the end to the new location
-        if(to_move_entity != entity) {
-            for(auto &component_id : id) {
-                std::byte *old_component_memory{ get_component_memory(to_move_entity, component_id) };
-                std::byte *new_component_memory{ get_component_memory(entity, component_id) };
+        //If we removed from the middle of the columns then move the components at the end to the new location
+        if(index != last_index) {
+            ecs::entity const to_move_entity{ entities[last_index] };
+            EMBER_CHECK(to_move_entity != null_entity);
 
-                component_helper_map->at(component_id)->move(old_component_memory, new_component_memory);
+            for(auto const &column : columns) {
+                column.helpers->move(get_component_memory(last_index, column), get_component_memory(index, column));
             }
-            entity_to_index.at(to_move_entity)                     = entity_to_index.at(entity);
-            index_to_entity.at(entity_to_index.at(to_move_entity)) = to_move_entity;
+            entities[index]                    = to_move_entity;
+            entity_to_index.at(to_move_entity) = index;
         }
 
-        --component_data.allocations;
+        entities.pop_back();
         entity_to_index.erase(entity);
-        index_to_entity.erase(to_move_index);
-        EMBER_CHECK(entity_to_index.size() == index_to_entity.size());
+        EMBER_CHECK(entity_to_index.size() == entities.size());
     }
 
-    void archetype::increase_arena_size() {
-        if(component_data.bytes == 0) {
-            component_data.bytes  = component_data.stride;
-            component_data.memory = memory::alloc(component_data.bytes, 0);
-        } else {
-            std::byte *old_memory{ component_data.memory };
+    void archetype::add_chunk() {
+        std::byte *const chunk{ allocator.alloc(chunk_bytes, chunk_alignment) };
+        EMBER_THROW_IF_FAILED(chunk != nullptr, memory_exception{ "Failed to allocate a new chunk for an archetype." });
 
-            component_data.bytes *= 2;
-            component_data.memory = memory::alloc(component_data.bytes, 0);
-
-            std::byte *source{ old_memory };
-            std::byte *destination{ component_data.memory };
-            for(std::size_t i{ 0 }; i < component_data.allocations; ++i) {
-                for(auto &component_id : id) {
-                    auto &component{ component_helper_map->at(component_id) };
-
-                    component->move(source, destination);
-
-                    source += component->get_size();
-                    destination += component->get_size();
-                }
-            }
-
-            memory::free(old_memory);
-        }
+        chunks.push_back(chunk);
     }
 
     std::byte *archetype::get_component_memory(entity const entity, component_id_t const component_id) const {
         EMBER_CHECK(contains_entity(entity));
-
-        std::size_t const entity_index{ entity_to_index.at(entity) };
-        return component_data.memory + (component_data.stride * entity_index) + get_component_offset(component_id);
+        return get_component_memory(entity_to_index.at(entity), get_column(component_id));
     }
 
-    void archetype::destruct_memory_arena() {
-        if(component_data.memory != nullptr) {
-            std::byte *memory{ component_data.memory };
-            for(std::size_t i{ 0 }; i < component_data.allocations; ++i) {
-                for(auto &component_id : id) {
-                    auto &component{ component_helper_map->at(component_id) };
-
-                    component->destruct(memory);
-
-                    memory += component->get_size();
-                }
+    void archetype::destruct_chunks() {
+        for(auto const &column : columns) {
+            for(std::size_t i{ 0 }; i < entities.size(); ++i) {
+                column.helpers->destruct(get_component_memory(i, column));
             }
-            memory::free(component_data.memory);
-            component_data.memory = nullptr;
         }
+        entities.clear();
+        entity_to_index.clear();
+
+        for(auto *&chunk : chunks) {
+            allocator.free(chunk);
+        }
+        chunks.clear();
     }
-}
\ No newline at end of file
+}
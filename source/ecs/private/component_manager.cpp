@@ -8,16 +8,50 @@ namespace ember::inline ecs {
         }
     }
 
-    array<archetype>::iterator component_manager::find_archetype(archetype_id_t const &id) {
-        return std::find_if(archetypes.begin(), archetypes.end(), [&id](archetype const &archetype) { return archetype.get_id() == id; });
+    std::size_t component_manager::find_or_add_archetype(archetype_id_t const &id) {
+        if(auto const archetype_index{ archetype_indices.find(id) }; archetype_index != archetype_indices.end()) {
+            return archetype_index->second;
+        }
+
+        archetypes.emplace_back(id, &component_helper_map, component_allocator);
+        archetype_indices.emplace(id, archetypes.size() - 1);
+
+        return archetypes.size() - 1;
+    }
+
+    std::size_t component_manager::get_archetype_with(std::size_t const archetype_index, component_id_t const component_id) {
+        if(auto const edge{ archetypes[archetype_index].get_add_edge(component_id) }; edge.has_value()) {
+            return *edge;
+        }
+
+        archetype_id_t new_archetype_id{ archetypes[archetype_index].get_id() };
+        new_archetype_id.push_back(component_id);
+        std::sort(new_archetype_id.begin(), new_archetype_id.end());//Sorted IDs stop issues with similar archetypes but different orders
+
+        std::size_t const new_archetype_index{ find_or_add_archetype(new_archetype_id) };
+
+        //Removing the component again leads straight back, so both directions can be cached.
+        archetypes[archetype_index].set_add_edge(component_id, new_archetype_index);
+        archetypes[new_archetype_index].set_remove_edge(component_id, archetype_index);
+
+        return new_archetype_index;
     }
 
-    array<archetype>::iterator component_manager::find_or_add_archetype(archetype_id_t const &id) {
-        if(auto archetype_iter{ find_archetype(id) }; archetype_iter != archetypes.end()) {
-            return archetype_iter;
-        } else {
-            archetypes.emplace_back(id, &component_helper_map);
-            return archetypes.end() - 1;
+    std::size_t component_manager::get_archetype_without(std::size_t const archetype_index, component_id_t const component_id) {
+        if(auto const edge{ archetypes[archetype_index].get_remove_edge(component_id) }; edge.has_value()) {
+            return *edge;
         }
+
+        archetype_id_t new_archetype_id{ archetypes[archetype_index].get_id() };
+        new_archetype_id.erase(component_id);
+        EMBER_CHECK(!new_archetype_id.empty());
+
+        //Erasing keeps the remaining ids sorted.
+        std::size_t const new_archetype_index{ find_or_add_archetype(new_archetype_id) };
+
+        archetypes[archetype_index].set_remove_edge(component_id, new_archetype_index);
+        archetypes[new_archetype_index].set_add_edge(component_id, archetype_index);
+
+        return new_archetype_index;
     }
 }
\ No newline at end of file
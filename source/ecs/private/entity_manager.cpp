@@ -6,23 +6,19 @@ namespace ember::inline ecs {
 
         components.remove(entity);
 
-        entities.erase(entity);
+        alive_entities.reset(entity);
         entity = null_entity;
     }
 
     void entity_manager::destroy_all() {
-        for(auto entity : entities) {
-            components.remove(entity);
-        }
+        alive_entities.for_each_set([this](std::size_t const entity) {
+            components.remove(static_cast<ecs::entity>(entity));
+        });
 
-        entities.clear();
+        alive_entities.clear();
     }
     
     bool entity_manager::is_valid(entity const entity) {
-        if(entity != null_entity) {
-            return std::find(entities.begin(), entities.end(), entity) != entities.end();
-        } else {
-            return false;
-        }
+        return entity != null_entity && entity < alive_entities.size() && alive_entities.test(entity);
     }
 }
\ No newline at end of file
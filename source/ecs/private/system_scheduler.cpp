@@ -0,0 +1,192 @@
+#include "ember/ecs/system_scheduler.hpp"
+
+#include <algorithm>
+#include <ember/containers/bitset.hpp>
+#include <ember/core/exception.hpp>
+#include <ember/core/log.hpp>
+#include <ember/core/profiling.hpp>
+
+namespace ember::inline ecs {
+    system_scheduler::system_scheduler() = default;
+
+    system_scheduler::~system_scheduler() = default;
+
+    void system_scheduler::add_ordering(system_handle const first, system_handle const second) {
+        EMBER_THROW_IF_FAILED(first < systems.size() && second < systems.size(), exception{ "Cannot order a system that has not been added." });
+        EMBER_THROW_IF_FAILED(first != second, exception{ "Cannot order a system against itself." });
+        EMBER_THROW_IF_FAILED(!is_explicitly_ordered_before(second, first), exception{ "Ordering would create a cycle between systems." });
+
+        systems[first]->explicit_successors.push_back(second);
+        graph_dirty = true;
+    }
+
+    void system_scheduler::run(entity_manager &manager, thread_pool &pool) {
+        EMBER_PROFILE_FUNCTION;
+
+        if(graph_dirty) {
+            build_graph();
+        }
+
+        running_manager = &manager;
+        running_pool    = &pool;
+
+        remaining_systems.store(systems.size(), std::memory_order_relaxed);
+        for(auto &system : systems) {
+            system->pending_dependencies.store(system->dependency_count, std::memory_order_relaxed);
+        }
+
+        for(system_handle i{ 0 }; i < systems.size(); ++i) {
+            if(systems[i]->dependency_count == 0) {
+                pool.submit(&jobs[i], 1);
+            }
+        }
+        pool.wait(remaining_systems);
+
+        running_manager = nullptr;
+        running_pool    = nullptr;
+    }
+
+    std::size_t system_scheduler::get_system_count() const {
+        return systems.size();
+    }
+
+    std::string const &system_scheduler::get_name(system_handle const system) const {
+        return systems[system]->name;
+    }
+
+    component_access const &system_scheduler::get_access(system_handle const system) const {
+        return systems[system]->access;
+    }
+
+    bool system_scheduler::depends_on(system_handle const system, system_handle const dependency) {
+        if(graph_dirty) {
+            build_graph();
+        }
+
+        auto const &dependents{ systems[dependency]->dependents };
+        return std::find(dependents.begin(), dependents.end(), system) != dependents.end();
+    }
+
+    std::chrono::nanoseconds system_scheduler::get_last_run_time(system_handle const system) const {
+        return systems[system]->last_run_time;
+    }
+
+    system_handle system_scheduler::add_system(std::string name, component_access access, unique_ptr<internal::system_base> instance) {
+        auto system{ make_unique<system_scheduler::system>() };
+        system->name     = std::move(name);
+        system->access   = std::move(access);
+        system->instance = std::move(instance);
+
+        systems.emplace_back(std::move(system));
+        graph_dirty = true;
+
+        return systems.size() - 1;
+    }
+
+    bool system_scheduler::is_explicitly_ordered_before(system_handle const first, system_handle const second) const {
+        dynamic_bitset<> visited(systems.size());
+        array<system_handle> to_visit{ first };
+
+        while(!to_visit.empty()) {
+            system_handle const current{ to_visit.back() };
+            to_visit.pop_back();
+
+            if(current == second) {
+                return true;
+            }
+            if(visited.test(current)) {
+                continue;
+            }
+            visited.set(current);
+
+            for(system_handle const successor : systems[current]->explicit_successors) {
+                to_visit.push_back(successor);
+            }
+        }
+
+        return false;
+    }
+
+    void system_scheduler::build_graph() {
+        std::size_t const system_count{ systems.size() };
+
+        //Decide the order conflicting systems run in. Explicit orderings come first, then the order systems were added.
+        array<std::size_t> explicit_dependency_counts(system_count);
+        for(auto const &system : systems) {
+            for(system_handle const successor : system->explicit_successors) {
+                ++explicit_dependency_counts[successor];
+            }
+        }
+
+        array<std::size_t> rank(system_count);
+        std::fill(rank.begin(), rank.end(), system_count);
+        for(std::size_t next_rank{ 0 }; next_rank < system_count; ++next_rank) {
+            system_handle next{ system_count };
+            for(system_handle i{ 0 }; i < system_count; ++i) {
+                if(rank[i] == system_count && explicit_dependency_counts[i] == 0) {
+                    next = i;
+                    break;
+                }
+            }
+            EMBER_CHECK(next != system_count);//add_ordering rejects cycles
+
+            rank[next] = next_rank;
+            for(system_handle const successor : systems[next]->explicit_successors) {
+                --explicit_dependency_counts[successor];
+            }
+        }
+
+        //Systems depend on every earlier system they conflict with or were explicitly ordered after.
+        for(auto &system : systems) {
+            system->dependents.clear();
+            system->dependency_count = 0;
+        }
+        for(system_handle first{ 0 }; first < system_count; ++first) {
+            for(system_handle second{ 0 }; second < system_count; ++second) {
+                if(rank[first] >= rank[second]) {
+                    continue;
+                }
+
+                auto const &successors{ systems[first]->explicit_successors };
+                bool const is_ordered{ std::find(successors.begin(), successors.end(), second) != successors.end() };
+                if(is_ordered || systems[first]->access.conflicts_with(systems[second]->access)) {
+                    systems[first]->dependents.push_back(second);
+                    ++systems[second]->dependency_count;
+                }
+            }
+        }
+
+        jobs.clear();
+        for(system_handle i{ 0 }; i < system_count; ++i) {
+            jobs.push_back(job{
+                .function  = &system_scheduler::run_system,
+                .context   = this,
+                .index     = i,
+                .remaining = &remaining_systems,
+            });
+        }
+
+        graph_dirty = false;
+    }
+
+    void system_scheduler::run_system(void *context, std::size_t const index) {
+        auto &scheduler{ *static_cast<system_scheduler *>(context) };
+        system &system{ *scheduler.systems[index] };
+
+        {
+            EMBER_PROFILE_SCOPE_DYNAMIC(system.name.c_str());
+
+            auto const start{ std::chrono::steady_clock::now() };
+            system.instance->run(*scheduler.running_manager);
+            system.last_run_time = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        }
+
+        //Start anything that was only waiting on this system. This job isn't counted as finished until we return
+        //so the scheduler keeps waiting for anything submitted here.
+        for(system_handle const dependent : system.dependents) {
+            if(scheduler.systems[dependent]->pending_dependencies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                scheduler.running_pool->submit(&scheduler.jobs[dependent], 1);
+            }
+        }
+    }
+}
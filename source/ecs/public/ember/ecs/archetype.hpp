@@ -6,43 +6,58 @@
 #include <ember/containers/array.hpp>
 #include <ember/containers/map.hpp>
 #include <ember/core/export.hpp>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/memory.hpp>
 #include <ember/memory/unique_ptr.hpp>
+#include <optional>
 
 namespace ember::inline ecs {
     /**
      * @brief Contains data for all entities belonging to a specific archetype.
-     * @details An entity archetype is defined by it's unique combination of components.
+     * @details An entity archetype is defined by it's unique combination of components. Components are stored
+     * column-major: memory is split into fixed size chunks and each chunk holds one contiguous column per
+     * component type, so iterating a few components of a wide archetype only touches those columns.
      */
     class EMBER_API archetype {
         //TYPES
     private:
         /**
-         * @brief Memory arena for the components in this archetype.
-         * All components are stored contigously.
+         * @brief Where a component's column lives inside of each chunk.
          */
-        struct component_arena {
-            std::byte *memory{ nullptr };
-            std::size_t bytes{ 0 }; /**< Total size of the pool. */
-
-            std::size_t stride{ 0 }; /**< Total size of all component types. */
-            std::size_t allocations{ 0 };
+        struct component_column {
+            std::size_t offset{ 0 }; /**< Byte offset of the column from the start of a chunk. */
+            std::size_t size{ 0 };   /**< Size of a single component in the column. */
+            internal::component_helpers const *helpers{ nullptr };
         };
 
         //VARIABLES
+    public:
+        static std::size_t constexpr chunk_size{ EMBER_KB(16) }; /**< Target size of each chunk. Archetypes whose components are larger than this get one entity per chunk. */
+
     private:
         archetype_id_t id{};
+        component_mask_t component_mask{}; /**< Bit per component id in this archetype. */
 
         map<entity, std::size_t> entity_to_index{}; /**< All entities belonging to this archetype. */
-        map<std::size_t, entity> index_to_entity{}; /**< Maps an index in the arena to an entity. */
-        component_arena component_data{};           /**< Memory pool for the archetype's components. */
+        array<entity> entities{};                   /**< Maps an index in the chunks to an entity. */
+
+        array<std::byte *> chunks{};       /**< Chunks are kept once allocated and reused as entities come and go. */
+        std::size_t chunk_bytes{ 0 };      /**< Size of each allocated chunk. */
+        std::size_t chunk_capacity{ 0 };   /**< How many entities fit in a single chunk. */
+        std::size_t chunk_alignment{ 0 };  /**< Alignment of each chunk, large enough for every component. */
+        polymorphic_allocator allocator{}; /**< Where chunks are allocated from. */
 
         map<component_id_t, unique_ptr<internal::component_helpers>> *component_helper_map; /**< Maps a component id to it's helper type*/
-        map<component_id_t, std::size_t> component_offsets{};                               /**< Map of component offsets into the memory buffer.*/
+        array<component_column> columns{};                                                  /**< Column of each component, in the same order as id. */
+        map<component_id_t, std::size_t> column_indices{};                                  /**< Maps a component id to it's index in columns. */
+
+        map<component_id_t, std::size_t> add_edges{};    /**< Index of the archetype an entity moves to when a component is added. Filled in as transitions are made. */
+        map<component_id_t, std::size_t> remove_edges{}; /**< Index of the archetype an entity moves to when a component is removed. Filled in as transitions are made. */
 
         //FUNCTIONS
     public:
         archetype() = delete;
-        archetype(archetype_id_t id, map<component_id_t, unique_ptr<internal::component_helpers>> *component_helper_map);
+        archetype(archetype_id_t id, map<component_id_t, unique_ptr<internal::component_helpers>> *component_helper_map, polymorphic_allocator allocator = {});
 
         archetype(archetype const &other) = delete;
         archetype(archetype &&other) noexcept;
@@ -53,6 +68,7 @@ namespace ember::inline ecs {
         ~archetype();
 
         inline archetype_id_t const &get_id() const;
+        inline component_mask_t const &get_component_mask() const;
 
         void add_entity(entity const entity);
         void transfer_entity(entity const entity, archetype &previous_archetype);
@@ -61,6 +77,42 @@ namespace ember::inline ecs {
         inline bool contains_entity(entity const entity) const;
         inline bool allows_component(component_id_t const component_id) const;
 
+        inline std::size_t get_entity_count() const;
+        inline std::size_t get_chunk_capacity() const;
+
+        /**
+         * @brief Returns how many chunks currently hold entities.
+         */
+        inline std::size_t get_chunk_count() const;
+        /**
+         * @brief Returns the start of a chunk. Add a column offset to get to that component's column.
+         */
+        inline std::byte *get_chunk(std::size_t const chunk_index) const;
+        /**
+         * @brief Returns the entities of a chunk, in the same order as each column.
+         */
+        inline entity const *get_chunk_entities(std::size_t const chunk_index) const;
+        inline std::size_t get_chunk_entity_count(std::size_t const chunk_index) const;
+
+        /**
+         * @brief Returns the byte offset of a component's column from the start of every chunk.
+         * This does not change for the lifetime of the archetype.
+         */
+        inline std::size_t get_column_offset(component_id_t const component_id) const;
+
+        /**
+         * @brief Returns the index of the archetype with this archetype's components plus component_id, if that
+         * transition has been made before.
+         */
+        inline std::optional<std::size_t> get_add_edge(component_id_t const component_id) const;
+        inline void set_add_edge(component_id_t const component_id, std::size_t const archetype_index);
+        /**
+         * @brief Returns the index of the archetype with this archetype's components minus component_id, if that
+         * transition has been made before.
+         */
+        inline std::optional<std::size_t> get_remove_edge(component_id_t const component_id) const;
+        inline void set_remove_edge(component_id_t const component_id, std::size_t const archetype_index);
+
         template<typename component_t, typename... construct_args_t>
         component_t &alloc_component(entity const entity, construct_args_t &&...construct_args);
         template<typename component_t>
@@ -69,37 +121,17 @@ namespace ember::inline ecs {
         template<typename component_t>
         component_t &get_component(entity const entity);
 
-        template<typename function_t>
-        void invoke_on_components(function_t function);
-
-        template<typename function_t, typename object_t>
-        void invoke_on_components(function_t function, object_t *object);
-
     private:
-        void increase_arena_size();
+        void add_chunk();
 
-        template<typename component_t>
-        std::size_t get_component_offset() const;
-        inline std::size_t get_component_offset(component_id_t const component_id) const;
+        inline component_column const &get_column(component_id_t const component_id) const;
 
         template<typename component_t>
         std::byte *get_component_memory(entity const entity) const;
         std::byte *get_component_memory(entity const entity, component_id_t const component_id) const;
+        inline std::byte *get_component_memory(std::size_t const index, component_column const &column) const;
 
-        template<typename component_t>
-        component_t &get_component_within_block(std::byte *const block);
-
-        template<typename function_t, std::size_t... parameter_indices_t>
-        void invoke(function_t function, std::index_sequence<parameter_indices_t...>);
-        template<typename function_t, typename component_t, typename... components_t>
-        void invoke(function_t function);
-
-        template<typename function_t, typename object_t, std::size_t... parameter_indices_t>
-        void invoke_member(function_t function, object_t *object, std::index_sequence<parameter_indices_t...>);
-        template<typename function_t, typename object_t, typename component_t, typename... components_t>
-        void invoke_member(function_t function, object_t *object);
-
-        void destruct_memory_arena();
+        void destruct_chunks();
     };
 }
 
@@ -1,19 +1,74 @@
-#include "ember/ecs/function_traits.hpp"
-
+#include <algorithm>
 #include <ember/core/log.hpp>
-#include <numeric>
 
 namespace ember::inline ecs {
     archetype_id_t const &archetype::get_id() const {
         return id;
     }
 
+    component_mask_t const &archetype::get_component_mask() const {
+        return component_mask;
+    }
+
     bool archetype::contains_entity(entity const entity) const {
         return entity_to_index.contains(entity);
     }
 
     bool archetype::allows_component(component_id_t const component_id) const {
-        return std::find(id.begin(), id.end(), component_id) != id.end();
+        return component_id < component_mask.size() && component_mask.test(component_id);
+    }
+
+    std::size_t archetype::get_entity_count() const {
+        return entities.size();
+    }
+
+    std::size_t archetype::get_chunk_capacity() const {
+        return chunk_capacity;
+    }
+
+    std::size_t archetype::get_chunk_count() const {
+        return (entities.size() + chunk_capacity - 1) / chunk_capacity;
+    }
+
+    std::byte *archetype::get_chunk(std::size_t const chunk_index) const {
+        EMBER_CHECK(chunk_index < get_chunk_count());
+        return chunks[chunk_index];
+    }
+
+    entity const *archetype::get_chunk_entities(std::size_t const chunk_index) const {
+        EMBER_CHECK(chunk_index < get_chunk_count());
+        return entities.data() + (chunk_index * chunk_capacity);
+    }
+
+    std::size_t archetype::get_chunk_entity_count(std::size_t const chunk_index) const {
+        EMBER_CHECK(chunk_index < get_chunk_count());
+        return std::min(chunk_capacity, entities.size() - (chunk_index * chunk_capacity));
+    }
+
+    std::size_t archetype::get_column_offset(component_id_t const component_id) const {
+        return get_column(component_id).offset;
+    }
+
+    std::optional<std::size_t> archetype::get_add_edge(component_id_t const component_id) const {
+        if(auto const edge{ add_edges.find(component_id) }; edge != add_edges.end()) {
+            return edge->second;
+        }
+        return std::nullopt;
+    }
+
+    void archetype::set_add_edge(component_id_t const component_id, std::size_t const archetype_index) {
+        add_edges[component_id] = archetype_index;
+    }
+
+    std::optional<std::size_t> archetype::get_remove_edge(component_id_t const component_id) const {
+        if(auto const edge{ remove_edges.find(component_id) }; edge != remove_edges.end()) {
+            return edge->second;
+        }
+        return std::nullopt;
+    }
+
+    void archetype::set_remove_edge(component_id_t const component_id, std::size_t const archetype_index) {
+        remove_edges[component_id] = archetype_index;
     }
 
     template<typename component_t, typename... construct_args_t>
@@ -46,26 +101,9 @@ namespace ember::inline ecs {
         return *reinterpret_cast<component_t *>(component_memory);
     }
 
-    template<typename function_t>
-    void archetype::invoke_on_components(function_t function) {
-        //Generate an invoke call where index sequence contains indices to each function params
-        invoke(function, std::make_index_sequence<internal::function_traits<function_t>::arity>{});
-    }
-
-    template<typename function_t, typename object_t>
-    void archetype::invoke_on_components(function_t function, object_t *object) {
-        //Generate an invoke call where index sequence contains indices to each function params
-        invoke_member(function, object, std::make_index_sequence<internal::function_traits<function_t>::arity>{});
-    }
-
-    template<typename component_t>
-    std::size_t archetype::get_component_offset() const {
-        return get_component_offset(id_generator::get<component_t>());
-    }
-
-    std::size_t archetype::get_component_offset(component_id_t const component_id) const {
+    archetype::component_column const &archetype::get_column(component_id_t const component_id) const {
         EMBER_CHECK(allows_component(component_id));
-        return component_offsets.at(component_id);
+        return columns[column_indices.at(component_id)];
     }
 
     template<typename component_t>
@@ -73,49 +111,10 @@ namespace ember::inline ecs {
         return get_component_memory(entity, id_generator::get<component_t>());
     }
 
-    template<typename component_t>
-    component_t &archetype::get_component_within_block(std::byte *const block) {
-        //TODO: This will likely need to be optimised in the future. get_component_offset loops through the archetype's id on every call.
-        return *reinterpret_cast<component_t *>(block + get_component_offset<component_t>());
-    }
-
-    template<typename function_t, std::size_t... parameter_indices_t>
-    void archetype::invoke(function_t function, std::index_sequence<parameter_indices_t...>) {
-        //Generate an invoke call where the inidices are used to expand out each type of the function's params
-        invoke<function_t, std::tuple_element_t<parameter_indices_t, typename internal::function_traits<function_t>::decayed_parameter_types_tuple>...>(function);
-    }
+    std::byte *archetype::get_component_memory(std::size_t const index, component_column const &column) const {
+        std::size_t const chunk_index{ index / chunk_capacity };
+        std::size_t const index_in_chunk{ index % chunk_capacity };
 
-    template<typename function_t, typename component_t, typename... components_t>
-    void archetype::invoke(function_t function) {
-        for(std::size_t i{ 0 }; i < component_data.allocations; ++i) {
-            std::byte *const archetype_block{ component_data.memory + (i * component_data.stride) };
-
-            //If the first 'component' is an entity the retrieve it from the map and call with the rest of the component types
-            if constexpr(std::is_same_v<component_t, entity>) {
-                function(index_to_entity.at(i), get_component_within_block<components_t>(archetype_block)...);
-            } else {
-                function(get_component_within_block<component_t>(archetype_block), get_component_within_block<components_t>(archetype_block)...);
-            }
-        }
-    }
-
-    template<typename function_t, typename object_t, std::size_t... parameter_indices_t>
-    void archetype::invoke_member(function_t function, object_t *object, std::index_sequence<parameter_indices_t...>) {
-        //Generate an invoke call where the inidices are used to expand out each type of the function's params
-        invoke_member<function_t, object_t, std::tuple_element_t<parameter_indices_t, typename internal::function_traits<function_t>::decayed_parameter_types_tuple>...>(function, object);
-    }
-
-    template<typename function_t, typename object_t, typename component_t, typename... components_t>
-    void archetype::invoke_member(function_t function, object_t *object) {
-        for(std::size_t i{ 0 }; i < component_data.allocations; ++i) {
-            std::byte *const archetype_block{ component_data.memory + (i * component_data.stride) };
-
-            //If the first 'component' is an entity the retrieve it from the map and call with the rest of the component types
-            if constexpr(std::is_same_v<component_t, entity>) {
-                (object->*function)(index_to_entity.at(i), get_component_within_block<components_t>(archetype_block)...);
-            } else {
-                (object->*function)(get_component_within_block<component_t>(archetype_block), get_component_within_block<components_t>(archetype_block)...);
-            }
-        }
+        return chunks[chunk_index] + column.offset + (index_in_chunk * column.size);
     }
 }
\ No newline at end of file
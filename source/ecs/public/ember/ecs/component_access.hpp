@@ -0,0 +1,52 @@
+#pragma once
+
+#include "ember/ecs/function_traits.hpp"
+#include "ember/ecs/types.hpp"
+
+#include <tuple>
+#include <type_traits>
+
+namespace ember::inline ecs {
+    /**
+     * @brief Which components a function reads and which it writes.
+     * @details Components taken by value or by const reference are read. Components taken by non-const reference are
+     * written. Two functions can run at the same time if neither writes a component the other uses.
+     */
+    struct component_access {
+        component_mask_t reads{};
+        component_mask_t writes{};
+
+        /**
+         * @brief Returns true if running alongside other could race on a component.
+         * @param other
+         * @return
+         */
+        bool conflicts_with(component_access const &other) const;
+    };
+
+    /**
+     * @brief Gets the components a function will read and write when passed to for_each.
+     * @tparam function_t
+     * @return
+     */
+    template<typename function_t>
+    component_access get_component_access();
+}
+
+namespace ember::inline ecs::internal {
+    template<typename parameter_t>
+    inline bool constexpr is_written_parameter_v{ std::is_lvalue_reference_v<parameter_t> && !std::is_const_v<std::remove_reference_t<parameter_t>> };
+
+    template<typename parameters_tuple_t>
+    struct component_access_from_parameters;
+
+    template<typename... parameters_t>
+    struct component_access_from_parameters<std::tuple<parameters_t...>> {
+        static component_access get();
+    };
+
+    template<typename... parameters_t>
+    struct component_access_from_parameters<std::tuple<entity, parameters_t...>> : public component_access_from_parameters<std::tuple<parameters_t...>> {};
+}
+
+#include "component_access.inl"
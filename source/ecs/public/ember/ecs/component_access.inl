@@ -0,0 +1,28 @@
+namespace ember::inline ecs {
+    inline bool component_access::conflicts_with(component_access const &other) const {
+        return writes.intersects(other.reads) || writes.intersects(other.writes) || other.writes.intersects(reads);
+    }
+
+    template<typename function_t>
+    component_access get_component_access() {
+        return internal::component_access_from_parameters<typename internal::function_traits<function_t>::parameter_types_tuple>::get();
+    }
+}
+
+namespace ember::inline ecs::internal {
+    template<typename... parameters_t>
+    component_access component_access_from_parameters<std::tuple<parameters_t...>>::get() {
+        component_access access{};
+
+        auto const add_parameter{ [&access](component_id_t const id, bool const written) {
+            component_mask_t &mask{ written ? access.writes : access.reads };
+            if(id >= mask.size()) {
+                mask.resize(id + 1);
+            }
+            mask.set(id);
+        } };
+        (add_parameter(id_generator::get<std::decay_t<parameters_t>>(), is_written_parameter_v<parameters_t>), ...);
+
+        return access;
+    }
+}
@@ -8,8 +8,9 @@ namespace ember::inline ecs::internal {
         virtual void move(std::byte *source, std::byte *destination) const = 0;
         virtual void destruct(std::byte *memory) const                     = 0;
 
-        virtual std::size_t get_size() const  = 0;
-        virtual component_id_t get_id() const = 0;
+        virtual std::size_t get_size() const      = 0;
+        virtual std::size_t get_alignment() const = 0;
+        virtual component_id_t get_id() const     = 0;
     };
 
     template<typename component_t>
@@ -19,6 +20,7 @@ namespace ember::inline ecs::internal {
         void destruct(std::byte *memory) const final;
 
         std::size_t get_size() const final;
+        std::size_t get_alignment() const final;
         component_id_t get_id() const final;
     };
 }
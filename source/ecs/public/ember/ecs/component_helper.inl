@@ -17,6 +17,11 @@ namespace ember::inline ecs::internal {
         return sizeof(component_t);
     }
 
+    template<typename component_t>
+    std::size_t component_helpers_impl<component_t>::get_alignment() const {
+        return alignof(component_t);
+    }
+
     template<typename component_t>
     component_id_t component_helpers_impl<component_t>::get_id() const {
         return id_generator::get<component_t>();
@@ -1,11 +1,14 @@
 #pragma once
 
 #include "ember/ecs/archetype.hpp"
+#include "ember/ecs/query.hpp"
 #include "ember/ecs/types.hpp"
 
 #include <ember/containers/array.hpp>
 #include <ember/containers/map.hpp>
 #include <ember/core/export.hpp>
+#include <ember/memory/allocator.hpp>
+#include <ember/threading/thread_pool.hpp>
 
 namespace ember::inline ecs {
     /**
@@ -15,12 +18,16 @@ namespace ember::inline ecs {
         //VARIABLES
     private:
         array<archetype> archetypes{};
+        map<archetype_id_t, std::size_t, archetype_id_hash> archetype_indices{}; /**< Maps an archetype's sorted component ids to it's index in archetypes. */
         map<entity, std::size_t> entity_to_archetype{};//Maps an entity to an index to the archetypes array;
         map<component_id_t, unique_ptr<internal::component_helpers>> component_helper_map{};
+        polymorphic_allocator component_allocator{};                  /**< Where each archetype allocates it's components from. */
+        map<id_t, unique_ptr<internal::query_base>> cached_queries{}; /**< Queries made for plain for_each calls, keyed by the query's type. */
 
         //FUNCTIONS
     public:
         inline component_manager();
+        inline explicit component_manager(polymorphic_allocator component_allocator);
 
         component_manager(component_manager const &other) = delete;
         inline component_manager(component_manager &&other) noexcept;
@@ -47,17 +54,40 @@ namespace ember::inline ecs {
         void for_each(function_t function);
 
         template<typename function_t, typename object_t>
-        void for_each(function_t function, object_t *object);
+        void for_each(function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t>;
 
-    private:
-        array<archetype>::iterator find_archetype(archetype_id_t const &id);
-        array<archetype>::iterator find_or_add_archetype(archetype_id_t const &id);
+        template<typename function_t, typename... components_t>
+        void for_each(query<components_t...> &entity_query, function_t function);
+
+        template<typename function_t, typename object_t, typename... components_t>
+        void for_each(query<components_t...> &entity_query, function_t function, object_t *object);
 
-        template<typename function_t, std::size_t... parameter_indices_t>
-        archetype_id_t generate_archetype_id_from_function(std::index_sequence<parameter_indices_t...>);
+        template<typename function_t>
+        void parallel_for_each(thread_pool &pool, function_t function);
 
-        template<typename component_t, typename... components_t>
-        archetype_id_t generate_archetype_id_from_types();
+        template<typename function_t, typename object_t>
+        void parallel_for_each(thread_pool &pool, function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t>;
+
+        template<typename function_t, typename... components_t>
+        void parallel_for_each(thread_pool &pool, query<components_t...> &entity_query, function_t function);
+
+    private:
+        std::size_t find_or_add_archetype(archetype_id_t const &id);
+
+        /**
+         * @brief Returns the index of the archetype an entity moves to when component_id is added to an entity
+         * in archetype_index. Follows the archetype's cached edge, only sorting and looking up the new
+         * archetype's id the first time the transition is made.
+         */
+        std::size_t get_archetype_with(std::size_t const archetype_index, component_id_t const component_id);
+        /**
+         * @brief Returns the index of the archetype an entity moves to when component_id is removed from an entity
+         * in archetype_index. The archetype must have other components besides component_id.
+         */
+        std::size_t get_archetype_without(std::size_t const archetype_index, component_id_t const component_id);
+
+        template<typename query_t>
+        query_t &get_cached_query();
     };
 }
 
@@ -5,6 +5,10 @@
 namespace ember::inline ecs {
     component_manager::component_manager() = default;
 
+    component_manager::component_manager(polymorphic_allocator component_allocator)
+        : component_allocator{ component_allocator } {
+    }
+
     component_manager::component_manager(component_manager &&other) noexcept = default;
 
     component_manager &component_manager::operator=(component_manager &&other) noexcept = default;
@@ -17,41 +21,36 @@ namespace ember::inline ecs {
     component_t &component_manager::add(entity const entity, construct_args_t &&...construct_args) {
         component_id_t const component_id{ id_generator::get<component_t>() };
 
-        if(!component_helper_map.contains(component_id)) {
-            component_helper_map[component_id] = make_unique<internal::component_helpers_impl<component_t>>();
+        if(auto &helpers{ component_helper_map[component_id] }; helpers == nullptr) {
+            helpers = make_unique<internal::component_helpers_impl<component_t>>();
         }
 
         archetype *new_archetype{ nullptr };
         component_t *ret_comp{ nullptr };
 
-        if(entity_to_archetype.contains(entity)) {
-            archetype *old_archetype{ &archetypes[entity_to_archetype.at(entity)] };
+        if(auto const entity_archetype{ entity_to_archetype.find(entity) }; entity_archetype != entity_to_archetype.end()) {
+            std::size_t const old_archetype_index{ entity_archetype->second };
 
-            if(old_archetype->allows_component(component_id)) {
+            if(archetypes[old_archetype_index].allows_component(component_id)) {
                 //Destruct the existing component as we just re alloc it below.
-                new_archetype = old_archetype;
+                new_archetype = &archetypes[old_archetype_index];
                 new_archetype->destruct_component<component_t>(entity);
             } else {
-                archetype_id_t new_archetype_id{ old_archetype->get_id() };
-                new_archetype_id.push_back(component_id);
-                std::sort(new_archetype_id.begin(), new_archetype_id.end());
-
-                auto archetype_iter{ find_or_add_archetype(new_archetype_id) };
-                old_archetype = &archetypes[entity_to_archetype.at(entity)];//Need to get the archetype again as the array could've resized.
-                archetype_iter->transfer_entity(entity, *old_archetype);
+                std::size_t const new_archetype_index{ get_archetype_with(old_archetype_index, component_id) };
 
-                entity_to_archetype[entity] = std::distance(archetypes.begin(), archetype_iter);
+                //Only take pointers now, finding the new archetype could've resized the array.
+                new_archetype = &archetypes[new_archetype_index];
+                new_archetype->transfer_entity(entity, archetypes[old_archetype_index]);
 
-                new_archetype = archetype_iter.get();
+                entity_archetype->second = new_archetype_index;
             }
         } else {
-            archetype_id_t const archetype_id{ component_id };
+            std::size_t const new_archetype_index{ find_or_add_archetype(archetype_id_t{ component_id }) };
 
-            auto archetype_iter{ find_or_add_archetype(archetype_id) };
-            archetype_iter->add_entity(entity);
-            entity_to_archetype[entity] = std::distance(archetypes.begin(), archetype_iter);
+            new_archetype = &archetypes[new_archetype_index];
+            new_archetype->add_entity(entity);
 
-            new_archetype = archetype_iter.get();
+            entity_to_archetype[entity] = new_archetype_index;
         }
 
         EMBER_CHECK(new_archetype != nullptr);
@@ -82,76 +81,73 @@ namespace ember::inline ecs {
 
     template<typename component_t>
     void component_manager::remove(entity const entity) {
-        if(has<component_t>(entity)) {
-            component_id_t const component_id{ id_generator::get<component_t>() };
+        component_id_t const component_id{ id_generator::get<component_t>() };
 
-            archetype *old_archetype{ &archetypes[entity_to_archetype.at(entity)] };
+        auto const entity_archetype{ entity_to_archetype.find(entity) };
+        if(entity_archetype == entity_to_archetype.end() || !archetypes[entity_archetype->second].allows_component(component_id)) {
+            return;
+        }
 
-            archetype_id_t new_archetype_id{ old_archetype->get_id() };
-            new_archetype_id.erase(component_id);
-            std::sort(new_archetype_id.begin(), new_archetype_id.end());//Sorted IDs stop issues with similar archetypes but different orders
+        std::size_t const old_archetype_index{ entity_archetype->second };
 
-            //If this was the entity's last component then we do not need to add it in another archetype.
-            if(new_archetype_id.empty()) {
-                old_archetype->remove_entity(entity);
-                entity_to_archetype.erase(entity);
-                return;
-            }
+        //If this was the entity's last component then we do not need to add it in another archetype.
+        if(archetypes[old_archetype_index].get_id().size() == 1) {
+            archetypes[old_archetype_index].remove_entity(entity);
+            entity_to_archetype.erase(entity_archetype);
+            return;
+        }
 
-            auto new_archetype{ find_or_add_archetype(new_archetype_id) };
-            old_archetype = &archetypes[entity_to_archetype.at(entity)];//Need to get the pointer again incase the array resized.
+        std::size_t const new_archetype_index{ get_archetype_without(old_archetype_index, component_id) };
+        archetypes[new_archetype_index].transfer_entity(entity, archetypes[old_archetype_index]);
 
-            new_archetype->transfer_entity(entity, *old_archetype);
-            entity_to_archetype.at(entity) = std::distance(archetypes.begin(), new_archetype);
-        }
+        entity_archetype->second = new_archetype_index;
     }
 
     template<typename function_t>
     void component_manager::for_each(function_t function) {
-        archetype_id_t const match_id{ generate_archetype_id_from_function<function_t>(std::make_index_sequence<internal::function_traits<function_t>::arity>{}) };
-
-        for(auto &archetype : archetypes) {
-            auto const &archetype_id{ archetype.get_id() };
-            bool const is_match{ std::includes(archetype_id.begin(), archetype_id.end(), match_id.begin(), match_id.end()) };
-
-            if(is_match) {
-                archetype.invoke_on_components(function);
-            }
-        }
+        get_cached_query<internal::query_from_function_t<function_t>>().for_each(archetypes, function);
     }
 
     template<typename function_t, typename object_t>
-    void component_manager::for_each(function_t function, object_t *object) {
-        archetype_id_t const match_id{ generate_archetype_id_from_function<function_t>(std::make_index_sequence<internal::function_traits<function_t>::arity>{}) };
+    void component_manager::for_each(function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t> {
+        internal::bound_member_function<function_t, object_t> member_function{ function, object };
+        get_cached_query<internal::query_from_function_t<function_t>>().for_each(archetypes, member_function);
+    }
 
-        for(auto &archetype : archetypes) {
-            auto const &archetype_id{ archetype.get_id() };
-            bool const is_match{ std::includes(archetype_id.begin(), archetype_id.end(), match_id.begin(), match_id.end()) };
+    template<typename function_t, typename... components_t>
+    void component_manager::for_each(query<components_t...> &entity_query, function_t function) {
+        entity_query.for_each(archetypes, function);
+    }
 
-            if(is_match) {
-                archetype.invoke_on_components(function, object);
-            }
-        }
+    template<typename function_t, typename object_t, typename... components_t>
+    void component_manager::for_each(query<components_t...> &entity_query, function_t function, object_t *object) {
+        internal::bound_member_function<function_t, object_t> member_function{ function, object };
+        entity_query.for_each(archetypes, member_function);
     }
 
-    template<typename function_t, std::size_t... parameter_indices_t>
-    archetype_id_t component_manager::generate_archetype_id_from_function(std::index_sequence<parameter_indices_t...>) {
-        //Use the provided index sequence to expand out each type of the function's params
-        return generate_archetype_id_from_types<std::tuple_element_t<parameter_indices_t, typename internal::function_traits<function_t>::decayed_parameter_types_tuple>...>();
+    template<typename function_t>
+    void component_manager::parallel_for_each(thread_pool &pool, function_t function) {
+        get_cached_query<internal::query_from_function_t<function_t>>().parallel_for_each(archetypes, pool, function);
     }
 
-    template<typename component_t, typename... components_t>
-    archetype_id_t component_manager::generate_archetype_id_from_types() {
-        archetype_id_t id;
+    template<typename function_t, typename object_t>
+    void component_manager::parallel_for_each(thread_pool &pool, function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t> {
+        internal::bound_member_function<function_t, object_t> member_function{ function, object };
+        get_cached_query<internal::query_from_function_t<function_t>>().parallel_for_each(archetypes, pool, member_function);
+    }
 
-        //If the first 'component' is actually an entity then don't use it to generate the ID
-        if constexpr(std::is_same_v<component_t, entity>) {
-            id = { id_generator::get<components_t>()... };
-        } else {
-            id = { id_generator::get<component_t>(), id_generator::get<components_t>()... };
+    template<typename function_t, typename... components_t>
+    void component_manager::parallel_for_each(thread_pool &pool, query<components_t...> &entity_query, function_t function) {
+        entity_query.parallel_for_each(archetypes, pool, function);
+    }
+
+    template<typename query_t>
+    query_t &component_manager::get_cached_query() {
+        auto &cached_query{ cached_queries[basic_id_generator<internal::query_family>::get<query_t>()] };
+        if(cached_query == nullptr) {
+            cached_query = make_unique<query_t>();
         }
 
-        std::sort(id.begin(), id.end());
-        return id;
+        return static_cast<query_t &>(*cached_query);
     }
 }
\ No newline at end of file
@@ -1,10 +1,12 @@
 #pragma once
 
+#include "ember/ecs/component_access.hpp"
 #include "ember/ecs/component_manager.hpp"
 #include "ember/ecs/types.hpp"
 
-#include <ember/containers/array.hpp>
+#include <ember/containers/bitset.hpp>
 #include <ember/core/export.hpp>
+#include <ember/threading/thread_pool.hpp>
 
 namespace ember::inline ecs {
     /**
@@ -15,7 +17,13 @@ namespace ember::inline ecs {
     private:
         inline static entity next_entity{ 0 };
 
-        array<entity> entities{};
+        /**
+         * @brief Bit per entity id, set while the entity belongs to this manager.
+         * @details Ids come from next_entity, which is shared by every manager so entities stay unique between them.
+         * The bitset grows to the largest id this manager has created, so each manager pays one bit for every entity
+         * created by any manager up to that point (around 122KB per million ids).
+         */
+        dynamic_bitset<> alive_entities{};
         component_manager components{};
 
         //FUNCTIONS
@@ -107,7 +115,69 @@ namespace ember::inline ecs {
          * @param object 
          */
         template<typename function_t, typename object_t>
-        void for_each(function_t function, object_t *object);
+        void for_each(function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t>;
+
+        /**
+         * @brief Calls the function for every entity matched by a query. Prefer holding onto a query for systems that
+         * run every frame, it only has to find newly created archetypes each time it is run.
+         * @tparam function_t 
+         * @tparam components_t 
+         * @param entity_query Must only be used with this manager.
+         * @param function 
+         */
+        template<typename function_t, typename... components_t>
+        void for_each(query<components_t...> &entity_query, function_t function);
+
+        /**
+         * @brief Calls the member function for every entity matched by a query.
+         * @tparam function_t 
+         * @tparam object_t 
+         * @tparam components_t 
+         * @param entity_query Must only be used with this manager.
+         * @param function 
+         * @param object 
+         */
+        template<typename function_t, typename object_t, typename... components_t>
+        void for_each(query<components_t...> &entity_query, function_t function, object_t *object);
+
+        /**
+         * @brief Same as for_each but splits the matching entities into chunk sized ranges and runs them across a
+         * thread pool. Returns once every entity has been visited.
+         * @details Each entity is only visited by one thread. Components taken by non-const reference are only written
+         * by the thread visiting that entity and components taken by value or const reference are only read. The
+         * function is called concurrently through a const reference, so it can't be a mutable lambda and anything it
+         * captures must be safe to use from multiple threads. Entities and components must not be added or removed
+         * until it returns. Use get_component_access to check which parallel_for_each calls can safely overlap.
+         * @tparam function_t 
+         * @param pool 
+         * @param function 
+         */
+        template<typename function_t>
+        void parallel_for_each(thread_pool &pool, function_t function);
+
+        /**
+         * @brief Calls the member function across a thread pool for every entity that has a combination of components
+         * that matches it's arguments. See parallel_for_each for the threading rules.
+         * @tparam function_t 
+         * @tparam object_t 
+         * @param pool 
+         * @param function 
+         * @param object 
+         */
+        template<typename function_t, typename object_t>
+        void parallel_for_each(thread_pool &pool, function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t>;
+
+        /**
+         * @brief Calls the function across a thread pool for every entity matched by a query. See parallel_for_each for
+         * the threading rules.
+         * @tparam function_t 
+         * @tparam components_t 
+         * @param pool 
+         * @param entity_query Must only be used with this manager.
+         * @param function 
+         */
+        template<typename function_t, typename... components_t>
+        void parallel_for_each(thread_pool &pool, query<components_t...> &entity_query, function_t function);
     };
 }
 
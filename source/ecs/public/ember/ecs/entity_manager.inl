@@ -11,7 +11,10 @@ namespace ember::inline ecs {
 
     entity entity_manager::create() {
         entity entity{ ++next_entity };
-        entities.push_back(entity);
+        if(entity >= alive_entities.size()) {
+            alive_entities.resize(entity + 1);
+        }
+        alive_entities.set(entity);
 
         return entity;
     }
@@ -46,7 +49,32 @@ namespace ember::inline ecs {
     }
 
     template<typename function_t, typename object_t>
-    void entity_manager::for_each(function_t function, object_t *object) {
+    void entity_manager::for_each(function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t> {
         components.for_each(function, object);
     }
+
+    template<typename function_t, typename... components_t>
+    void entity_manager::for_each(query<components_t...> &entity_query, function_t function) {
+        components.for_each(entity_query, function);
+    }
+
+    template<typename function_t, typename object_t, typename... components_t>
+    void entity_manager::for_each(query<components_t...> &entity_query, function_t function, object_t *object) {
+        components.for_each(entity_query, function, object);
+    }
+
+    template<typename function_t>
+    void entity_manager::parallel_for_each(thread_pool &pool, function_t function) {
+        components.parallel_for_each(pool, function);
+    }
+
+    template<typename function_t, typename object_t>
+    void entity_manager::parallel_for_each(thread_pool &pool, function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t> {
+        components.parallel_for_each(pool, function, object);
+    }
+
+    template<typename function_t, typename... components_t>
+    void entity_manager::parallel_for_each(thread_pool &pool, query<components_t...> &entity_query, function_t function) {
+        components.parallel_for_each(pool, entity_query, function);
+    }
 }
\ No newline at end of file
@@ -1,7 +1,8 @@
 #pragma once
 
-#include <tuple>
 #include <cstddef>
+#include <tuple>
+#include <utility>
 
 namespace ember::inline ecs::internal {
     template<typename function_t>
@@ -31,4 +32,20 @@ namespace ember::inline ecs::internal {
     //Callable function specialisation
     template<typename callable_t>
     struct function_traits : public function_traits<decltype(&callable_t::operator())> {};
+
+    /**
+     * @brief Binds a member function to an object, keeping the exact parameters of the member function.
+     */
+    template<typename function_t, typename object_t, typename parameters_tuple_t = typename function_traits<function_t>::parameter_types_tuple>
+    struct bound_member_function;
+
+    template<typename function_t, typename object_t, typename... parameters_t>
+    struct bound_member_function<function_t, object_t, std::tuple<parameters_t...>> {
+        function_t function;
+        object_t *object;
+
+        decltype(auto) operator()(parameters_t... parameters) const {
+            return (object->*function)(std::forward<parameters_t>(parameters)...);
+        }
+    };
 }
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "ember/ecs/archetype.hpp"
+#include "ember/ecs/function_traits.hpp"
+#include "ember/ecs/types.hpp"
+
+#include <array>
+#include <ember/containers/array.hpp>
+#include <ember/threading/thread_pool.hpp>
+#include <tuple>
+#include <utility>
+
+namespace ember::inline ecs {
+    class component_manager;
+}
+
+namespace ember::inline ecs::internal {
+    struct query_family;
+
+    /**
+     * @brief Lets a component_manager own queries of any type.
+     */
+    class query_base {
+    public:
+        virtual ~query_base() = default;
+    };
+}
+
+namespace ember::inline ecs {
+    /**
+     * @brief A cached view over every archetype that contains all of components_t.
+     * @details Matching archetypes and the offset of each component's column are resolved once. Each time the query
+     * runs only archetypes created since its last run are checked, so iterating does no lookups per entity. A query
+     * holds indices into a manager's archetypes so it should only ever be run against the same manager.
+     * @tparam components_t Components an entity needs for it to be visited.
+     */
+    template<typename... components_t>
+    class query : public internal::query_base {
+        friend class component_manager;
+
+        //TYPES
+    private:
+        struct matched_archetype {
+            std::size_t archetype_index{ 0 };                                  /**< Index into the manager's archetypes. Archetypes are never removed so this stays valid. */
+            std::array<std::size_t, sizeof...(components_t)> column_offsets{}; /**< Offset of each component's column within the archetype's chunks. */
+        };
+
+        struct chunk_range {
+            std::byte *chunk{ nullptr };
+            entity const *entities{ nullptr };
+            std::size_t count{ 0 };
+            matched_archetype const *match{ nullptr };
+        };
+
+        //VARIABLES
+    private:
+        component_mask_t match_mask{};
+        array<matched_archetype> matches{};
+        std::size_t checked_archetype_count{ 0 }; /**< Archetypes before this index have already been checked. */
+
+        //FUNCTIONS
+    public:
+        query();
+
+        query(query const &other);
+        query(query &&other) noexcept;
+
+        query &operator=(query const &other);
+        query &operator=(query &&other) noexcept;
+
+        ~query() override;
+
+        /**
+         * @brief Returns how many archetypes currently match this query.
+         */
+        std::size_t get_archetype_count() const;
+
+    private:
+        void update(array<archetype> const &archetypes);
+
+        template<typename function_t>
+        void for_each(array<archetype> &archetypes, function_t function);
+
+        /**
+         * @brief Splits every matching chunk into it's own job. Chunks never share entities so each component is only
+         * ever touched by one thread. function is called through a const reference so it can't mutate it's own state.
+         */
+        template<typename function_t>
+        void parallel_for_each(array<archetype> &archetypes, thread_pool &pool, function_t const &function);
+
+        template<typename function_t, std::size_t... component_indices_t>
+        static void invoke_on_chunk(function_t &function, std::byte *const chunk, entity const *const entities, std::size_t const count, matched_archetype const &match, std::index_sequence<component_indices_t...>);
+        template<typename function_t>
+        static void invoke_on_columns(function_t &function, entity const *const entities, std::size_t const count, components_t *const... columns);
+    };
+}
+
+namespace ember::inline ecs::internal {
+    /**
+     * @brief Gets the query type that matches a function's parameters. An entity as the first parameter is not a component.
+     */
+    template<typename parameters_tuple_t>
+    struct query_from_parameters;
+
+    template<typename... parameters_t>
+    struct query_from_parameters<std::tuple<parameters_t...>> {
+        using type = query<parameters_t...>;
+    };
+
+    template<typename... parameters_t>
+    struct query_from_parameters<std::tuple<entity, parameters_t...>> {
+        using type = query<parameters_t...>;
+    };
+
+    template<typename function_t>
+    using query_from_function_t = typename query_from_parameters<typename function_traits<function_t>::decayed_parameter_types_tuple>::type;
+}
+
+#include "query.inl"
@@ -0,0 +1,99 @@
+#include <type_traits>
+
+namespace ember::inline ecs {
+    template<typename... components_t>
+    query<components_t...>::query()
+        : match_mask{ make_component_mask(archetype_id_t{ id_generator::get<components_t>()... }) } {
+    }
+
+    template<typename... components_t>
+    query<components_t...>::query(query const &other) = default;
+
+    template<typename... components_t>
+    query<components_t...>::query(query &&other) noexcept = default;
+
+    template<typename... components_t>
+    query<components_t...> &query<components_t...>::operator=(query const &other) = default;
+
+    template<typename... components_t>
+    query<components_t...> &query<components_t...>::operator=(query &&other) noexcept = default;
+
+    template<typename... components_t>
+    query<components_t...>::~query() = default;
+
+    template<typename... components_t>
+    std::size_t query<components_t...>::get_archetype_count() const {
+        return matches.size();
+    }
+
+    template<typename... components_t>
+    void query<components_t...>::update(array<archetype> const &archetypes) {
+        for(; checked_archetype_count < archetypes.size(); ++checked_archetype_count) {
+            archetype const &archetype{ archetypes[checked_archetype_count] };
+            if(match_mask.is_subset_of(archetype.get_component_mask())) {
+                matches.push_back(matched_archetype{
+                    .archetype_index = checked_archetype_count,
+                    .column_offsets  = { archetype.get_column_offset(id_generator::get<components_t>())... },
+                });
+            }
+        }
+    }
+
+    template<typename... components_t>
+    template<typename function_t>
+    void query<components_t...>::for_each(array<archetype> &archetypes, function_t function) {
+        update(archetypes);
+
+        for(auto const &match : matches) {
+            archetype const &archetype{ archetypes[match.archetype_index] };
+            for(std::size_t chunk_index{ 0 }; chunk_index < archetype.get_chunk_count(); ++chunk_index) {
+                invoke_on_chunk(function, archetype.get_chunk(chunk_index), archetype.get_chunk_entities(chunk_index), archetype.get_chunk_entity_count(chunk_index), match, std::index_sequence_for<components_t...>{});
+            }
+        }
+    }
+
+    template<typename... components_t>
+    template<typename function_t>
+    void query<components_t...>::parallel_for_each(array<archetype> &archetypes, thread_pool &pool, function_t const &function) {
+        update(archetypes);
+
+        array<chunk_range> ranges{};
+        for(auto const &match : matches) {
+            archetype const &archetype{ archetypes[match.archetype_index] };
+            for(std::size_t chunk_index{ 0 }; chunk_index < archetype.get_chunk_count(); ++chunk_index) {
+                ranges.push_back(chunk_range{
+                    .chunk    = archetype.get_chunk(chunk_index),
+                    .entities = archetype.get_chunk_entities(chunk_index),
+                    .count    = archetype.get_chunk_entity_count(chunk_index),
+                    .match    = &match,
+                });
+            }
+        }
+
+        pool.parallel_for(ranges.size(), 1, [&ranges, &function](std::size_t const begin, std::size_t const end) {
+            for(std::size_t i{ begin }; i < end; ++i) {
+                chunk_range const &range{ ranges[i] };
+                invoke_on_chunk(function, range.chunk, range.entities, range.count, *range.match, std::index_sequence_for<components_t...>{});
+            }
+        });
+    }
+
+    template<typename... components_t>
+    template<typename function_t, std::size_t... component_indices_t>
+    void query<components_t...>::invoke_on_chunk(function_t &function, [[maybe_unused]] std::byte *const chunk, entity const *const entities, std::size_t const count, [[maybe_unused]] matched_archetype const &match, std::index_sequence<component_indices_t...>) {
+        invoke_on_columns(function, entities, count, reinterpret_cast<components_t *>(chunk + match.column_offsets[component_indices_t])...);
+    }
+
+    template<typename... components_t>
+    template<typename function_t>
+    void query<components_t...>::invoke_on_columns(function_t &function, entity const *const entities, std::size_t const count, components_t *const... columns) {
+        for(std::size_t i{ 0 }; i < count; ++i) {
+            //Functions can optionally take the entity before their components
+            if constexpr(std::is_invocable_v<function_t &, entity, components_t &...>) {
+                function(entities[i], columns[i]...);
+            } else {
+                function(columns[i]...);
+            }
+        }
+    }
+}
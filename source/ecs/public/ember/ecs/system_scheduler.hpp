@@ -0,0 +1,162 @@
+#pragma once
+
+#include "ember/ecs/component_access.hpp"
+#include "ember/ecs/entity_manager.hpp"
+#include "ember/ecs/function_traits.hpp"
+#include "ember/ecs/query.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <ember/containers/array.hpp>
+#include <ember/core/export.hpp>
+#include <ember/memory/unique_ptr.hpp>
+#include <ember/threading/thread_pool.hpp>
+#include <string>
+#include <type_traits>
+
+namespace ember::inline ecs::internal {
+    /**
+     * @brief Lets a system_scheduler own systems of any type.
+     */
+    class system_base {
+    public:
+        virtual ~system_base() = default;
+
+        virtual void run(entity_manager &manager) = 0;
+    };
+
+    template<typename function_t>
+    class system_impl : public system_base {
+        //VARIABLES
+    private:
+        function_t function;
+        query_from_function_t<function_t> entity_query{}; /**< Each system holds its own query so systems can run at the same time. */
+
+        //FUNCTIONS
+    public:
+        explicit system_impl(function_t function);
+
+        void run(entity_manager &manager) final;
+    };
+}
+
+namespace ember::inline ecs {
+    using system_handle = std::size_t;
+
+    /**
+     * @brief Runs a set of systems each tick, running systems that don't touch the same components at the same time.
+     * @details A system is a function that could be passed to entity_manager::for_each. Its parameters decide which
+     * components it reads and writes (see component_access). When two systems conflict, the one added first runs
+     * first, so adding systems in the order they used to be called keeps the same results. add_ordering can force
+     * an order between any two systems. Each system's run is profiled under its name and timed.
+     */
+    class EMBER_API system_scheduler {
+        //TYPES
+    private:
+        struct system {
+            std::string name{};
+            component_access access{};
+            unique_ptr<internal::system_base> instance{};
+            array<system_handle> explicit_successors{}; /**< Systems that add_ordering said must run after this one. */
+
+            array<system_handle> dependents{}; /**< Systems that can't start until this one finishes. */
+            std::size_t dependency_count{ 0 };
+            std::atomic<std::size_t> pending_dependencies{ 0 }; /**< Dependencies yet to finish during the current run. */
+
+            std::chrono::nanoseconds last_run_time{ 0 };
+        };
+
+        //VARIABLES
+    private:
+        array<unique_ptr<system>> systems{};
+        bool graph_dirty{ true };
+
+        array<job> jobs{}; /**< One job per system. */
+        std::atomic<std::size_t> remaining_systems{ 0 };
+        entity_manager *running_manager{ nullptr };
+        thread_pool *running_pool{ nullptr };
+
+        //FUNCTIONS
+    public:
+        system_scheduler();
+
+        system_scheduler(system_scheduler const &other) = delete;
+        system_scheduler(system_scheduler &&other)      = delete;
+
+        system_scheduler &operator=(system_scheduler const &other) = delete;
+        system_scheduler &operator=(system_scheduler &&other)      = delete;
+
+        ~system_scheduler();
+
+        /**
+         * @brief Adds a system that calls function for every entity that matches it's arguments.
+         * @tparam function_t Can be called from any of the pool's threads.
+         * @param name Used for profiling.
+         * @param function
+         * @return
+         */
+        template<typename function_t>
+        system_handle add_system(std::string name, function_t function);
+
+        /**
+         * @brief Adds a system that calls the member function for every entity that matches it's arguments.
+         * @tparam function_t
+         * @tparam object_t
+         * @param name Used for profiling.
+         * @param function
+         * @param object
+         * @return
+         */
+        template<typename function_t, typename object_t>
+        system_handle add_system(std::string name, function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t>;
+
+        /**
+         * @brief Makes sure first has finished before second starts, even if they don't share any components.
+         * Throws if second is already ordered before first, as that would create a cycle.
+         * @param first
+         * @param second
+         */
+        void add_ordering(system_handle const first, system_handle const second);
+
+        /**
+         * @brief Runs every system once, returning when they have all finished. Entities and components must not be
+         * added or removed while the systems are running.
+         * @param manager
+         * @param pool
+         */
+        void run(entity_manager &manager, thread_pool &pool);
+
+        std::size_t get_system_count() const;
+
+        std::string const &get_name(system_handle const system) const;
+        component_access const &get_access(system_handle const system) const;
+
+        /**
+         * @brief Returns true if system has to wait for dependency to finish before it can start.
+         * @param system
+         * @param dependency
+         * @return
+         */
+        bool depends_on(system_handle const system, system_handle const dependency);
+
+        /**
+         * @brief Returns how long the system took the last time the scheduler was run.
+         * @param system
+         * @return
+         */
+        std::chrono::nanoseconds get_last_run_time(system_handle const system) const;
+
+    private:
+        system_handle add_system(std::string name, component_access access, unique_ptr<internal::system_base> instance);
+
+        /**
+         * @brief Returns true if following add_ordering calls from first leads to second.
+         */
+        bool is_explicitly_ordered_before(system_handle const first, system_handle const second) const;
+        void build_graph();
+
+        static void run_system(void *context, std::size_t const index);
+    };
+}
+
+#include "system_scheduler.inl"
@@ -0,0 +1,24 @@
+namespace ember::inline ecs::internal {
+    template<typename function_t>
+    system_impl<function_t>::system_impl(function_t function)
+        : function{ std::move(function) } {
+    }
+
+    template<typename function_t>
+    void system_impl<function_t>::run(entity_manager &manager) {
+        manager.for_each(entity_query, function);
+    }
+}
+
+namespace ember::inline ecs {
+    template<typename function_t>
+    system_handle system_scheduler::add_system(std::string name, function_t function) {
+        return add_system(std::move(name), get_component_access<function_t>(), ember::make_unique<internal::system_impl<function_t>>(std::move(function)));
+    }
+
+    template<typename function_t, typename object_t>
+    system_handle system_scheduler::add_system(std::string name, function_t function, object_t *object) requires std::is_member_function_pointer_v<function_t> {
+        using member_function_t = internal::bound_member_function<function_t, object_t>;
+        return add_system(std::move(name), get_component_access<function_t>(), ember::make_unique<internal::system_impl<member_function_t>>(member_function_t{ function, object }));
+    }
+}
@@ -2,16 +2,47 @@
 
 #include <cinttypes>
 #include <ember/containers/array.hpp>
+#include <ember/containers/bitset.hpp>
+#include <ember/containers/small_array.hpp>
 
 namespace ember::inline ecs {
-    using id_t           = std::uint32_t;
-    using entity         = id_t;
-    using component_id_t = id_t;
-    using archetype_id_t = array<component_id_t>;
+    using id_t             = std::uint32_t;
+    using entity           = id_t;
+    using component_id_t   = id_t;
+    using archetype_id_t   = small_array<component_id_t, 8>;//Most archetypes only have a handful of components so keep their ids inline.
+    using component_mask_t = dynamic_bitset<>;              //One bit per component id, lets archetype matching be a handful of word operations.
 
     inline entity constexpr null_entity{ 0 };
 
-    class id_generator {
+    inline component_mask_t make_component_mask(archetype_id_t const &id) {
+        component_mask_t mask{};
+        for(auto component_id : id) {
+            if(component_id >= mask.size()) {
+                mask.resize(component_id + 1);
+            }
+            mask.set(component_id);
+        }
+        return mask;
+    }
+
+    /**
+     * @brief Hashes an archetype's sorted component ids so archetypes can be looked up by their signature.
+     */
+    struct archetype_id_hash {
+        std::size_t operator()(archetype_id_t const &id) const noexcept {
+            std::size_t hash{ id.size() };
+            for(component_id_t const component_id : id) {
+                hash ^= component_id + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    /**
+     * @brief Hands out sequential ids per type. Each family counts separately so unrelated ids stay dense.
+     */
+    template<typename family_t>
+    class basic_id_generator {
     private:
         inline static id_t count{ 0 };
 
@@ -22,4 +53,6 @@ namespace ember::inline ecs {
             return id_counter;
         }
     };
+
+    using id_generator = basic_id_generator<struct component_family>;
 }
\ No newline at end of file
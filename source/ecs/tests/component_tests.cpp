@@ -1,6 +1,10 @@
 #include <ember/ecs/entity_manager.hpp>
 #include <gtest/gtest.h>
 
+#include <array>
+#include <cstdint>
+#include <vector>
+
 using namespace ember;
 
 struct bool_component {
@@ -145,4 +149,132 @@ TEST(component_tests, can_remove_from_multiple_components) {
     EXPECT_TRUE(manager.has_component<bool_component>(entity_1));
     EXPECT_FALSE(manager.has_component<float_component>(entity_1));
     EXPECT_FALSE(manager.has_component<complex_component>(entity_1));
-}
\ No newline at end of file
+}
+TEST(component_tests, components_are_kept_when_spanning_many_chunks) {
+    entity_manager manager{};
+
+    //Enough entities that the archetype has to allocate several chunks.
+    std::vector<entity> entities{};
+    for(std::int32_t i{ 0 }; i < 5000; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<int_component>(entity, i);
+        manager.add_component<complex_component>(entity, i, i * 2, i * 3);
+        entities.push_back(entity);
+    }
+
+    //Removing from the middle moves the last entity of the last chunk into the gap.
+    for(std::size_t i{ 0 }; i < entities.size(); i += 3) {
+        manager.destroy(entities[i]);
+    }
+
+    for(std::size_t i{ 0 }; i < entities.size(); ++i) {
+        if(i % 3 == 0) {
+            EXPECT_FALSE(manager.is_valid(entities[i]));
+            continue;
+        }
+
+        std::int32_t const value{ static_cast<std::int32_t>(i) };
+        EXPECT_EQ(manager.get_component<int_component>(entities[i]).value, value);
+
+        auto const &complex_comp{ manager.get_component<complex_component>(entities[i]) };
+        EXPECT_EQ(complex_comp.a, value);
+        EXPECT_EQ(complex_comp.b, value * 2);
+        EXPECT_EQ(complex_comp.c, value * 3);
+    }
+}
+
+TEST(component_tests, components_larger_than_a_chunk_are_aligned) {
+    struct alignas(64) large_component {
+        std::array<std::byte, EMBER_KB(20)> data{};
+    };
+
+    entity_manager manager{};
+
+    entity entity_1{ manager.create() };
+    entity entity_2{ manager.create() };
+
+    manager.add_component<large_component>(entity_1).data[0] = std::byte{ 1 };
+    manager.add_component<float_component>(entity_1, 1.0f);
+    manager.add_component<large_component>(entity_2).data[0] = std::byte{ 2 };
+    manager.add_component<float_component>(entity_2, 2.0f);
+
+    auto const &large_comp_1{ manager.get_component<large_component>(entity_1) };
+    auto const &large_comp_2{ manager.get_component<large_component>(entity_2) };
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&large_comp_1) % alignof(large_component), 0);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(&large_comp_2) % alignof(large_component), 0);
+    EXPECT_EQ(large_comp_1.data[0], std::byte{ 1 });
+    EXPECT_EQ(large_comp_2.data[0], std::byte{ 2 });
+    EXPECT_EQ(manager.get_component<float_component>(entity_2).value, 2.0f);
+}
+
+TEST(component_tests, components_are_kept_when_toggling_tags) {
+    entity_manager manager{};
+
+    std::vector<entity> entities{};
+    for(std::int32_t i{ 0 }; i < 100; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<int_component>(entity).value = i;
+        manager.add_component<complex_component>(entity, i, i * 2, i * 3);
+        entities.push_back(entity);
+    }
+
+    for(std::size_t tick{ 0 }; tick < 10; ++tick) {
+        for(entity const entity : entities) {
+            manager.add_component<bool_component>(entity).value = true;
+        }
+        for(entity const entity : entities) {
+            EXPECT_TRUE(manager.get_component<bool_component>(entity).value);
+            manager.remove_component<bool_component>(entity);
+        }
+    }
+
+    for(std::int32_t i{ 0 }; i < 100; ++i) {
+        EXPECT_FALSE(manager.has_component<bool_component>(entities[i]));
+        EXPECT_EQ(manager.get_component<int_component>(entities[i]).value, i);
+        EXPECT_EQ(manager.get_component<complex_component>(entities[i]).c, i * 3);
+    }
+}
+
+TEST(component_tests, adding_components_in_any_order_shares_an_archetype) {
+    entity_manager manager{};
+
+    entity const entity_1{ manager.create() };
+    manager.add_component<int_component>(entity_1);
+    manager.add_component<float_component>(entity_1);
+    manager.add_component<bool_component>(entity_1);
+
+    entity const entity_2{ manager.create() };
+    manager.add_component<bool_component>(entity_2);
+    manager.add_component<int_component>(entity_2);
+    manager.add_component<float_component>(entity_2);
+
+    //Removing back down to a single component reuses the same archetypes as well.
+    entity const entity_3{ manager.create() };
+    manager.add_component<float_component>(entity_3);
+    manager.add_component<complex_component>(entity_3);
+    manager.add_component<bool_component>(entity_3);
+    manager.add_component<int_component>(entity_3);
+    manager.remove_component<complex_component>(entity_3);
+
+    query<int_component, float_component, bool_component> all_query{};
+    std::size_t visit_count{ 0 };
+    manager.for_each(all_query, [&visit_count](int_component &, float_component &, bool_component &) { ++visit_count; });
+
+    EXPECT_EQ(visit_count, 3);
+    EXPECT_EQ(all_query.get_archetype_count(), 2);//The archetype with complex_component also matches, now empty.
+
+    manager.remove_component<int_component>(entity_1);
+    manager.remove_component<float_component>(entity_1);
+    manager.remove_component<bool_component>(entity_2);
+    manager.remove_component<float_component>(entity_2);
+
+    query<bool_component> bool_query{};
+    query<int_component> int_query{};
+    std::size_t bool_count{ 0 };
+    std::size_t int_count{ 0 };
+    manager.for_each(bool_query, [&bool_count](bool_component &) { ++bool_count; });
+    manager.for_each(int_query, [&int_count](int_component &) { ++int_count; });
+
+    EXPECT_EQ(bool_count, 2);
+    EXPECT_EQ(int_count, 2);
+}
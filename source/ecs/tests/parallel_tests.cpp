@@ -0,0 +1,124 @@
+#include <ember/ecs/entity_manager.hpp>
+#include <ember/threading/thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <vector>
+
+using namespace ember;
+
+struct position_component {
+    float value{ 0.0f };
+};
+
+struct velocity_component {
+    float value{ 1.0f };
+};
+
+struct int_component {
+    std::int32_t value{ 0 };
+};
+
+struct visit_counter {
+    std::atomic<std::size_t> *count{ nullptr };
+
+    void visit(int_component &component) const {
+        ++component.value;
+        count->fetch_add(1);
+    }
+};
+
+TEST(parallel_tests, visits_every_matching_entity_once) {
+    std::size_t constexpr entity_count{ 50000 };
+
+    entity_manager manager{};
+    thread_pool pool{ 3 };
+
+    std::vector<entity> entities{};
+    for(std::size_t i{ 0 }; i < entity_count; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<position_component>(entity);
+        manager.add_component<velocity_component>(entity).value = static_cast<float>(i % 7);
+        if(i % 3 == 0) {
+            manager.add_component<int_component>(entity);
+        }
+        entities.push_back(entity);
+    }
+
+    std::atomic<std::size_t> visit_count{ 0 };
+    manager.parallel_for_each(pool, [&visit_count](position_component &position, velocity_component const &velocity) {
+        position.value += velocity.value;
+        visit_count.fetch_add(1);
+    });
+
+    EXPECT_EQ(visit_count.load(), entity_count);
+    for(std::size_t i{ 0 }; i < entity_count; ++i) {
+        EXPECT_EQ(manager.get_component<position_component>(entities[i]).value, static_cast<float>(i % 7));
+    }
+}
+
+TEST(parallel_tests, can_take_entity_and_use_query) {
+    entity_manager manager{};
+    thread_pool pool{ 2 };
+
+    for(std::size_t i{ 0 }; i < 10000; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<int_component>(entity);
+        if(i % 2 == 0) {
+            manager.add_component<position_component>(entity);
+        }
+    }
+
+    query<int_component> int_query{};
+    manager.parallel_for_each(pool, int_query, [](entity const entity, int_component &component) {
+        component.value = static_cast<std::int32_t>(entity);
+    });
+
+    std::size_t mismatch_count{ 0 };
+    manager.for_each(int_query, [&mismatch_count](entity const entity, int_component const &component) {
+        if(component.value != static_cast<std::int32_t>(entity)) {
+            ++mismatch_count;
+        }
+    });
+
+    EXPECT_EQ(int_query.get_archetype_count(), 2);
+    EXPECT_EQ(mismatch_count, 0);
+}
+
+TEST(parallel_tests, can_use_member_function) {
+    entity_manager manager{};
+    thread_pool pool{ 2 };
+
+    for(std::size_t i{ 0 }; i < 5000; ++i) {
+        manager.add_component<int_component>(manager.create());
+    }
+
+    std::atomic<std::size_t> visit_count{ 0 };
+    visit_counter counter{ &visit_count };
+    manager.parallel_for_each(pool, &visit_counter::visit, &counter);
+
+    EXPECT_EQ(visit_count.load(), 5000);
+}
+
+TEST(parallel_tests, component_access_follows_constness) {
+    auto const integrate{ [](position_component &, velocity_component const &) {} };
+    auto const read_velocity{ [](entity, velocity_component) {} };
+    auto const write_velocity{ [](velocity_component &) {} };
+    auto const read_int{ [](int_component const &) {} };
+
+    component_access const integrate_access{ get_component_access<decltype(integrate)>() };
+    EXPECT_TRUE(integrate_access.writes.test(id_generator::get<position_component>()));
+    EXPECT_TRUE(integrate_access.reads.test(id_generator::get<velocity_component>()));
+    EXPECT_EQ(integrate_access.writes.count(), 1);
+    EXPECT_EQ(integrate_access.reads.count(), 1);
+
+    component_access const read_velocity_access{ get_component_access<decltype(read_velocity)>() };
+    component_access const write_velocity_access{ get_component_access<decltype(write_velocity)>() };
+    component_access const read_int_access{ get_component_access<decltype(read_int)>() };
+
+    EXPECT_FALSE(integrate_access.conflicts_with(read_velocity_access));
+    EXPECT_FALSE(integrate_access.conflicts_with(read_int_access));
+    EXPECT_TRUE(integrate_access.conflicts_with(write_velocity_access));
+    EXPECT_TRUE(write_velocity_access.conflicts_with(integrate_access));
+    EXPECT_TRUE(write_velocity_access.conflicts_with(read_velocity_access));
+}
@@ -0,0 +1,118 @@
+#include <ember/ecs/entity_manager.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace ember;
+
+struct bool_component {
+    bool value{ false };
+};
+
+struct float_component {
+    float value{ 0.0f };
+};
+
+struct int_component {
+    std::int32_t value{ 0 };
+};
+
+class int_adder {
+public:
+    std::int32_t total{ 0 };
+
+    void add(int_component const &int_comp) {
+        total += int_comp.value;
+    }
+};
+
+TEST(query_tests, query_visits_matching_entities) {
+    entity_manager manager{};
+
+    entity entity_1{ manager.create() };
+    entity entity_2{ manager.create() };
+    entity entity_3{ manager.create() };
+
+    manager.add_component<int_component>(entity_1, 1);
+    manager.add_component<int_component>(entity_2, 2);
+    manager.add_component<float_component>(entity_2);
+    manager.add_component<float_component>(entity_3);
+
+    query<int_component, float_component> int_float_query{};
+
+    std::vector<entity> found_list{};
+    manager.for_each(int_float_query, [&](entity entity, int_component &int_comp, float_component &float_comp) {
+        found_list.push_back(entity);
+        float_comp.value = static_cast<float>(int_comp.value);
+    });
+
+    EXPECT_EQ(int_float_query.get_archetype_count(), 1);
+    ASSERT_EQ(found_list.size(), 1);
+    EXPECT_EQ(found_list[0], entity_2);
+    EXPECT_EQ(manager.get_component<float_component>(entity_2).value, 2.0f);
+}
+
+TEST(query_tests, query_finds_archetypes_created_after_it_has_run) {
+    entity_manager manager{};
+    query<int_component> int_query{};
+
+    entity entity_1{ manager.create() };
+    manager.add_component<int_component>(entity_1, 1);
+
+    std::int32_t total{ 0 };
+    manager.for_each(int_query, [&](int_component const &int_comp) { total += int_comp.value; });
+    EXPECT_EQ(total, 1);
+    EXPECT_EQ(int_query.get_archetype_count(), 1);
+
+    entity entity_2{ manager.create() };
+    manager.add_component<int_component>(entity_2, 10);
+    manager.add_component<bool_component>(entity_2);
+
+    entity entity_3{ manager.create() };
+    manager.add_component<bool_component>(entity_3);
+
+    total = 0;
+    manager.for_each(int_query, [&](int_component const &int_comp) { total += int_comp.value; });
+    EXPECT_EQ(total, 11);
+    EXPECT_EQ(int_query.get_archetype_count(), 2);
+
+    //Archetypes stay behind when they become empty, the query skips over them.
+    manager.remove_component<int_component>(entity_1);
+    manager.remove_component<bool_component>(entity_2);
+
+    std::vector<entity> found_list{};
+    manager.for_each(int_query, [&](entity entity, int_component const &) { found_list.push_back(entity); });
+    EXPECT_EQ(found_list, std::vector<entity>{ entity_2 });
+    EXPECT_EQ(int_query.get_archetype_count(), 2);
+}
+
+TEST(query_tests, query_can_use_member_function) {
+    entity_manager manager{};
+    query<int_component> int_query{};
+
+    for(std::int32_t i{ 1 }; i <= 4; ++i) {
+        entity entity{ manager.create() };
+        manager.add_component<int_component>(entity, i);
+    }
+
+    int_adder adder{};
+    manager.for_each(int_query, &int_adder::add, &adder);
+    EXPECT_EQ(adder.total, 10);
+}
+
+TEST(query_tests, query_without_components_visits_all_entities) {
+    entity_manager manager{};
+    query<> entity_query{};
+
+    entity entity_1{ manager.create() };
+    entity entity_2{ manager.create() };
+    manager.add_component<int_component>(entity_1);
+    manager.add_component<float_component>(entity_2);
+
+    std::vector<entity> found_list{};
+    manager.for_each(entity_query, [&](entity entity) { found_list.push_back(entity); });
+
+    std::sort(found_list.begin(), found_list.end());
+    EXPECT_EQ(found_list, (std::vector<entity>{ entity_1, entity_2 }));
+}
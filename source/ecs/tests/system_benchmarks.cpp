@@ -0,0 +1,308 @@
+#include <ember/ecs/entity_manager.hpp>
+#include <ember/ecs/system_scheduler.hpp>
+#include <ember/threading/thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr iteration_count{ 20 };
+
+    struct position_component {
+        float x{ 0.0f };
+        float y{ 0.0f };
+        float z{ 0.0f };
+    };
+
+    struct velocity_component {
+        float x{ 1.0f };
+        float y{ 2.0f };
+        float z{ 3.0f };
+    };
+
+    //Components a system that only moves things never reads, but which still widen the archetype.
+    template<std::size_t index>
+    struct payload_component {
+        std::array<float, 16> data{};
+    };
+
+    /**
+     * @brief Every component of a wide entity stored together, the way archetypes interleaved their components before
+     * they were split into columns.
+     */
+    struct interleaved_entity {
+        position_component position{};
+        velocity_component velocity{};
+        payload_component<0> payload_0{};
+        payload_component<1> payload_1{};
+        payload_component<2> payload_2{};
+        payload_component<3> payload_3{};
+    };
+
+    template<typename function_t>
+    double time_ms(function_t function) {
+        auto const start{ std::chrono::steady_clock::now() };
+        function();
+        auto const end{ std::chrono::steady_clock::now() };
+
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    void integrate(position_component &position, velocity_component const &velocity) {
+        position.x += velocity.x;
+        position.y += velocity.y;
+        position.z += velocity.z;
+    }
+
+    float sum_positions(entity_manager &manager) {
+        float sum{ 0.0f };
+        manager.for_each([&](position_component const &position) {
+            sum += position.x + position.y + position.z;
+        });
+        return sum;
+    }
+}
+
+TEST(system_benchmarks, narrow_and_wide_archetypes) {
+    std::printf("%10s %18s %18s %18s\n", "entities", "narrow ms", "wide ms", "interleaved ms");
+
+    for(std::size_t const entity_count : { 10000u, 100000u, 500000u }) {
+        entity_manager narrow_manager{};
+        entity_manager wide_manager{};
+        std::vector<interleaved_entity> interleaved(entity_count);
+
+        for(std::size_t i{ 0 }; i < entity_count; ++i) {
+            entity const narrow_entity{ narrow_manager.create() };
+            narrow_manager.add_component<position_component>(narrow_entity);
+            narrow_manager.add_component<velocity_component>(narrow_entity);
+
+            entity const wide_entity{ wide_manager.create() };
+            wide_manager.add_component<position_component>(wide_entity);
+            wide_manager.add_component<velocity_component>(wide_entity);
+            wide_manager.add_component<payload_component<0>>(wide_entity);
+            wide_manager.add_component<payload_component<1>>(wide_entity);
+            wide_manager.add_component<payload_component<2>>(wide_entity);
+            wide_manager.add_component<payload_component<3>>(wide_entity);
+        }
+
+        double const narrow_time{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                narrow_manager.for_each(integrate);
+            }
+        }) };
+
+        double const wide_time{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                wide_manager.for_each(integrate);
+            }
+        }) };
+
+        double const interleaved_time{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                for(auto &entity : interleaved) {
+                    integrate(entity.position, entity.velocity);
+                }
+            }
+        }) };
+
+        float interleaved_sum{ 0.0f };
+        for(auto const &entity : interleaved) {
+            interleaved_sum += entity.position.x + entity.position.y + entity.position.z;
+        }
+        EXPECT_EQ(sum_positions(narrow_manager), interleaved_sum);
+        EXPECT_EQ(sum_positions(wide_manager), interleaved_sum);
+
+        std::printf("%10zu %18.3f %18.3f %18.3f\n", entity_count, narrow_time, wide_time, interleaved_time);
+    }
+}
+
+TEST(system_benchmarks, per_call_overhead_with_many_archetypes) {
+    std::size_t constexpr call_count{ 10000 };
+    std::size_t constexpr entities_per_archetype{ 8 };
+
+    //Every combination of six tags alongside position and velocity, 64 archetypes with a handful of entities each.
+    entity_manager manager{};
+    for(std::size_t combination{ 0 }; combination < 64; ++combination) {
+        for(std::size_t i{ 0 }; i < entities_per_archetype; ++i) {
+            entity const entity{ manager.create() };
+            manager.add_component<position_component>(entity);
+            manager.add_component<velocity_component>(entity);
+
+            auto const add_tag{ [&]<std::size_t index>() {
+                if((combination & (1u << index)) != 0) {
+                    manager.add_component<payload_component<index>>(entity);
+                }
+            } };
+            add_tag.operator()<0>();
+            add_tag.operator()<1>();
+            add_tag.operator()<2>();
+            add_tag.operator()<3>();
+            add_tag.operator()<4>();
+            add_tag.operator()<5>();
+        }
+    }
+
+    double const rebuilt_time{ time_ms([&]() {
+        for(std::size_t call{ 0 }; call < call_count; ++call) {
+            //A fresh query has to match every archetype again, which is what for_each used to do on every call.
+            query<position_component, velocity_component> rebuilt_query{};
+            manager.for_each(rebuilt_query, integrate);
+        }
+    }) };
+
+    double const cached_time{ time_ms([&]() {
+        for(std::size_t call{ 0 }; call < call_count; ++call) {
+            manager.for_each(integrate);
+        }
+    }) };
+
+    query<position_component, velocity_component> held_query{};
+    double const held_time{ time_ms([&]() {
+        for(std::size_t call{ 0 }; call < call_count; ++call) {
+            manager.for_each(held_query, integrate);
+        }
+    }) };
+
+    EXPECT_EQ(held_query.get_archetype_count(), 64);
+
+    std::printf("%10s %18s %18s %18s\n", "calls", "rebuilt ms", "cached ms", "held ms");
+    std::printf("%10zu %18.3f %18.3f %18.3f\n", call_count, rebuilt_time, cached_time, held_time);
+}
+
+TEST(system_benchmarks, parallel_for_each_scaling) {
+    std::size_t constexpr entity_count{ 500000 };
+
+    entity_manager manager{};
+    for(std::size_t i{ 0 }; i < entity_count; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<position_component>(entity);
+        manager.add_component<velocity_component>(entity);
+    }
+
+    double const serial_time{ time_ms([&]() {
+        for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+            manager.for_each(integrate);
+        }
+    }) };
+
+    std::printf("%10s %18s %18s\n", "threads", "serial ms", "parallel ms");
+
+    std::size_t const max_thread_count{ std::max<std::size_t>(thread_pool::get_default_thread_count(), 1) };
+    for(std::size_t thread_count{ 1 }; thread_count <= max_thread_count; thread_count *= 2) {
+        thread_pool pool{ thread_count };
+
+        double const parallel_time{ time_ms([&]() {
+            for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+                manager.parallel_for_each(pool, integrate);
+            }
+        }) };
+
+        std::printf("%10zu %18.3f %18.3f\n", thread_count, serial_time, parallel_time);
+    }
+
+    //Every pass adds the velocity once more so each position should be a whole number of velocities.
+    std::size_t pass_count{ iteration_count };
+    for(std::size_t thread_count{ 1 }; thread_count <= max_thread_count; thread_count *= 2) {
+        pass_count += iteration_count;
+    }
+
+    std::size_t mismatch_count{ 0 };
+    manager.for_each([&](position_component const &position) {
+        if(position.x != static_cast<float>(pass_count) * velocity_component{}.x) {
+            ++mismatch_count;
+        }
+    });
+    EXPECT_EQ(mismatch_count, 0);
+}
+
+TEST(system_benchmarks, scheduled_systems) {
+    std::size_t constexpr entity_count{ 200000 };
+
+    //Each system only touches it's own payload so none of them conflict.
+    entity_manager manager{};
+    for(std::size_t i{ 0 }; i < entity_count; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<payload_component<0>>(entity);
+        manager.add_component<payload_component<1>>(entity);
+        manager.add_component<payload_component<2>>(entity);
+        manager.add_component<payload_component<3>>(entity);
+    }
+
+    auto const update_0{ [](payload_component<0> &payload) { payload.data[0] += 1.0f; } };
+    auto const update_1{ [](payload_component<1> &payload) { payload.data[0] += 1.0f; } };
+    auto const update_2{ [](payload_component<2> &payload) { payload.data[0] += 1.0f; } };
+    auto const update_3{ [](payload_component<3> &payload) { payload.data[0] += 1.0f; } };
+
+    double const serial_time{ time_ms([&]() {
+        for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+            manager.for_each(update_0);
+            manager.for_each(update_1);
+            manager.for_each(update_2);
+            manager.for_each(update_3);
+        }
+    }) };
+
+    system_scheduler scheduler{};
+    scheduler.add_system("update_0", update_0);
+    scheduler.add_system("update_1", update_1);
+    scheduler.add_system("update_2", update_2);
+    scheduler.add_system("update_3", update_3);
+
+    thread_pool pool{};
+    double const scheduled_time{ time_ms([&]() {
+        for(std::size_t iteration{ 0 }; iteration < iteration_count; ++iteration) {
+            scheduler.run(manager, pool);
+        }
+    }) };
+
+    std::size_t mismatch_count{ 0 };
+    manager.for_each([&](payload_component<0> const &payload_0, payload_component<3> const &payload_3) {
+        if(payload_0.data[0] != static_cast<float>(iteration_count * 2) || payload_3.data[0] != static_cast<float>(iteration_count * 2)) {
+            ++mismatch_count;
+        }
+    });
+    EXPECT_EQ(mismatch_count, 0);
+
+    std::printf("%10s %18s %18s\n", "threads", "serial ms", "scheduled ms");
+    std::printf("%10zu %18.3f %18.3f\n", pool.get_thread_count() + 1, serial_time, scheduled_time);
+}
+
+TEST(system_benchmarks, tag_toggling) {
+    std::size_t constexpr entity_count{ 10000 };
+    std::size_t constexpr toggle_count{ 20 };
+
+    struct tag_component {};
+
+    entity_manager manager{};
+    std::vector<entity> entities{};
+    for(std::size_t i{ 0 }; i < entity_count; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<position_component>(entity);
+        manager.add_component<velocity_component>(entity);
+        manager.add_component<payload_component<0>>(entity);
+        entities.push_back(entity);
+    }
+
+    double const toggle_time{ time_ms([&]() {
+        for(std::size_t toggle{ 0 }; toggle < toggle_count; ++toggle) {
+            for(entity const entity : entities) {
+                manager.add_component<tag_component>(entity);
+            }
+            for(entity const entity : entities) {
+                manager.remove_component<tag_component>(entity);
+            }
+        }
+    }) };
+
+    std::size_t const transition_count{ entity_count * toggle_count * 2 };
+    std::printf("%12s %18s %18s\n", "transitions", "total ms", "ns / transition");
+    std::printf("%12zu %18.3f %18.3f\n", transition_count, toggle_time, (toggle_time * 1000000.0) / static_cast<double>(transition_count));
+
+    EXPECT_FALSE(manager.has_component<tag_component>(entities[0]));
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include <ember/ecs/entity_manager.hpp>
+#include <ember/ecs/system_scheduler.hpp>
+#include <ember/threading/thread_pool.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace ember;
+
+namespace {
+    struct position_component {
+        float value{ 0.0f };
+    };
+
+    struct velocity_component {
+        float value{ 1.0f };
+    };
+
+    struct health_component {
+        std::int32_t value{ 100 };
+    };
+
+    void integrate(position_component &position, velocity_component const &velocity) {
+        position.value += velocity.value;
+    }
+
+    void accelerate(velocity_component &velocity) {
+        velocity.value *= 2.0f;
+    }
+
+    void read_position(position_component const &) {}
+
+    void damage(health_component &health) {
+        health.value -= 1;
+    }
+
+    struct health_system {
+        std::int32_t amount{ 0 };
+
+        void heal(health_component &health) {
+            health.value += amount;
+        }
+    };
+
+    /**
+     * @brief Waits for another thread to flip a flag, giving up after a while so a test fails rather than hangs.
+     */
+    bool wait_for(std::atomic<bool> const &flag) {
+        auto const give_up{ std::chrono::steady_clock::now() + std::chrono::seconds{ 5 } };
+        while(!flag.load()) {
+            if(std::chrono::steady_clock::now() > give_up) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        return true;
+    }
+}
+
+TEST(system_scheduler_tests, conflicting_systems_depend_on_each_other) {
+    system_scheduler scheduler{};
+
+    system_handle const integrate_system{ scheduler.add_system("integrate", integrate) };
+    system_handle const accelerate_system{ scheduler.add_system("accelerate", accelerate) };
+    system_handle const read_system{ scheduler.add_system("read_position", read_position) };
+    system_handle const damage_system{ scheduler.add_system("damage", damage) };
+
+    EXPECT_EQ(scheduler.get_system_count(), 4);
+    EXPECT_EQ(scheduler.get_name(damage_system), "damage");
+
+    //accelerate writes the velocity integrate reads, and read_position reads the position integrate writes.
+    EXPECT_TRUE(scheduler.depends_on(accelerate_system, integrate_system));
+    EXPECT_TRUE(scheduler.depends_on(read_system, integrate_system));
+    EXPECT_FALSE(scheduler.depends_on(integrate_system, accelerate_system));
+
+    EXPECT_FALSE(scheduler.depends_on(read_system, accelerate_system));
+    EXPECT_FALSE(scheduler.depends_on(damage_system, integrate_system));
+    EXPECT_FALSE(scheduler.depends_on(damage_system, accelerate_system));
+}
+
+TEST(system_scheduler_tests, explicit_ordering_overrides_the_order_systems_were_added) {
+    system_scheduler scheduler{};
+
+    system_handle const integrate_system{ scheduler.add_system("integrate", integrate) };
+    system_handle const accelerate_system{ scheduler.add_system("accelerate", accelerate) };
+    system_handle const damage_system{ scheduler.add_system("damage", damage) };
+
+    scheduler.add_ordering(accelerate_system, integrate_system);
+    scheduler.add_ordering(integrate_system, damage_system);
+
+    EXPECT_TRUE(scheduler.depends_on(integrate_system, accelerate_system));
+    EXPECT_FALSE(scheduler.depends_on(accelerate_system, integrate_system));
+    EXPECT_TRUE(scheduler.depends_on(damage_system, integrate_system));
+
+    entity_manager manager{};
+    thread_pool pool{ 2 };
+
+    entity const entity{ manager.create() };
+    manager.add_component<position_component>(entity);
+    manager.add_component<velocity_component>(entity);
+
+    scheduler.run(manager, pool);
+
+    //Velocity was doubled before it was added to the position.
+    EXPECT_EQ(manager.get_component<position_component>(entity).value, 2.0f);
+}
+
+TEST(system_scheduler_tests, ordering_cycles_are_rejected) {
+    system_scheduler scheduler{};
+
+    system_handle const first{ scheduler.add_system("damage", damage) };
+    system_handle const second{ scheduler.add_system("read_position", read_position) };
+
+    system_handle const third{ scheduler.add_system("integrate", integrate) };
+
+    scheduler.add_ordering(first, second);
+    scheduler.add_ordering(second, third);
+
+#if EMBER_CORE_ENABLE_EXCEPTIONS
+    EXPECT_ANY_THROW(scheduler.add_ordering(third, first));
+    EXPECT_ANY_THROW(scheduler.add_ordering(second, second));
+
+    //The rejected orderings were not kept.
+    EXPECT_TRUE(scheduler.depends_on(third, second));
+    EXPECT_FALSE(scheduler.depends_on(first, third));
+#else
+    EXPECT_DEATH(scheduler.add_ordering(third, first), "");
+    EXPECT_DEATH(scheduler.add_ordering(second, second), "");
+#endif
+}
+
+TEST(system_scheduler_tests, runs_every_system_in_dependency_order) {
+    entity_manager manager{};
+    thread_pool pool{ 3 };
+
+    for(std::size_t i{ 0 }; i < 1000; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<position_component>(entity);
+        manager.add_component<velocity_component>(entity);
+        manager.add_component<health_component>(entity);
+    }
+
+    health_system healer{ 5 };
+
+    system_scheduler scheduler{};
+    scheduler.add_system("integrate", integrate);
+    scheduler.add_system("accelerate", accelerate);
+    scheduler.add_system("damage", damage);
+    system_handle const heal_system{ scheduler.add_system("heal", &health_system::heal, &healer) };
+
+    EXPECT_TRUE(get_component_access<decltype(&health_system::heal)>().writes.test(id_generator::get<health_component>()));
+    EXPECT_TRUE(scheduler.get_access(heal_system).writes.test(id_generator::get<health_component>()));
+
+    std::size_t constexpr tick_count{ 3 };
+    for(std::size_t tick{ 0 }; tick < tick_count; ++tick) {
+        scheduler.run(manager, pool);
+    }
+
+    //Velocity goes 1, 2, 4 before each integrate so each position should be 7.
+    std::size_t mismatch_count{ 0 };
+    manager.for_each([&](position_component const &position, velocity_component const &velocity, health_component const &health) {
+        if(position.value != 7.0f || velocity.value != 8.0f || health.value != 100 + static_cast<std::int32_t>(tick_count) * 4) {
+            ++mismatch_count;
+        }
+    });
+    EXPECT_EQ(mismatch_count, 0);
+}
+
+TEST(system_scheduler_tests, systems_that_only_read_run_at_the_same_time) {
+    entity_manager manager{};
+    thread_pool pool{ 2 };
+
+    manager.add_component<position_component>(manager.create());
+
+    std::atomic<bool> first_started{ false };
+    std::atomic<bool> second_started{ false };
+    std::atomic<bool> first_saw_second{ false };
+    std::atomic<bool> second_saw_first{ false };
+
+    //Each waits for the other to start, which can only happen if they are running at the same time.
+    system_scheduler scheduler{};
+    system_handle const first{ scheduler.add_system("first", [&](position_component const &) {
+        first_started.store(true);
+        first_saw_second.store(wait_for(second_started));
+    }) };
+    system_handle const second{ scheduler.add_system("second", [&](position_component const &) {
+        second_started.store(true);
+        second_saw_first.store(wait_for(first_started));
+    }) };
+
+    EXPECT_FALSE(scheduler.depends_on(second, first));
+
+    scheduler.run(manager, pool);
+
+    EXPECT_TRUE(first_saw_second.load());
+    EXPECT_TRUE(second_saw_first.load());
+    EXPECT_GT(scheduler.get_last_run_time(first).count(), 0);
+}
+
+TEST(system_scheduler_tests, runs_without_workers) {
+    entity_manager manager{};
+    thread_pool pool{ 0 };
+
+    entity const entity{ manager.create() };
+    manager.add_component<position_component>(entity);
+    manager.add_component<velocity_component>(entity);
+
+    system_scheduler scheduler{};
+    scheduler.add_system("accelerate", accelerate);
+    scheduler.add_system("integrate", integrate);
+
+    scheduler.run(manager, pool);
+
+    EXPECT_EQ(manager.get_component<position_component>(entity).value, 2.0f);
+}
@@ -222,13 +222,13 @@ TEST(system_tests, entities_components_are_removed) {
     std::int32_t bool_comp_count{ 0 };
     std::int32_t complex_comp_count{ 0 };
 
-    manager.for_each([&](int_component const &comp) {
+    manager.for_each([&](int_component const &) {
         ++int_comp_count;
     });
-    manager.for_each([&](bool_component const &comp) {
+    manager.for_each([&](bool_component const &) {
         ++bool_comp_count;
     });
-    manager.for_each([&](complex_component const &comp) {
+    manager.for_each([&](complex_component const &) {
         ++complex_comp_count;
     });
 
@@ -242,13 +242,13 @@ TEST(system_tests, entities_components_are_removed) {
 
     manager.remove_component<int_component>(entity_2);
 
-    manager.for_each([&](int_component const &comp) {
+    manager.for_each([&](int_component const &) {
         ++int_comp_count;
     });
-    manager.for_each([&](bool_component const &comp) {
+    manager.for_each([&](bool_component const &) {
         ++bool_comp_count;
     });
-    manager.for_each([&](complex_component const &comp) {
+    manager.for_each([&](complex_component const &) {
         ++complex_comp_count;
     });
 
@@ -262,13 +262,13 @@ TEST(system_tests, entities_components_are_removed) {
 
     manager.destroy(entity_1);
 
-    manager.for_each([&](int_component const &comp) {
+    manager.for_each([&](int_component const &) {
         ++int_comp_count;
     });
-    manager.for_each([&](bool_component const &comp) {
+    manager.for_each([&](bool_component const &) {
         ++bool_comp_count;
     });
-    manager.for_each([&](complex_component const &comp) {
+    manager.for_each([&](complex_component const &) {
         ++complex_comp_count;
     });
 
@@ -282,13 +282,13 @@ TEST(system_tests, entities_components_are_removed) {
 
     manager.destroy_all();
 
-    manager.for_each([&](int_component const &comp) {
+    manager.for_each([&](int_component const &) {
         ++int_comp_count;
     });
-    manager.for_each([&](bool_component const &comp) {
+    manager.for_each([&](bool_component const &) {
         ++bool_comp_count;
     });
-    manager.for_each([&](complex_component const &comp) {
+    manager.for_each([&](complex_component const &) {
         ++complex_comp_count;
     });
 
@@ -313,7 +313,7 @@ TEST(system_tests, can_get_entity) {
 
     std::vector<entity> found_list{};
 
-    manager.for_each([&](entity entity, int_component &comp) {
+    manager.for_each([&](entity entity, int_component &) {
         found_list.push_back(entity);
     });
 
@@ -322,6 +322,37 @@ TEST(system_tests, can_get_entity) {
     EXPECT_TRUE(std::find(found_list.begin(), found_list.end(), entity_3) != found_list.end());
 }
 
+TEST(system_tests, iterates_every_chunk) {
+    entity_manager manager{};
+
+    std::vector<entity> entities{};
+    for(std::int32_t i{ 0 }; i < 10000; ++i) {
+        entity const entity{ manager.create() };
+        manager.add_component<int_component>(entity, i);
+        manager.add_component<float_component>(entity);
+        entities.push_back(entity);
+    }
+
+    manager.for_each([](int_component const &int_comp, float_component &float_comp) {
+        float_comp.value = static_cast<float>(int_comp.value);
+    });
+
+    std::int64_t entity_sum{ 0 };
+    std::size_t visited{ 0 };
+    manager.for_each([&](entity entity, float_component &float_comp) {
+        EXPECT_EQ(float_comp.value, static_cast<float>(manager.get_component<int_component>(entity).value));
+        entity_sum += entity;
+        ++visited;
+    });
+
+    std::int64_t expected_sum{ 0 };
+    for(entity const entity : entities) {
+        expected_sum += entity;
+    }
+    EXPECT_EQ(visited, entities.size());
+    EXPECT_EQ(entity_sum, expected_sum);
+}
+
 /*
 TEST(system_tests, can_exclude_components_with_lambda_function) {
 }
@@ -21,13 +21,15 @@ namespace ember::inline graphics {
     command_buffer::command_buffer(command_buffer &&other) noexcept
         : head{ other.head }
         , arenas{ std::move(other.arenas) }
-        , current_arena{ other.current_arena } {
+        , current_arena{ other.current_arena }
+        , allocator{ other.allocator } {
     }
 
     command_buffer &command_buffer::operator=(command_buffer &&other) noexcept {
         head          = other.head;
         arenas        = std::move(other.arenas);
         current_arena = other.current_arena;
+        allocator     = other.allocator;
 
         return *this;
     }
@@ -36,7 +38,7 @@ namespace ember::inline graphics {
         if(!arenas.empty()) {
             destruct_items();
             for(auto &arena : arenas) {
-                memory::free(arena.memory);
+                allocator.free(arena.memory);
             }
         }
     }
@@ -53,7 +55,7 @@ namespace ember::inline graphics {
             }
 
             if(next_arena == nullptr) {
-                arenas.emplace_back(memory::alloc(initial_buffer_size, command_alignment), initial_buffer_size);
+                arenas.emplace_back(allocator.alloc(initial_buffer_size, command_alignment), initial_buffer_size);
                 next_arena = &arenas.back();
             }
 
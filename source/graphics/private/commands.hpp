@@ -10,6 +10,7 @@
 #include <cinttypes>
 #include <cstddef>
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <ember/maths/vector.hpp>
 #include <ember/memory/memory.hpp>
 #include <span>
@@ -186,9 +187,9 @@ namespace ember::inline graphics {
         render_pass const *const render_pass;
         framebuffer const *const framebuffer;
         render_area const render_area;
-        array<clear_value> clear_values;
+        small_array<clear_value, 4> clear_values;
 
-        recorded_command(graphics::render_pass const *const render_pass, graphics::framebuffer const *const framebuffer, graphics::render_area const render_area, array<clear_value> clear_values)
+        recorded_command(graphics::render_pass const *const render_pass, graphics::framebuffer const *const framebuffer, graphics::render_area const render_area, small_array<clear_value, 4> clear_values)
             : render_pass{ render_pass }
             , framebuffer{ framebuffer }
             , render_area{ render_area }
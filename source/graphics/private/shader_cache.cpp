@@ -49,10 +49,11 @@ namespace ember::inline graphics {
         EMBER_THROW_IF_FAILED(source_path.has_filename(), shader_compilation_failed_exception("Failed to compile shader. source_path is not a file", source_path.string()));
 
         array<char> const source{ read_file(source_path) };
-        raw_shaders[shader_name] = std::string{ source.data(), source.size() };
+        std::string shader_source{ source.data(), source.size() };
 
         //TODO: Actually add jobs instead of doing it synchronously
-        compiled_shaders[shader_name] = compile(shader_name, raw_shaders[shader_name], shader_stage);
+        compiled_shaders.insert_or_assign(shader_name, compile(shader_name, shader_source, shader_stage));
+        raw_shaders.insert_or_assign(shader_name, std::move(shader_source));
     }
 
     array<std::uint32_t> shader_cache::compile(std::string const &shader_name, std::string const &shader_source, shader::stage const shader_stage) {
@@ -61,43 +61,30 @@ namespace ember::inline graphics {
     }
 
     bool device_memory_allocator::block::free(chunk const *&chunk_ptr) {
-        for(auto curr_chunk{ std::begin(chunks) }; curr_chunk != std::end(chunks); ++curr_chunk) {
-            if(*curr_chunk == *chunk_ptr) {
-                curr_chunk->free = true;
-
-                bool remove_index{ false };
-                bool remove_right{ false };
-
-                //Merge neighbouring chunks
-                if(auto right_chunk{ std::next(curr_chunk) }; right_chunk != std::end(chunks) && right_chunk->free) {
-                    //Merge right into us
-                    curr_chunk->bytes += right_chunk->bytes;
-
-                    remove_right = true;
-                }
-                if(curr_chunk != std::begin(chunks)) {
-                    if(auto left_chunk{ std::prev(curr_chunk) }; left_chunk->free) {
-                        //Merge ourselves into left
-                        left_chunk->bytes += curr_chunk->bytes;
-
-                        remove_index = true;
-                    }
-                }
+        if(chunk_ptr->memory != memory) {
+            return false;
+        }
 
-                //Remove the right most first to preserve indices
-                if(remove_right) {
-                    chunks.erase(std::next(curr_chunk));
-                }
-                if(remove_index) {
-                    chunks.erase(curr_chunk);
-                }
+        //Chunks live inside the list's nodes so we can jump straight to it instead of searching.
+        auto curr_chunk{ chunks.iterator_to(const_cast<chunk &>(*chunk_ptr)) };
+        curr_chunk->free = true;
 
-                chunk_ptr = nullptr;
-                return true;
+        //Merge neighbouring chunks
+        if(auto right_chunk{ std::next(curr_chunk) }; right_chunk != std::end(chunks) && right_chunk->free) {
+            //Merge right into us
+            curr_chunk->bytes += right_chunk->bytes;
+            chunks.erase(right_chunk);
+        }
+        if(curr_chunk != std::begin(chunks)) {
+            if(auto left_chunk{ std::prev(curr_chunk) }; left_chunk->free) {
+                //Merge ourselves into left
+                left_chunk->bytes += curr_chunk->bytes;
+                chunks.erase(curr_chunk);
             }
         }
 
-        return false;
+        chunk_ptr = nullptr;
+        return true;
     }
 
     device_memory_allocator::chunk const *device_memory_allocator::alloc(VkMemoryRequirements const &memory_requirements, VkMemoryPropertyFlags const properties) {
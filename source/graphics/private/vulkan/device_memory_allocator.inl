@@ -6,7 +6,7 @@ namespace ember::inline graphics {
         , memory{ memory }
         , bytes{ bytes }
         , memory_type_index{ memory_type_index } {
-        chunks.emplace_back(0, bytes, memory);
+        chunks.push_back(chunk{ 0, bytes, memory });
     }
 
     device_memory_allocator::block::block(block &&other) noexcept
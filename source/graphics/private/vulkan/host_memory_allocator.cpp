@@ -1,15 +1,42 @@
 #include "host_memory_allocator.hpp"
 
-#include <ember/memory/memory.hpp>
+#include <array>
 #include <cstring>
+#include <ember/memory/memory.hpp>
+#include <ember/memory/memory_tag.hpp>
+
+namespace {
+    ember::memory_tag get_allocation_scope_tag(VkSystemAllocationScope const allocation_scope) {
+        //Indexed by VkSystemAllocationScope so each scope's usage and budget can be tracked separately.
+        static std::array<ember::memory_tag, 5> const scope_tags{
+            ember::register_memory_tag("Vulkan Command"),
+            ember::register_memory_tag("Vulkan Object"),
+            ember::register_memory_tag("Vulkan Cache"),
+            ember::register_memory_tag("Vulkan Device"),
+            ember::register_memory_tag("Vulkan Instance"),
+        };
+
+        return static_cast<std::size_t>(allocation_scope) < scope_tags.size() ? scope_tags[allocation_scope] : ember::untagged_memory_tag;
+    }
+}
 
 namespace ember::inline graphics {
     void *alloc(void *user_data, std::size_t size, std::size_t alignment, VkSystemAllocationScope allocation_scope) {
-        return memory::alloc(size, alignment);
+        return memory::alloc(size, alignment, get_allocation_scope_tag(allocation_scope));
     }
 
     void *realloc(void *user_data, void *original, std::size_t size, std::size_t alignment, VkSystemAllocationScope allocation_scope) {
         auto *original_memory{ reinterpret_cast<std::byte *>(original) };
+
+        if(original_memory == nullptr) {
+            return alloc(user_data, size, alignment, allocation_scope);
+        }
+        //Vulkan expects a reallocation to 0 bytes to behave like a free.
+        if(size == 0) {
+            memory::free(original_memory);
+            return nullptr;
+        }
+
         return memory::realloc(original_memory, size, alignment);
     }
 
@@ -17,4 +44,4 @@ namespace ember::inline graphics {
         auto *mem{ reinterpret_cast<std::byte *>(memory) };
         memory::free(mem);
     }
-}
\ No newline at end of file
+}
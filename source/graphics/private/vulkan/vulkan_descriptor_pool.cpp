@@ -10,14 +10,14 @@ namespace ember::inline graphics {
         return desc;
     }
 
-    unique_ptr<descriptor_set> vulkan_descriptor_pool::allocate_descriptor_set(descriptor_set_layout const &layout) {
+    pooled_ptr<descriptor_set> vulkan_descriptor_pool::allocate_descriptor_set(descriptor_set_layout const &layout) {
         return std::move(allocate_descriptor_sets({ &layout })[0]);
     }
 
-    array<unique_ptr<descriptor_set>> vulkan_descriptor_pool::allocate_descriptor_sets(array<descriptor_set_layout const *> const &layouts) {
+    array<pooled_ptr<descriptor_set>> vulkan_descriptor_pool::allocate_descriptor_sets(small_array<descriptor_set_layout const *, 4> const &layouts) {
         std::size_t const num_sets{ layouts.size() };
 
-        array<VkDescriptorSetLayout> layout_handles(num_sets);
+        small_array<VkDescriptorSetLayout, 4> layout_handles(num_sets);
         for(std::size_t i{ 0 }; i < num_sets; ++i) {
             layout_handles[i] = resource_cast<vulkan_descriptor_set_layout const>(layouts[i])->get_handle();
         }
@@ -33,9 +33,9 @@ namespace ember::inline graphics {
         array<VkDescriptorSet> descriptor_set_handles(num_sets);
         EMBER_VULKAN_VERIFY_RESULT(vkAllocateDescriptorSets(device, &allocation_info, std::data(descriptor_set_handles)), "Could not allocate VkDescriptorSets.");
 
-        array<unique_ptr<descriptor_set>> descriptor_sets(num_sets);
+        array<pooled_ptr<descriptor_set>> descriptor_sets(num_sets);
         for(std::size_t i{ 0 }; i < num_sets; ++i) {
-            descriptor_sets[i] = make_unique<vulkan_descriptor_set>(device, descriptor_set_handles[i]);
+            descriptor_sets[i] = make_pooled<vulkan_descriptor_set>(device, descriptor_set_handles[i]);
         }
 
         return descriptor_sets;
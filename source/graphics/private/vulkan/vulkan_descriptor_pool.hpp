@@ -28,8 +28,8 @@ namespace ember::inline graphics {
 
         descriptor const &get_descriptor() const override;
 
-        unique_ptr<descriptor_set> allocate_descriptor_set(descriptor_set_layout const &layout) override;
-        array<unique_ptr<descriptor_set>> allocate_descriptor_sets(array<descriptor_set_layout const *> const &layouts) override;
+        pooled_ptr<descriptor_set> allocate_descriptor_set(descriptor_set_layout const &layout) override;
+        array<pooled_ptr<descriptor_set>> allocate_descriptor_sets(small_array<descriptor_set_layout const *, 4> const &layouts) override;
 
         void reset() override;
 
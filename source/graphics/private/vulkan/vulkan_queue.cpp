@@ -19,6 +19,7 @@
 #include "vulkan_swapchain.hpp"
 
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <ember/core/log.hpp>
 #include <ember/core/profiling.hpp>
 
@@ -61,6 +62,9 @@ namespace {
 
     template<typename... Ts>
     struct match : Ts... { using Ts::operator()...; };
+
+    template<typename T, std::size_t inline_capacity>
+    using submit_array = ember::small_array<T, inline_capacity, ember::allocator_ref<ember::linear_allocator>>;
 }
 
 namespace ember::inline graphics {
@@ -134,8 +138,8 @@ namespace ember::inline graphics {
     #endif
     #if EMBER_CORE_ENABLE_PROFILING
                     //TODO: Proper file / line location etc. Just using the current file at the moment which isn't useful
-                    if(!queue.source_datas.contains(command->name)) {
-                        queue.source_datas[command->name] = source_data{
+                    auto const create_source_data{ [&]() {
+                        auto data{ make_unique<source_data>(source_data{
                             .name            = command->name,
                             .source_location = tracy::SourceLocationData{
                                 .name     = "NAME NOT YET SET",
@@ -144,12 +148,16 @@ namespace ember::inline graphics {
                                 .line     = 0, //TODO
                                 .color    = core::internal::rgb_to_32(command->colour.r, command->colour.g, command->colour.b, command->colour.a),
                             },
-                        };
+                        }) };
 
                         //Have to set the name after the fact so the pointers are correct
-                        queue.source_datas.at(command->name).source_location.name = queue.source_datas.at(command->name).name.c_str();
-                    }
-                    queue.scoped_events.emplace(queue.profiling_context, &queue.source_datas.at(command->name).source_location, vk_cmd_buffer, true);
+                        data->source_location.name = data->name.c_str();
+                        return data;
+                    } };
+                    source_data *const data{ queue.source_datas.find_or_insert(command->name, create_source_data, [](unique_ptr<source_data> const &boxed_data) {
+                        return boxed_data.get();
+                    }) };
+                    queue.scoped_events.emplace(queue.profiling_context, &data->source_location, vk_cmd_buffer, true);
     #endif
                 } break;
                 case command_type::pop_user_marker_command:
@@ -319,7 +327,7 @@ namespace ember::inline graphics {
                 case command_type::begin_render_pass_command: {
                     auto *command{ reinterpret_cast<recorded_command<command_type::begin_render_pass_command> *>(command_memory) };
 
-                    array<VkClearValue> clear_values(command->clear_values.size());
+                    submit_array<VkClearValue, 4> clear_values(command->clear_values.size(), allocator_ref{ queue.submit_allocator });
                     for(std::size_t i{ 0 }; i < command->clear_values.size(); ++i) {
                         std::visit(match{
                                        [&](colour_value const colour) { clear_values[i].color = { colour.r, colour.g, colour.b, colour.a }; },
@@ -454,6 +462,7 @@ namespace ember::inline graphics {
         EMBER_PROFILE_FUNCTION;
 
         reset_available_buffers(queue);
+        queue.submit_allocator.reset();
 
         VkCommandBufferBeginInfo const begin_info{
             .sType            = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,
@@ -482,8 +491,8 @@ namespace ember::inline graphics {
         }
 
         //Do the actual queue submission
-        array<VkSemaphore> wait_semaphores{};
-        array<VkPipelineStageFlags> wait_stages{};
+        submit_array<VkSemaphore, 4> wait_semaphores{ allocator_ref{ queue.submit_allocator } };
+        submit_array<VkPipelineStageFlags, 4> wait_stages{ allocator_ref{ queue.submit_allocator } };
         std::size_t const wait_semaphore_count{ submit_info.wait_semaphores.size() };
         wait_semaphores.resize(wait_semaphore_count);
         wait_stages.resize(wait_semaphore_count);
@@ -492,7 +501,7 @@ namespace ember::inline graphics {
             wait_stages[i]     = convert_stage(submit_info.wait_semaphores[i].second);
         }
 
-        array<VkSemaphore> signal_semaphores{};
+        submit_array<VkSemaphore, 4> signal_semaphores{ allocator_ref{ queue.submit_allocator } };
         std::size_t const signal_semaphore_count{ submit_info.signal_semaphores.size() };
         signal_semaphores.resize(signal_semaphore_count);
         for(std::size_t i{ 0 }; i < signal_semaphore_count; ++i) {
@@ -6,8 +6,11 @@
 #include "types.hpp"
 
 #include <ember/containers/array.hpp>
-#include <ember/containers/map.hpp>
+#include <ember/containers/concurrent_map.hpp>
 #include <ember/containers/stack.hpp>
+#include <ember/memory/linear_allocator.hpp>
+#include <ember/memory/memory.hpp>
+#include <ember/memory/unique_ptr.hpp>
 #include <vulkan/vulkan.h>
 #if EMBER_CORE_ENABLE_PROFILING
     //NOTE: Needs to be after vulkan headers
@@ -49,10 +52,12 @@ namespace ember::inline graphics {
             array<VkFence> pooled_fences{};
             array<pending_buffer_info> pending_buffers{};
 
+            linear_allocator submit_allocator{ EMBER_KB(4) }; /**< Used for temporary allocations while submitting. Reset at the start of every submission. */
+
 #if EMBER_CORE_ENABLE_PROFILING
             TracyVkCtx profiling_context{ nullptr };
             stack<tracy::VkCtxScope> scoped_events{};
-            map<std::string, source_data> source_datas{};//Bit hack but because of how we do command buffers we need to make our own source locations and these need to be stored somewhere
+            concurrent_map<std::string, unique_ptr<source_data>> source_datas{};//Bit hack but because of how we do command buffers we need to make our own source locations and these need to be stored somewhere. Boxed as tracy keeps pointers to them and map moves its values when it grows
 #endif
         };
 
@@ -23,6 +23,7 @@
 #include "vulkan_shader.hpp"
 
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <ember/containers/static_array.hpp>
 
 namespace {
@@ -196,7 +197,7 @@ namespace ember::inline graphics {
 
     unique_ptr<graphics_pipeline_object> vulkan_resource_factory::create_graphics_pipeline_object(graphics_pipeline_object::descriptor descriptor, std::string_view name) const {
         //Descriptor set layouts
-        array<VkDescriptorSetLayout> descriptor_layout_handles(descriptor.descriptor_set_layouts.size());
+        small_array<VkDescriptorSetLayout, 4> descriptor_layout_handles(descriptor.descriptor_set_layouts.size());
         for(std::size_t i{ 0 }; i < descriptor_layout_handles.size(); ++i) {
             descriptor_layout_handles[i] = resource_cast<vulkan_descriptor_set_layout const>(descriptor.descriptor_set_layouts[i])->get_handle();
         }
@@ -430,7 +431,7 @@ namespace ember::inline graphics {
 
     unique_ptr<compute_pipeline_object> vulkan_resource_factory::create_compute_pipeline_object(compute_pipeline_object::descriptor descriptor, std::string_view name) const {
         //Descriptor set layouts
-        array<VkDescriptorSetLayout> descriptor_layout_handles(descriptor.descriptor_set_layouts.size());
+        small_array<VkDescriptorSetLayout, 4> descriptor_layout_handles(descriptor.descriptor_set_layouts.size());
         for(std::size_t i{ 0 }; i < descriptor_layout_handles.size(); ++i) {
             descriptor_layout_handles[i] = resource_cast<vulkan_descriptor_set_layout const>(descriptor.descriptor_set_layouts[i])->get_handle();
         }
@@ -5,7 +5,7 @@
 
 namespace ember::inline graphics {
     shader *vulkan_shader_cache::get_shader(std::string const &shader_name) {
-        if(!compiled_modules.contains(shader_name)) {
+        auto const create_shader{ [&]() {
             array<std::uint32_t> const shader_spirv{ get_spriv_for_shader(shader_name) };
 
             VkShaderModuleCreateInfo const create_info{
@@ -19,9 +19,12 @@ namespace ember::inline graphics {
             VkShaderModule module{ VK_NULL_HANDLE };
             EMBER_VULKAN_VERIFY_RESULT(vkCreateShaderModule(device, &create_info, &global_host_allocation_callbacks, &module), "Failed to create VkShaderModule.");
 
-            compiled_modules[shader_name] = make_unique<vulkan_shader>(device, module);
-        }
+            return make_unique<vulkan_shader>(device, module);
+        } };
 
-        return compiled_modules.at(shader_name).get();
+        //Shaders are boxed so the pointer stays valid when the map grows.
+        return compiled_modules.find_or_insert(shader_name, create_shader, [](unique_ptr<vulkan_shader> const &shader) {
+            return shader.get();
+        });
     }
 }
\ No newline at end of file
@@ -3,8 +3,8 @@
 #include "ember/graphics/shader_cache.hpp"
 #include "vulkan_shader.hpp"
 
+#include <ember/containers/concurrent_map.hpp>
 #include <ember/memory/unique_ptr.hpp>
-#include <ember/containers/map.hpp>
 #include <vulkan/vulkan.h>
 
 namespace ember::inline graphics {
@@ -17,7 +17,7 @@ namespace ember::inline graphics {
     private:
         VkDevice device{ VK_NULL_HANDLE };
 
-        map<std::string, unique_ptr<vulkan_shader>> compiled_modules{};
+        concurrent_map<std::string, unique_ptr<vulkan_shader>> compiled_modules{};
 
         //FUNCTIONS
     public:
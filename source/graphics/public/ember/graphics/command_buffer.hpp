@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <ember/containers/array.hpp>
 #include <ember/core/export.hpp>
+#include <ember/memory/allocator.hpp>
 
 namespace ember::inline graphics {
     class EMBER_API command_buffer {
@@ -53,12 +54,15 @@ namespace ember::inline graphics {
     private:
         command *head{ nullptr };
         command *current{ nullptr };
-        array<arena> arenas{};
+        array<arena, polymorphic_allocator> arenas{};
         arena *current_arena{ nullptr };
 
+        polymorphic_allocator allocator{}; /**< Where recorded commands are allocated from. */
+
         //FUNCTIONS
     public:
         inline command_buffer();
+        inline explicit command_buffer(polymorphic_allocator allocator);
 
         command_buffer(command_buffer const &other) = delete;
         command_buffer(command_buffer &&other) noexcept;
@@ -15,6 +15,11 @@ namespace ember::inline graphics {
 
     command_buffer::command_buffer() = default;
 
+    command_buffer::command_buffer(polymorphic_allocator allocator)
+        : arenas{ allocator }
+        , allocator{ allocator } {
+    }
+
     void command_buffer::reset() {
         destruct_items();
         head = current = nullptr;
@@ -21,6 +21,7 @@ namespace ember::inline graphics {
         //FUNCTIONS
     public:
         inline compute_command_buffer();
+        inline explicit compute_command_buffer(polymorphic_allocator allocator);
 
         compute_command_buffer(compute_command_buffer const &other) = delete;
         inline compute_command_buffer(compute_command_buffer &&other) noexcept;
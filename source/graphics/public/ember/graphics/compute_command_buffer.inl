@@ -1,6 +1,10 @@
 namespace ember::inline graphics {
     compute_command_buffer::compute_command_buffer() = default;
 
+    compute_command_buffer::compute_command_buffer(polymorphic_allocator allocator)
+        : transfer_command_buffer{ allocator } {
+    }
+
     compute_command_buffer::compute_command_buffer(compute_command_buffer &&other) noexcept = default;
 
     compute_command_buffer &compute_command_buffer::operator=(compute_command_buffer &&other) noexcept = default;
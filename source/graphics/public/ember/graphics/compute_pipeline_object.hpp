@@ -3,6 +3,7 @@
 #include "ember/graphics/push_constant_descriptor.hpp"
 
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 
 namespace ember::inline graphics {
     class shader;
@@ -16,7 +17,7 @@ namespace ember::inline graphics {
         struct descriptor {
             shader const *shader{ nullptr };
 
-            array<descriptor_set_layout const *> descriptor_set_layouts{};
+            small_array<descriptor_set_layout const *, 4> descriptor_set_layouts{};
             array<push_constant_descriptor> push_constants{};
         };
 
@@ -4,8 +4,9 @@
 
 #include <cinttypes>
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <ember/core/enum.hpp>
-#include <ember/memory/unique_ptr.hpp>
+#include <ember/memory/pool_allocator.hpp>
 
 namespace ember::inline graphics {
     class descriptor_set;
@@ -44,16 +45,18 @@ namespace ember::inline graphics {
 
         /**
          * @brief Allocates a single descriptor set from this pool.
+         * @details The returned object is allocated from a pool shared by all descriptor sets of the same
+         * type so the frequent allocations made each frame don't go through the general purpose allocator.
          * @param layout 
          * @return 
          */
-        virtual unique_ptr<descriptor_set> allocate_descriptor_set(descriptor_set_layout const &layout) = 0;
+        virtual pooled_ptr<descriptor_set> allocate_descriptor_set(descriptor_set_layout const &layout) = 0;
         /**
          * @brief Allocates multiple descriptor sets from this pool.
          * @param layouts 
          * @return 
          */
-        virtual array<unique_ptr<descriptor_set>> allocate_descriptor_sets(array<descriptor_set_layout const *> const &layouts) = 0;
+        virtual array<pooled_ptr<descriptor_set>> allocate_descriptor_sets(small_array<descriptor_set_layout const *, 4> const &layouts) = 0;
 
         /**
          * @brief Reset all allocated sets from this pool. 
@@ -3,6 +3,7 @@
 #include "ember/graphics/compute_command_buffer.hpp"
 
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <ember/core/export.hpp>
 #include <ember/maths/vector.hpp>
 #include <span>
@@ -43,6 +44,7 @@ namespace ember::inline graphics {
         //FUNCTIONS
     public:
         inline graphics_command_buffer();
+        inline explicit graphics_command_buffer(polymorphic_allocator allocator);
 
         graphics_command_buffer(graphics_command_buffer const &other) = delete;
         inline graphics_command_buffer(graphics_command_buffer &&other) noexcept;
@@ -59,7 +61,7 @@ namespace ember::inline graphics {
          * @param render_area What area to render to in the framebuffer.
          * @param clear_values An a array of clear values. Each element in the array represents an attachment in the framebuffer.
          */
-        void begin_render_pass(render_pass const *const render_pass, framebuffer const *const framebuffer, render_area const render_area, array<clear_value> clear_values);
+        void begin_render_pass(render_pass const *const render_pass, framebuffer const *const framebuffer, render_area const render_area, small_array<clear_value, 4> clear_values);
         /**
          * @brief Ends the current render pass. Must be called before starting a new one.
          */
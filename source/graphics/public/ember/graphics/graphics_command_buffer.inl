@@ -1,6 +1,10 @@
 namespace ember::inline graphics {
     graphics_command_buffer::graphics_command_buffer() = default;
 
+    graphics_command_buffer::graphics_command_buffer(polymorphic_allocator allocator)
+        : compute_command_buffer{ allocator } {
+    }
+
     graphics_command_buffer::graphics_command_buffer(graphics_command_buffer &&other) noexcept = default;
 
     graphics_command_buffer &graphics_command_buffer::operator=(graphics_command_buffer &&other) noexcept = default;
@@ -4,6 +4,7 @@
 
 #include <cinttypes>
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <ember/maths/vector.hpp>
 
 namespace ember::inline graphics {
@@ -84,7 +85,7 @@ namespace ember::inline graphics {
 
             render_pass const *render_pass{ nullptr };
 
-            array<descriptor_set_layout const *> descriptor_set_layouts{};
+            small_array<descriptor_set_layout const *, 4> descriptor_set_layouts{};
             array<push_constant_descriptor> push_constants{};
         };
 
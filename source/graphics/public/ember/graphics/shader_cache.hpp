@@ -4,7 +4,7 @@
 
 #include <cinttypes>
 #include <ember/containers/array.hpp>
-#include <ember/containers/map.hpp>
+#include <ember/containers/concurrent_map.hpp>
 #include <ember/core/export.hpp>
 #include <filesystem>
 #include <string>
@@ -16,8 +16,8 @@ namespace ember::inline graphics {
     class EMBER_API shader_cache {
         //VARIABLES
     private:
-        inline static map<std::string, std::string> raw_shaders{};               /**< Contains raw glsl shader code with the name as the key. */
-        inline static map<std::string, array<std::uint32_t>> compiled_shaders{}; /**< Contains SPIR-V byte code compiled shader with the name as key. */
+        inline static concurrent_map<std::string, std::string> raw_shaders{};               /**< Contains raw glsl shader code with the name as the key. */
+        inline static concurrent_map<std::string, array<std::uint32_t>> compiled_shaders{}; /**< Contains SPIR-V byte code compiled shader with the name as key. */
 
         //FUNCTIONS
     public:
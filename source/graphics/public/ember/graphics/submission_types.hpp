@@ -3,6 +3,7 @@
 #include "pipeline_stage.hpp"
 
 #include <ember/containers/array.hpp>
+#include <ember/containers/small_array.hpp>
 #include <utility>
 
 namespace ember::inline graphics {
@@ -15,9 +16,9 @@ namespace ember::inline graphics {
 namespace ember::inline graphics {
     template<typename command_buffer_t>
     struct submit_info {
-        array<std::pair<semaphore const *, pipeline_stage>> wait_semaphores{}; /**< What semaphore each submission will wait on at which stage. */
-        array<command_buffer_t const *> command_buffers{};                     /**< Which command buffers to execute. */
-        array<semaphore const *> signal_semaphores{};                          /**< The semaphores that will be signaled when execution has finished.*/
+        small_array<std::pair<semaphore const *, pipeline_stage>, 4> wait_semaphores{}; /**< What semaphore each submission will wait on at which stage. */
+        array<command_buffer_t const *> command_buffers{};                              /**< Which command buffers to execute. */
+        small_array<semaphore const *, 4> signal_semaphores{};                          /**< The semaphores that will be signaled when execution has finished.*/
     };
 
     using graphics_submit_info = submit_info<graphics_command_buffer>;
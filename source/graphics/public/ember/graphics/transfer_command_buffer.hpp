@@ -47,6 +47,7 @@ namespace ember::graphics {
         //FUNCTIONS
     public:
         inline transfer_command_buffer();
+        inline explicit transfer_command_buffer(polymorphic_allocator allocator);
 
         transfer_command_buffer(transfer_command_buffer const &other) = delete;
         inline transfer_command_buffer(transfer_command_buffer &&other) noexcept;
@@ -1,6 +1,10 @@
 namespace ember::inline graphics {
     transfer_command_buffer::transfer_command_buffer() = default;
 
+    transfer_command_buffer::transfer_command_buffer(polymorphic_allocator allocator)
+        : command_buffer{ allocator } {
+    }
+
     transfer_command_buffer::transfer_command_buffer(transfer_command_buffer &&other) noexcept = default;
 
     transfer_command_buffer &transfer_command_buffer::operator=(transfer_command_buffer &&other) noexcept = default;
@@ -1,9 +1,16 @@
 #include "allocators/global_allocator.hpp"
 
+#include "allocators/virtual_memory.hpp"
+
 #include "ember/memory/exception.hpp"
 #include "ember/memory/memory.hpp"
 
+#include <bit>
+#include <cstring>
 #include <ember/core/log.hpp>
+#include <limits>
+#include <new>
+#include <utility>
 
 EMBER_LOG_CATEGORY(EmberGlobalAllocator)
 
@@ -43,6 +50,8 @@ EMBER_LOG_CATEGORY(EmberGlobalAllocator_Detailed)
 static size_t constexpr arena_size{ EMBER_GB(1) };
 static ::ember::memory::global_allocator *instance{ nullptr };
 
+thread_local ::ember::memory::global_allocator::thread_cache_handle ember::memory::global_allocator::local_thread_cache{};
+
 namespace {
     std::size_t get_remaining_alignment(std::byte const *const ptr, std::size_t required_alignment) {
         if(required_alignment == 0) {
@@ -57,11 +66,22 @@ namespace {
 
         return bytes_to_offset;
     }
+
+    std::byte *align_down(std::byte *const ptr, std::size_t const alignment) {
+        return reinterpret_cast<std::byte *>(reinterpret_cast<std::uintptr_t>(ptr) & ~(alignment - 1));
+    }
+
+    std::byte *align_up(std::byte *const ptr, std::size_t const alignment) {
+        return align_down(ptr + (alignment - 1), alignment);
+    }
+
+    void log_budget_exceeded([[maybe_unused]] ember::memory_tag const tag, [[maybe_unused]] std::size_t const bytes_in_use, [[maybe_unused]] std::size_t const budget) {
+        EMBER_LOG(EmberGlobalAllocator, ember::log_level::warn, "Memory tag {0} has exceeded it's budget of {1} bytes. {2} bytes are in use.", ember::get_memory_tag_name(tag), budget, bytes_in_use);
+    }
 }
 
 namespace ember::inline memory {
-    global_allocator::global_allocator(std::size_t initial_memory_size)
-        : size{ initial_memory_size } {
+    global_allocator::global_allocator(std::size_t initial_memory_size) {
         create_new_arena(initial_memory_size);
         EMBER_LOG(EmberGlobalAllocator, log_level::info, "Initialised global memory pool with {0} bytes.", initial_memory_size);
     }
@@ -74,128 +94,568 @@ namespace ember::inline memory {
         return *instance;
     }
 
-    std::byte *global_allocator::alloc(std::size_t const bytes, std::size_t const alignment) {
-        std::scoped_lock lock{ allocator_mutex };
-
-        std::size_t const total_allocation_size{ bytes + alignment };//Allow enough room for the worst case alignment
+    std::byte *global_allocator::alloc(std::size_t const bytes, std::size_t const alignment, memory_tag const tag) {
         std::byte *memory{ nullptr };
+        thread_cache *cache{ nullptr };
 
-        DETAILED_LOG("New allocation: {0} bytes, {1} alignment. Searching for {2} bytes.", bytes, alignment, total_allocation_size);
+#if !EMBER_MEMORY_DISABLE_THREAD_CACHES
+        cache = get_thread_cache();
+        if(cache != nullptr && bytes <= max_cached_size && alignment <= cache_alignment) {
+            memory = alloc_from_thread_cache(*cache, get_cache_class(bytes));
+        }
+#endif
 
-        for(std::size_t arena_index{ 0 }; arena_index < memory_arenas.size(); ++arena_index) {
-            arena &arena{ memory_arenas[arena_index] };
+        if(memory == nullptr) {
+            std::scoped_lock lock{ allocator_mutex };
+            memory = alloc_block(bytes, alignment);
 
-            if(arena.size < total_allocation_size) {
-                continue;
+            //Remember who allocated the block so frees from other threads can be deferred.
+            get_header_from_memory(memory)->cache_owner = cache != nullptr ? cache->index : no_cache_owner;
+        }
+
+        record_alloc(memory, bytes, tag);
+
+        return memory;
+    }
+
+    std::byte *global_allocator::realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) {
+        if(original == nullptr) {
+            return alloc(bytes, alignment, get_current_memory_tag());
+        }
+
+        block_header *const original_block{ get_header_from_memory(original) };
+
+        DETAILED_LOG("Reallocating with {0} bytes and {1} alignment. Original was {2} bytes.", bytes, alignment, original_block->size);
+
+        std::size_t usable_size{ 0 };
+        if(original_block->cache_class != no_cache_class) {
+            usable_size = get_cache_class_size(original_block->cache_class);
+
+            //Cached blocks are already the size of their class so there is nothing to do if the new size still fits.
+            if(bytes <= usable_size && alignment <= cache_alignment) {
+                std::byte *const memory{ original };
+                original = nullptr;
+
+                return memory;
             }
+        } else {
+            //Try and grow into the next block or give the tail back to the free list before falling back to a copy.
+            if(get_remaining_alignment(original, alignment) == 0) {
+                std::scoped_lock lock{ allocator_mutex };
 
-#if EMBER_MEMORY_DETAILED_LOGGING
-            static std::uint32_t loop_count{ 0 };
-#endif
+                std::size_t const previous_size{ get_usable_size(original_block) };
+                if(resize_block_in_place(original_block, bytes)) {
+                    update_peak_usage();
+                    record_resize(original_block, previous_size);
 
-            for(auto *header : arena.free_list) {
-                DETAILED_LOG("\t\tIteration {0} inside arena {1}", loop_count++, arena_index);
-                EMBER_CHECK(header->is_free);
+                    std::byte *const memory{ original };
+                    original = nullptr;
 
-                if(header->size >= total_allocation_size) {
-                    header->is_free = false;
-                    remove_block_from_free_list(header);
+                    return memory;
+                }
+            }
 
-                    DETAILED_LOG("\tFound block of {0} bytes.", header->size);
+            usable_size = original_block->size - original_block->padding;
+        }
 
-                    //If we have space left over then insert it as a new block. We check against the sizeof(block_header) as we'd need to put a new header into the remaining space.
-                    if(size_t const remaining_space{ header->size - total_allocation_size }; remaining_space > sizeof(block_header)) {
-                        header->size = total_allocation_size;
+        //The allocation keeps the tag it was originally made with.
+        std::byte *const new_alloc{ alloc(bytes, alignment, original_block->tag) };
+        std::memcpy(new_alloc, original, std::min(bytes, usable_size));
 
-                        DETAILED_LOG("\tCreating new block of {0} bytes", remaining_space);
+        free(original);
 
-                        size_t const new_block_offset{ header->offset + sizeof(block_header) + header->size };
-                        block_header *const new_block{ create_new_block(arena_index, new_block_offset, remaining_space) };
-                        block_header *const next_block{ header->next };
+        return new_alloc;
+    }
 
-                        header->next    = new_block;
-                        new_block->next = next_block;
+    void global_allocator::free(std::byte *&memory) {
+        if(memory == nullptr) {
+            return;
+        }
 
-                        if(next_block != nullptr) {
-                            next_block->prev = new_block;
-                        }
-                        new_block->prev = header;
-                    }
+        block_header *const header{ get_header_from_memory(memory) };
+        record_free(header);
+
+        if(header->cache_class != no_cache_class) {
+            free_to_thread_cache(header);
+        } else if(thread_cache *const cache{ local_thread_cache.cache }; header->cache_owner != no_cache_owner && (cache == nullptr || cache->index != header->cache_owner) && !thread_caches[header->cache_owner]->released.load(std::memory_order_acquire)) {
+            //Released caches have no owner to contend with so only defer frees for caches still in use.
+            defer_free(header);
+        } else {
+            std::scoped_lock lock{ allocator_mutex };
+            drain_deferred_frees();
+            free_block(header);
+        }
 
-                    std::byte *block_memory{ arena.memory + (header->offset + sizeof(block_header)) };
+        memory = nullptr;
+    }
 
-                    std::size_t const alignment_offset{ get_remaining_alignment(block_memory, alignment) };
-                    EMBER_CHECK(alignment_offset < std::numeric_limits<std::uint8_t>::max());
+    memory_statistics global_allocator::get_statistics() {
+        std::scoped_lock lock{ allocator_mutex };
+        drain_deferred_frees();
+
+        memory_statistics statistics{
+            .arena_bytes_in_use      = size - free_bytes,
+            .peak_arena_bytes_in_use = peak_arena_bytes_in_use,
+            .reserved_bytes          = size,
+            .arena_count             = memory_arenas.size(),
+            .free_bytes              = free_bytes,
+        };
 
-                    //Move the header along the chunk of memory so it is always sizeof(block_header) behind the allocation.
-                    //This allows freeing blocks to be extremely quick
-                    if(alignment_offset > 0) {
-                        apply_padding_to_header(header, alignment_offset);
-                        block_memory = arena.memory + (header->offset + sizeof(block_header));
-                        EMBER_CHECK(get_remaining_alignment(block_memory, alignment) == 0);
-                    }
+        //Blocks in the highest non-empty list are only guaranteed to be in the same size class so each needs checking.
+        if(first_level_bitmap != 0) {
+            std::size_t const first_level{ static_cast<std::size_t>(std::bit_width(first_level_bitmap)) - 1 };
+            std::size_t const second_level{ static_cast<std::size_t>(std::bit_width(second_level_bitmaps[first_level])) - 1 };
 
-                    memory = block_memory;
-                    break;
-                }
+            for(block_header *block{ free_lists[first_level][second_level] }; block != nullptr; block = get_free_list_node(block).next_free) {
+                statistics.largest_free_block = std::max(statistics.largest_free_block, block->size);
+            }
+        }
+        if(free_bytes > 0) {
+            statistics.fragmentation = 1.0f - (static_cast<float>(statistics.largest_free_block) / static_cast<float>(free_bytes));
+        }
 
-                header = header->next;
+        std::array<std::int64_t, max_memory_tags> tag_bytes{};
+        std::array<std::int64_t, max_memory_tags> tag_allocations{};
+        auto const gather_counters{ [&](allocation_counters const &counters) {
+            for(std::size_t i{ 0 }; i < max_memory_tags; ++i) {
+                tag_bytes[i] += counters.tag_bytes[i].load(std::memory_order_relaxed);
+                tag_allocations[i] += counters.tag_allocations[i].load(std::memory_order_relaxed);
+            }
+            for(std::size_t i{ 0 }; i < size_histogram_bucket_count; ++i) {
+                statistics.size_histogram[i] += counters.size_histogram[i].load(std::memory_order_relaxed);
             }
+        } };
 
-#if EMBER_MEMORY_DETAILED_LOGGING
-            loop_count = 0;
-#endif
+        gather_counters(shared_counters);
+        for(std::size_t i{ 0 }; i < thread_cache_count; ++i) {
+            gather_counters(thread_caches[i]->counters);
         }
 
-        if(memory == nullptr) {
-            std::size_t const new_arena_size{ std::max(arena_size, total_allocation_size) + sizeof(block_header) };//Make sure we provide extra space for a header if an allocation fails. This catches issues where allocations are >= arena_size
+        //Counters are read while other threads are writing to them so a tag can briefly appear negative.
+        for(std::size_t i{ 0 }; i < max_memory_tags; ++i) {
+            std::size_t const bytes_in_use{ static_cast<std::size_t>(std::max<std::int64_t>(tag_bytes[i], 0)) };
+            std::size_t const peak_bytes_in_use{ static_cast<std::size_t>(std::max<std::int64_t>(tag_usages[i].peak_bytes_in_use.load(std::memory_order_relaxed), 0)) };
+
+            statistics.tags[i] = tag_statistics{
+                .bytes_in_use      = bytes_in_use,
+                .peak_bytes_in_use = std::max(bytes_in_use, peak_bytes_in_use),
+                .allocation_count  = static_cast<std::size_t>(std::max<std::int64_t>(tag_allocations[i], 0)),
+                .budget            = tag_usages[i].budget.load(std::memory_order_relaxed),
+            };
+
+            statistics.bytes_in_use += statistics.tags[i].bytes_in_use;
+            statistics.allocation_count += statistics.tags[i].allocation_count;
+        }
+
+        return statistics;
+    }
+
+    void global_allocator::set_tag_budget(memory_tag const tag, std::size_t const budget) {
+        tag_usages[tag].budget.store(budget, std::memory_order_relaxed);
+    }
+
+    std::size_t global_allocator::get_tag_budget(memory_tag const tag) const {
+        return tag_usages[tag].budget.load(std::memory_order_relaxed);
+    }
+
+    void global_allocator::set_budget_exceeded_callback(memory_budget_exceeded_callback const callback) {
+        budget_exceeded_callback.store(callback, std::memory_order_relaxed);
+    }
+
+    std::byte *global_allocator::alloc_block(std::size_t const bytes, std::size_t const alignment) {
+        EMBER_CHECK_MSG(alignment == 0 || std::has_single_bit(alignment), "Alignment must be a power of two.");
+
+        //Every block's memory starts on block_alignment so we only need to make room for anything beyond that.
+        std::size_t const worst_case_padding{ alignment > block_alignment ? alignment - block_alignment : 0 };
+        std::size_t const total_allocation_size{ align_block_size(std::max(bytes + worst_case_padding, min_block_size)) };
+
+        DETAILED_LOG("New allocation: {0} bytes, {1} alignment. Searching for {2} bytes.", bytes, alignment, total_allocation_size);
+
+        //Merge anything freed from other threads first as it might make room for this allocation.
+        drain_deferred_frees();
+
+        block_header *header{ find_free_block(total_allocation_size) };
+        if(header == nullptr) {
+            std::size_t const new_arena_size{ align_block_size(std::max(arena_size, round_up_to_size_class(total_allocation_size)) + sizeof(arena_header) + sizeof(block_header)) };//Make sure we provide extra space for the headers if an allocation fails. This catches issues where allocations are >= arena_size
             create_new_arena(new_arena_size);
 
-            size += new_arena_size;
             EMBER_LOG(EmberGlobalAllocator, log_level::debug, "Global memory pool filled. Allocated {0} more bytes. Current total size is {1} bytes", new_arena_size, size);
 
-            memory = alloc(bytes, alignment);
+            header = find_free_block(total_allocation_size);
+            EMBER_THROW_IF_FAILED(header != nullptr, memory_exception{ "Newly created arena was unable to satisfy an allocation." });
         }
 
-        return memory;
+        EMBER_CHECK(header->is_free);
+        EMBER_CHECK(header->size >= total_allocation_size);
+        DETAILED_LOG("\tFound block of {0} bytes.", header->size);
+
+        remove_block_from_free_list(header);
+        header->is_free = false;
+
+        split_block(header, total_allocation_size);
+        update_peak_usage();
+
+        arena &arena{ memory_arenas[header->arena_index] };
+        std::byte *block_memory{ arena.memory + (header->offset + sizeof(block_header)) };
+
+        std::size_t const alignment_offset{ get_remaining_alignment(block_memory, alignment) };
+        EMBER_CHECK(alignment_offset < std::numeric_limits<std::uint8_t>::max());
+
+        //Move the header along the chunk of memory so it is always sizeof(block_header) behind the allocation.
+        //This allows freeing blocks to be extremely quick
+        if(alignment_offset > 0) {
+            apply_padding_to_header(header, alignment_offset);
+            block_memory = arena.memory + (header->offset + sizeof(block_header));
+            EMBER_CHECK(get_remaining_alignment(block_memory, alignment) == 0);
+        }
+
+        return block_memory;
     }
 
-    std::byte *global_allocator::realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) {
-        std::scoped_lock lock{ allocator_mutex };
+    bool global_allocator::resize_block_in_place(block_header *const header, std::size_t const bytes) {
+        //A padded header still measures it's size from the start of the block so the padding needs to be included.
+        std::size_t const required_size{ align_block_size(std::max(bytes + header->padding, min_block_size)) };
 
-        //TODO: Can check if next block is free and extend to avoid a copy
+        if(required_size > header->size) {
+            block_header *const next_block{ header->next };
+            if(next_block == nullptr || !next_block->is_free) {
+                return false;
+            }
 
-        block_header *original_block{ get_header_from_memory(original) };
-        std::size_t const copy_size{ std::min(bytes, original_block->size) };
+            std::size_t const combined_size{ header->size + sizeof(block_header) + next_block->size };
+            if(combined_size < required_size) {
+                return false;
+            }
 
-        DETAILED_LOG("Reallocating with {0} bytes and {1} alignment. Original was {2} bytes.", bytes, alignment, original_block->size);
+            DETAILED_LOG("\tGrowing block of {0} bytes in place into the next block of {1} bytes.", header->size, next_block->size);
 
-        std::byte *const new_alloc{ alloc(bytes, alignment) };
-        std::memcpy(new_alloc, original, copy_size);
+            remove_block_from_free_list(next_block);
 
-        reset_header_padding(original_block);
-        return_block_to_freelist(original_block);
-        original = nullptr;
+            header->size = combined_size;
+            header->next = next_block->next;
+            if(header->next != nullptr) {
+                header->next->prev = header;
+            }
 
-        return new_alloc;
-    }
+            VALIDATE_HEADER(header);
+        }
 
-    void global_allocator::free(std::byte *&memory) {
-        std::scoped_lock lock{ allocator_mutex };
+        split_block(header, required_size);
 
-        if(memory == nullptr) {
+        return true;
+    }
+
+    void global_allocator::split_block(block_header *const header, std::size_t const bytes) {
+        //If we have space left over then insert it as a new block. We need room for a new header and the free list links that live after it.
+        std::size_t const remaining_space{ header->size - bytes };
+        if(remaining_space < sizeof(block_header) + min_block_size) {
             return;
         }
 
-        block_header *header{ get_header_from_memory(memory) };
+        DETAILED_LOG("\tCreating new block of {0} bytes", remaining_space);
+
+        header->size = bytes;
+
+        std::size_t const new_block_offset{ (header->offset - header->padding) + sizeof(block_header) + header->size };
+        block_header *const new_block{ create_new_block(header->arena_index, new_block_offset, remaining_space) };
+        block_header *const next_block{ header->next };
+
+        header->next    = new_block;
+        new_block->next = next_block;
+
+        if(next_block != nullptr) {
+            next_block->prev = new_block;
+        }
+        new_block->prev = header;
+
+        //When shrinking a block the next block could be free so this will merge them if it is.
+        return_block_to_freelist(new_block);
+    }
 
+    void global_allocator::free_block(block_header *header) {
         VALIDATE_HEADER(header);
         DETAILED_LOG("Freeing {0} bytes. Header had {1} padding.", header->size, header->padding);
 
         reset_header_padding(header);
+
+#if EMBER_MEMORY_RELEASE_FREE_PAGES
+        std::byte *const freed_begin{ reinterpret_cast<std::byte *>(header) };
+        std::byte *const freed_end{ freed_begin + sizeof(block_header) + header->size };
+
+        block_header *const free_block{ return_block_to_freelist(header) };
+        release_free_pages(free_block, freed_begin, freed_end);
+#else
         return_block_to_freelist(header);
+#endif
+    }
 
-        memory = nullptr;
+    void global_allocator::defer_free(block_header *const header) {
+        std::atomic<block_header *> &deferred_frees{ get_arena_header(header).deferred_frees };
+
+        block_header *head{ deferred_frees.load(std::memory_order_relaxed) };
+        do {
+            get_free_list_node(header).next_free = head;
+        } while(!deferred_frees.compare_exchange_weak(head, header, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    void global_allocator::drain_deferred_frees() {
+        for(arena &arena : memory_arenas) {
+            std::atomic<block_header *> &deferred_frees{ reinterpret_cast<arena_header *>(arena.memory)->deferred_frees };
+            if(deferred_frees.load(std::memory_order_relaxed) == nullptr) {
+                continue;
+            }
+
+            block_header *header{ deferred_frees.exchange(nullptr, std::memory_order_acquire) };
+            while(header != nullptr) {
+                block_header *const next{ get_free_list_node(header).next_free };
+                free_block(header);
+
+                header = next;
+            }
+        }
+    }
+
+    void global_allocator::record_alloc(std::byte *const memory, std::size_t const bytes, memory_tag const tag) {
+        block_header *const header{ get_header_from_memory(memory) };
+        header->tag = tag;
+
+        auto const count{ [&](allocation_counters &counters) {
+            std::int64_t const usable_size{ static_cast<std::int64_t>(get_usable_size(header)) };
+
+            add_to_counter<std::int64_t>(counters.tag_bytes[tag], usable_size);
+            add_to_counter<std::int64_t>(counters.tag_allocations[tag], 1);
+            add_to_counter<std::uint64_t>(counters.size_histogram[get_size_histogram_bucket(bytes)], 1);
+            update_tag_usage(counters, tag, usable_size);
+        } };
+
+        if(thread_cache *const cache{ local_thread_cache.cache }; cache != nullptr) {
+            count(cache->counters);
+        } else {
+            std::scoped_lock lock{ allocator_mutex };
+            count(shared_counters);
+        }
+    }
+
+    void global_allocator::record_free(block_header *const header) {
+        auto const count{ [&](allocation_counters &counters) {
+            std::int64_t const usable_size{ static_cast<std::int64_t>(get_usable_size(header)) };
+
+            add_to_counter<std::int64_t>(counters.tag_bytes[header->tag], -usable_size);
+            add_to_counter<std::int64_t>(counters.tag_allocations[header->tag], -1);
+            update_tag_usage(counters, header->tag, -usable_size);
+        } };
+
+        if(thread_cache *const cache{ local_thread_cache.cache }; cache != nullptr) {
+            count(cache->counters);
+        } else {
+            std::scoped_lock lock{ allocator_mutex };
+            count(shared_counters);
+        }
+    }
+
+    void global_allocator::record_resize(block_header *const header, std::size_t const previous_size) {
+        std::int64_t const difference{ static_cast<std::int64_t>(get_usable_size(header)) - static_cast<std::int64_t>(previous_size) };
+        auto const count{ [&](allocation_counters &counters) {
+            add_to_counter<std::int64_t>(counters.tag_bytes[header->tag], difference);
+            update_tag_usage(counters, header->tag, difference);
+        } };
+
+        if(thread_cache *const cache{ local_thread_cache.cache }; cache != nullptr) {
+            count(cache->counters);
+        } else {
+            std::scoped_lock lock{ allocator_mutex };
+            count(shared_counters);
+        }
+    }
+
+    void global_allocator::update_tag_usage(allocation_counters &counters, memory_tag const tag, std::int64_t const bytes) {
+        std::int64_t &unflushed_bytes{ counters.unflushed_tag_bytes[tag] };
+        unflushed_bytes += bytes;
+
+        if(unflushed_bytes >= tag_usage_flush_threshold || unflushed_bytes <= -tag_usage_flush_threshold) {
+            flush_tag_usage(tag, std::exchange(unflushed_bytes, 0));
+        }
+    }
+
+    void global_allocator::flush_tag_usage(memory_tag const tag, std::int64_t const bytes) {
+        tag_usage &usage{ tag_usages[tag] };
+
+        std::int64_t const previous_bytes_in_use{ usage.bytes_in_use.fetch_add(bytes, std::memory_order_relaxed) };
+        std::int64_t const bytes_in_use{ previous_bytes_in_use + bytes };
+
+        std::int64_t peak_bytes_in_use{ usage.peak_bytes_in_use.load(std::memory_order_relaxed) };
+        while(bytes_in_use > peak_bytes_in_use && !usage.peak_bytes_in_use.compare_exchange_weak(peak_bytes_in_use, bytes_in_use, std::memory_order_relaxed)) {
+        }
+
+        //Only report when crossing the budget so a tag sitting above it doesn't report on every allocation.
+        auto const budget{ static_cast<std::int64_t>(usage.budget.load(std::memory_order_relaxed)) };
+        if(budget > 0 && previous_bytes_in_use <= budget && bytes_in_use > budget) {
+            memory_budget_exceeded_callback const callback{ budget_exceeded_callback.load(std::memory_order_relaxed) };
+            (callback != nullptr ? callback : log_budget_exceeded)(tag, static_cast<std::size_t>(bytes_in_use), static_cast<std::size_t>(budget));
+        }
+    }
+
+    global_allocator::thread_cache *global_allocator::get_thread_cache() {
+        thread_cache_handle &handle{ local_thread_cache };
+        if(handle.cache != nullptr || handle.released) {
+            return handle.cache;
+        }
+
+        std::scoped_lock lock{ allocator_mutex };
+
+        if(!unused_thread_caches.empty()) {
+            handle.cache = thread_caches[unused_thread_caches.back()];
+            unused_thread_caches.pop_back();
+            handle.cache->released.store(false, std::memory_order_seq_cst);
+
+            //Adopt anything that was freed back to this cache after it's previous thread exited.
+            drain_returned_blocks(*handle.cache);
+        } else if(thread_cache_count < max_thread_caches) {
+            auto *const cache{ new thread_cache{} };
+            cache->index = static_cast<std::uint16_t>(thread_cache_count);
+
+            thread_caches[thread_cache_count++] = cache;
+            handle.cache                        = cache;
+        } else {
+            EMBER_LOG(EmberGlobalAllocator, log_level::warn, "Maximum number of thread caches ({0}) reached. Thread will allocate directly from the global arenas.", max_thread_caches);
+            handle.released = true;
+        }
+
+        return handle.cache;
+    }
+
+    void global_allocator::release_thread_cache(thread_cache *const cache) {
+        std::scoped_lock lock{ allocator_mutex };
+
+        drain_deferred_frees();
+        for(auto &bin : cache->bins) {
+            drain_cache_bin(bin, bin.count);
+        }
+
+        //Mark the cache as released before emptying returned_blocks. Any thread that returns a block after this
+        //sees the flag and frees it back to the arenas itself, so nothing is left waiting for a new owner.
+        cache->released.store(true, std::memory_order_seq_cst);
+        free_returned_blocks(*cache);
+
+        unused_thread_caches.push_back(cache->index);
+    }
+
+    std::byte *global_allocator::alloc_from_thread_cache(thread_cache &cache, std::uint8_t const cache_class) {
+        cache_bin &bin{ cache.bins[cache_class] };
+
+        if(bin.head == nullptr) {
+            drain_returned_blocks(cache);
+        }
+        if(bin.head == nullptr) {
+            std::scoped_lock lock{ allocator_mutex };
+            refill_cache_bin(cache, cache_class);
+        }
+
+        block_header *const header{ bin.head };
+        bin.head = get_free_list_node(header).next_free;
+        --bin.count;
+
+        return reinterpret_cast<std::byte *>(header) + sizeof(block_header);
+    }
+
+    void global_allocator::free_to_thread_cache(block_header *const header) {
+        thread_cache *const cache{ local_thread_cache.cache };
+
+        //Blocks freed from another thread go back to their owner. The owner will pick them up when it next runs out.
+        if(cache == nullptr || cache->index != header->cache_owner) {
+            thread_cache &owner{ *thread_caches[header->cache_owner] };
+
+            block_header *head{ owner.returned_blocks.load(std::memory_order_relaxed) };
+            do {
+                get_free_list_node(header).next_free = head;
+            } while(!owner.returned_blocks.compare_exchange_weak(head, header, std::memory_order_seq_cst, std::memory_order_relaxed));
+
+            //The owner exited after we read it's cache. Check again under the lock as a new thread could have adopted it.
+            if(owner.released.load(std::memory_order_seq_cst)) {
+                std::scoped_lock lock{ allocator_mutex };
+                if(owner.released.load(std::memory_order_relaxed)) {
+                    free_returned_blocks(owner);
+                }
+            }
+
+            return;
+        }
+
+        cache_bin &bin{ cache->bins[header->cache_class] };
+
+        get_free_list_node(header).next_free = bin.head;
+        bin.head                             = header;
+        ++bin.count;
+
+        //Keep the amount of memory sitting in a cache bounded by handing a batch back to the arenas.
+        if(std::uint32_t const batch_count{ get_cache_batch_count(header->cache_class) }; bin.count > batch_count * 2) {
+            std::scoped_lock lock{ allocator_mutex };
+            drain_cache_bin(bin, batch_count);
+        }
+    }
+
+    void global_allocator::refill_cache_bin(thread_cache &cache, std::uint8_t const cache_class) {
+        cache_bin &bin{ cache.bins[cache_class] };
+        std::size_t const class_size{ get_cache_class_size(cache_class) };
+        std::uint32_t const batch_count{ get_cache_batch_count(cache_class) };
+
+        DETAILED_LOG("Refilling thread cache {0} with {1} blocks of {2} bytes.", cache.index, batch_count, class_size);
+
+        for(std::uint32_t i{ 0 }; i < batch_count; ++i) {
+            block_header *const header{ get_header_from_memory(alloc_block(class_size, cache_alignment)) };
+            header->cache_owner = cache.index;
+            header->cache_class = cache_class;
+
+            get_free_list_node(header).next_free = bin.head;
+            bin.head                             = header;
+        }
+        bin.count += batch_count;
+    }
+
+    void global_allocator::drain_cache_bin(cache_bin &bin, std::uint32_t const count) {
+        for(std::uint32_t i{ 0 }; i < count && bin.head != nullptr; ++i) {
+            block_header *const header{ bin.head };
+            bin.head = get_free_list_node(header).next_free;
+            --bin.count;
+
+            header->cache_class = no_cache_class;
+            free_block(header);
+        }
+    }
+
+    void global_allocator::drain_returned_blocks(thread_cache &cache) {
+        block_header *header{ cache.returned_blocks.exchange(nullptr, std::memory_order_acquire) };
+        while(header != nullptr) {
+            block_header *const next{ get_free_list_node(header).next_free };
+
+            cache_bin &bin{ cache.bins[header->cache_class] };
+            get_free_list_node(header).next_free = bin.head;
+            bin.head                             = header;
+            ++bin.count;
+
+            header = next;
+        }
+    }
+
+    void global_allocator::free_returned_blocks(thread_cache &cache) {
+        block_header *header{ cache.returned_blocks.exchange(nullptr, std::memory_order_seq_cst) };
+        while(header != nullptr) {
+            block_header *const next{ get_free_list_node(header).next_free };
+
+            header->cache_class = no_cache_class;
+            free_block(header);
+
+            header = next;
+        }
+    }
+
+    global_allocator::thread_cache_handle::~thread_cache_handle() {
+        if(cache != nullptr) {
+            global_allocator::get().release_thread_cache(cache);
+        }
+
+        cache    = nullptr;
+        released = true;
     }
 
     void global_allocator::apply_padding_to_header(block_header *&header, std::uint8_t const padding) {
@@ -213,10 +673,14 @@ namespace ember::inline memory {
 
         header_memory += padding;
 
-        header            = reinterpret_cast<block_header *>(header_memory);
-        *header           = header_copy;
-        next_header->prev = header;
-        prev_header->next = header;
+        header  = reinterpret_cast<block_header *>(header_memory);
+        *header = header_copy;
+        if(next_header != nullptr) {
+            next_header->prev = header;
+        }
+        if(prev_header != nullptr) {
+            prev_header->next = header;
+        }
 
         VALIDATE_HEADER(header);
     }
@@ -237,10 +701,14 @@ namespace ember::inline memory {
         header_memory -= header_copy.padding;
         header_copy.padding = 0;
 
-        header            = reinterpret_cast<block_header *>(header_memory);
-        *header           = header_copy;
-        next_header->prev = header;
-        prev_header->next = header;
+        header  = reinterpret_cast<block_header *>(header_memory);
+        *header = header_copy;
+        if(next_header != nullptr) {
+            next_header->prev = header;
+        }
+        if(prev_header != nullptr) {
+            prev_header->next = header;
+        }
 
         VALIDATE_HEADER(header);
     }
@@ -251,7 +719,7 @@ namespace ember::inline memory {
     }
 
     global_allocator::block_header *global_allocator::create_new_block(std::size_t const arena_index, std::size_t const offset, std::size_t const bytes) {
-        EMBER_CHECK_MSG(bytes > sizeof(block_header), "Size of new block is smaller than the header to fit inside it.");
+        EMBER_CHECK_MSG(bytes >= sizeof(block_header) + min_block_size, "Size of new block is smaller than the header to fit inside it.");
 
         std::size_t const size_of_block{ bytes - sizeof(block_header) };
 
@@ -260,26 +728,23 @@ namespace ember::inline memory {
 
         block_header *const new_block{ reinterpret_cast<block_header *>(arena.memory + offset) };
         *new_block = block_header{
-            .arena_index = arena_index,
             .offset      = offset,
             .size        = size_of_block,
+            .arena_index = static_cast<std::uint16_t>(arena_index),
         };
 
         EMBER_CHECK(new_block->is_free);
         VALIDATE_HEADER(new_block);
 
-        arena.free_list.push_back(new_block);
-
         return new_block;
     }
 
-    void global_allocator::return_block_to_freelist(block_header *curr_block) {
+    global_allocator::block_header *global_allocator::return_block_to_freelist(block_header *curr_block) {
         EMBER_CHECK_MSG(curr_block->padding == 0, "headers should be reset back to the beginning of their block before returning to the free list.");
         DETAILED_LOG("Returning {0} bytes back into the free list.", curr_block->size);
 
-        block_header *next_block{ curr_block->next };
+        block_header *const next_block{ curr_block->next };
         block_header *const prev_block{ curr_block->prev };
-        arena &arena{ memory_arenas[curr_block->arena_index] };
 
         curr_block->is_free = true;
 
@@ -287,6 +752,8 @@ namespace ember::inline memory {
         if(next_block != nullptr && next_block->is_free) {
             EMBER_CHECK(next_block->prev == curr_block);
 
+            remove_block_from_free_list(next_block);
+
             curr_block->size += sizeof(block_header) + next_block->size;
 
             curr_block->next = next_block->next;
@@ -296,13 +763,13 @@ namespace ember::inline memory {
 
             VALIDATE_HEADER(curr_block);
             DETAILED_LOG("\tBlock was merged to the right.");
-
-            remove_block_from_free_list(next_block);
-            next_block = nullptr;
         }
         if(prev_block != nullptr && prev_block->is_free) {
             EMBER_CHECK(prev_block->next == curr_block);
 
+            //The left block's size is about to change so it needs to move into a different size class.
+            remove_block_from_free_list(prev_block);
+
             prev_block->size += sizeof(block_header) + curr_block->size;
 
             prev_block->next = curr_block->next;
@@ -313,42 +780,133 @@ namespace ember::inline memory {
             VALIDATE_HEADER(prev_block);
             DETAILED_LOG("\tBlock was merged to the left");
 
-            curr_block = nullptr;
+            curr_block = prev_block;
+        }
+
+        insert_block_into_free_list(curr_block);
+
+        return curr_block;
+    }
+
+    void global_allocator::release_free_pages(block_header *const free_block, std::byte *const freed_begin, std::byte *const freed_end) {
+        std::size_t const granularity{ internal::get_release_granularity() };
+        if(granularity == 0 || free_block->size < min_release_size) {
+            return;
+        }
+
+        //The header and free list links need to stay resident. Everything else in the block is unused.
+        std::byte *const block_begin{ reinterpret_cast<std::byte *>(free_block) + sizeof(block_header) + sizeof(free_list_node) };
+        std::byte *const block_end{ reinterpret_cast<std::byte *>(free_block) + sizeof(block_header) + free_block->size };
+
+        //Only release the pages that just became free. The rest of the block was handled when it was freed.
+        std::byte *const release_begin{ std::max(align_down(freed_begin, granularity), align_up(block_begin, granularity)) };
+        std::byte *const release_end{ std::min(align_up(freed_end, granularity), align_down(block_end, granularity)) };
+
+        if(release_end > release_begin && static_cast<std::size_t>(release_end - release_begin) >= min_release_size) {
+            DETAILED_LOG("\tReleasing {0} bytes of physical memory back to the OS.", static_cast<std::size_t>(release_end - release_begin));
+            internal::release_physical_memory(release_begin, static_cast<std::size_t>(release_end - release_begin));
+        }
+    }
+
+    global_allocator::block_header *global_allocator::find_free_block(std::size_t const bytes) {
+        std::size_t first_level{ 0 };
+        std::size_t second_level{ 0 };
+        get_size_class(round_up_to_size_class(bytes), first_level, second_level);
+
+        if(first_level >= first_level_count) {
+            return nullptr;
+        }
+
+        //Look for a non-empty list in the same first level that is at least as large as what we need.
+        std::uint32_t second_level_map{ second_level_bitmaps[first_level] & (~0u << second_level) };
+        if(second_level_map == 0) {
+            //Otherwise take the smallest non-empty list from a larger first level.
+            std::uint64_t const first_level_map{ first_level + 1 < first_level_count ? first_level_bitmap & (~std::uint64_t{ 0 } << (first_level + 1)) : 0 };
+            if(first_level_map == 0) {
+                return nullptr;
+            }
+
+            first_level      = static_cast<std::size_t>(std::countr_zero(first_level_map));
+            second_level_map = second_level_bitmaps[first_level];
         }
 
-        if(curr_block != nullptr) {
-            arena.free_list.push_back(curr_block);
+        second_level = static_cast<std::size_t>(std::countr_zero(second_level_map));
+
+        return free_lists[first_level][second_level];
+    }
+
+    void global_allocator::insert_block_into_free_list(block_header *const block) {
+        EMBER_CHECK(block->is_free);
+
+        std::size_t first_level{ 0 };
+        std::size_t second_level{ 0 };
+        get_size_class(block->size, first_level, second_level);
+
+        block_header *&head{ free_lists[first_level][second_level] };
+        free_list_node &node{ get_free_list_node(block) };
+
+        node.next_free = head;
+        node.prev_free = nullptr;
+        if(head != nullptr) {
+            get_free_list_node(head).prev_free = block;
         }
+        head = block;
+
+        first_level_bitmap |= std::uint64_t{ 1 } << first_level;
+        second_level_bitmaps[first_level] |= 1u << second_level;
+
+        free_bytes += block->size;
     }
 
     void global_allocator::remove_block_from_free_list(block_header *const block) {
-        auto &free_list{ memory_arenas[block->arena_index].free_list };
+        std::size_t first_level{ 0 };
+        std::size_t second_level{ 0 };
+        get_size_class(block->size, first_level, second_level);
 
-        for(std::size_t i{ 0 }; i < free_list.size(); ++i) {
-            if(free_list[i] == block) {
-                if(i < free_list.size() - 1) {
-                    free_list[i] = free_list.back();
-                }
-                free_list.pop_back();
+        free_list_node &node{ get_free_list_node(block) };
 
-                return;
+        if(node.next_free != nullptr) {
+            get_free_list_node(node.next_free).prev_free = node.prev_free;
+        }
+        if(node.prev_free != nullptr) {
+            get_free_list_node(node.prev_free).next_free = node.next_free;
+        } else {
+            EMBER_CHECK(free_lists[first_level][second_level] == block);
+
+            free_lists[first_level][second_level] = node.next_free;
+            if(node.next_free == nullptr) {
+                second_level_bitmaps[first_level] &= ~(1u << second_level);
+                if(second_level_bitmaps[first_level] == 0) {
+                    first_level_bitmap &= ~(std::uint64_t{ 1 } << first_level);
+                }
             }
         }
+
+        node = free_list_node{};
+
+        free_bytes -= block->size;
     }
 
     void global_allocator::create_new_arena(std::size_t const bytes) {
         EMBER_THROW_IF_FAILED(bytes > sizeof(block_header), memory_exception{ "Memory arenas need to be larger than the header that will be placed into them." });
+        EMBER_THROW_IF_FAILED(memory_arenas.size() < std::numeric_limits<std::uint16_t>::max(), memory_exception{ "Maximum number of memory arenas reached." });
+
+        std::size_t const granularity{ internal::get_reservation_granularity() };
+        std::size_t const reserved_bytes{ ((bytes + granularity - 1) / granularity) * granularity };
 
-        auto *memory{ reinterpret_cast<std::byte *>(std::malloc(bytes)) };
+        auto *memory{ internal::reserve_virtual_memory(reserved_bytes) };
         EMBER_THROW_IF_FAILED(memory != nullptr, memory_exception{ "Failed to allocate new memory for the global memory allocator." });
 
+        new(memory) arena_header{};
+
         memory_arenas.emplace_back(arena{
             .memory = memory,
-            .size   = bytes,
+            .size   = reserved_bytes,
         });
+        size += reserved_bytes;
 
         std::size_t const arena_index{ memory_arenas.size() - 1 };
-        std::size_t constexpr block_offset{ 0 };
-        create_new_block(arena_index, block_offset, bytes);
+        std::size_t constexpr block_offset{ sizeof(arena_header) };
+        insert_block_into_free_list(create_new_block(arena_index, block_offset, (reserved_bytes - block_offset) & ~(block_alignment - 1)));
     }
 }
\ No newline at end of file
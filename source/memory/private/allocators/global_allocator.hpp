@@ -1,19 +1,57 @@
 #pragma once
 
+#include "ember/memory/statistics.hpp"
+
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <ember/core/export.hpp>
+#include <limits>
 #include <mutex>
-#include <unordered_map>
 #include <vector>
 
 namespace ember::inline memory {
     /**
      * @brief global_allocator is essentially a free list allocator except it bypasses
      * ember's memory/allocation system. Providing a place to allocate memory from for the entire application.
+     * @details Free blocks are kept in segregated lists using a two level size class scheme (TLSF). The first
+     * level splits sizes by powers of two and the second level linearly subdivides each power of two. A bitmap
+     * for each level tracks which lists are non-empty so finding, inserting and removing a free block are all
+     * constant time operations regardless of how many allocations are live.
+     *
+     * Small allocations are served from per thread caches which are refilled and drained from the arenas in
+     * batches, so the common path doesn't need to take the allocator's lock. Blocks freed by a thread that
+     * doesn't own them are pushed onto the owning cache's lock-free return queue. Larger blocks freed by a thread
+     * other than the one that allocated them are pushed onto their arena's lock-free deferred free list instead
+     * of waiting on the lock. They are merged back into the free lists in a batch the next time the lock is taken
+     * to allocate or by the allocating thread when it next frees.
+     *
+     * On Linux arenas are reserved address space that is committed as it's touched, optionally backed by
+     * huge pages to reduce TLB misses. Large ranges that become free are released back to the OS.
      */
     class global_allocator {
         //TYPES
     private:
+        static std::uint8_t constexpr no_cache_class{ std::numeric_limits<std::uint8_t>::max() };
+        static std::uint16_t constexpr no_cache_owner{ std::numeric_limits<std::uint16_t>::max() };
+
+        static std::size_t constexpr min_cache_class_size_log2{ 4 };
+        static std::size_t constexpr cache_class_count{ 7 };                                                                   /**< Thread caches hold power of two sizes from 16 to 1024 bytes. */
+        static std::size_t constexpr max_cached_size{ std::size_t{ 1 } << (min_cache_class_size_log2 + cache_class_count - 1) }; /**< Allocations larger than this always go to the arenas. */
+        static std::size_t constexpr cache_alignment{ 16 };                                                                    /**< Allocations with a larger alignment always go to the arenas. */
+        static std::size_t constexpr max_thread_caches{ 1024 };                                                                /**< Threads beyond this amount allocate directly from the arenas. */
+
+        static std::size_t constexpr min_release_size{ 64 * 1024 }; /**< Free ranges smaller than this are never handed back to the OS. */
+
+        static std::int64_t constexpr tag_usage_flush_threshold{ 16 * 1024 }; /**< How many bytes a thread can change a tag's usage by before it's checked against the tag's budget. */
+
+        static std::size_t constexpr second_level_count_log2{ 4 };
+        static std::size_t constexpr second_level_count{ 1u << second_level_count_log2 };                         /**< How many linear subdivisions each power of two is split into. */
+        static std::size_t constexpr first_level_shift{ second_level_count_log2 + 3 };                           /**< log2(block_alignment) + second_level_count_log2 */
+        static std::size_t constexpr small_block_size{ 1u << first_level_shift };                                /**< Sizes below this are all held in the first list. */
+        static std::size_t constexpr first_level_count{ (sizeof(std::size_t) * 8) - first_level_shift + 1 }; /**< Enough first level lists to map any std::size_t. */
+
         /**
          * @brief Contains data about a block of memory within a memory arena.
          */
@@ -21,20 +59,95 @@ namespace ember::inline memory {
             block_header *next{ nullptr }; /**< Next block within the arena. Can be nullptr.*/
             block_header *prev{ nullptr }; /**< Previous block within the arena. Can be nullptr.*/
 
+            std::size_t offset{ 0 }; /**< Offset into the arena memory for the whole block (where this header starts). */
+            std::size_t size{ 0 };   /**< Size of the entire block of memory (excluding the header). */
+
+            std::uint16_t arena_index{ 0 };             /**< Which arena this block belongs to. */
+            std::uint16_t cache_owner{ no_cache_owner }; /**< Index of the thread cache of the thread that allocated this block. */
+            std::uint8_t padding{ 0 };                   /**< How many bytes this header was aligned by to accomodate an allocation.*/
+            std::uint8_t cache_class{ no_cache_class };  /**< Which thread cache bin this block belongs to. */
+            memory_tag tag{ untagged_memory_tag };       /**< Which tag this allocation is counted against. */
             bool is_free{ true };
+        };
+
+        /**
+         * @brief Links for a free block inside of it's size class list. These are stored
+         * in the (unused) memory directly after a free block's header.
+         */
+        struct free_list_node {
+            block_header *next_free{ nullptr };
+            block_header *prev_free{ nullptr };
+        };
+
+        static std::size_t constexpr block_alignment{ alignof(block_header) };  /**< Every block starts and ends on this alignment. */
+        static std::size_t constexpr min_block_size{ sizeof(free_list_node) }; /**< Smallest size a block can be so it can hold it's free list links. */
+
+        /**
+         * @brief Usage counters. Each set is only written by one thread at a time (either a thread cache's owner or
+         * whoever holds allocator_mutex) so they can be updated without atomic read-modify-writes. All sets are summed
+         * together when statistics are requested.
+         */
+        struct allocation_counters {
+            std::array<std::atomic<std::int64_t>, max_memory_tags> tag_bytes{};
+            std::array<std::atomic<std::int64_t>, max_memory_tags> tag_allocations{};
+            std::array<std::atomic<std::uint64_t>, size_histogram_bucket_count> size_histogram{};
+
+            std::array<std::int64_t, max_memory_tags> unflushed_tag_bytes{}; /**< Changes to each tag's usage that haven't been added to tag_usages yet. */
+        };
+
+        /**
+         * @brief Approximate usage of a tag shared between all threads. Threads add to it in batches so it can lag
+         * behind the exact usage by up to tag_usage_flush_threshold bytes per thread.
+         */
+        struct tag_usage {
+            std::atomic<std::int64_t> bytes_in_use{ 0 };
+            std::atomic<std::int64_t> peak_bytes_in_use{ 0 };
+            std::atomic<std::size_t> budget{ 0 }; /**< 0 if the tag has no budget. */
+        };
 
-            std::size_t arena_index{ 0 }; /**< Which arena this block belongs to. */
+        /**
+         * @brief Holds cached blocks of a single size class.
+         */
+        struct cache_bin {
+            block_header *head{ nullptr };
+            std::uint32_t count{ 0 };
+        };
 
-            std::uint8_t padding{ 0 }; /**< How many bytes this header was aligned by to accomodate an allocation.*/
-            std::size_t offset{ 0 };   /**< Offset into the arena memory for the whole block (where this header starts). */
-            std::size_t size{ 0 };     /**< Size of the entire block of memory (excluding the header). */
+        /**
+         * @brief A cache of small blocks owned by a single thread. Only the owning thread touches the bins,
+         * other threads can only push blocks onto returned_blocks.
+         */
+        struct thread_cache {
+            std::array<cache_bin, cache_class_count> bins{};
+            std::uint16_t index{ 0 }; /**< Index into thread_caches. */
+
+            allocation_counters counters{}; /**< Counts allocations made and freed by the owning thread. */
+
+            alignas(64) std::atomic<block_header *> returned_blocks{ nullptr }; /**< Lock-free stack of blocks freed by other threads. */
+            std::atomic<bool> released{ false };                                /**< Set while no thread owns this cache. Blocks freed to it go straight back to the arenas. */
+        };
+
+        /**
+         * @brief Thread local handle to a thread_cache. Returns the cache back to the allocator when the thread exits.
+         */
+        struct thread_cache_handle {
+            thread_cache *cache{ nullptr };
+            bool released{ false };
+
+            ~thread_cache_handle();
+        };
+
+        /**
+         * @brief Lives at the start of every arena's memory. Blocks find it through their offset so it can be
+         * reached without the lock, as memory_arenas can be reallocated by another thread at any time.
+         */
+        struct alignas(64) arena_header {
+            std::atomic<block_header *> deferred_frees{ nullptr }; /**< Lock-free stack of blocks freed by threads that didn't allocate them. */
         };
 
         struct arena {
             std::byte *memory{ nullptr };
             std::size_t size{ 0 }; /**< Total size of the memroy arena. */
-
-            std::vector<block_header *> free_list{};
         };
 
         //VARIABLES
@@ -42,6 +155,23 @@ namespace ember::inline memory {
         std::size_t size{ 0 }; /**< Total size of this allocator (sum of all arenas) */
         std::vector<arena> memory_arenas{};
 
+        std::uint64_t first_level_bitmap{ 0 };                                 /**< Bit N is set if any of the second level lists of first level N are non-empty. */
+        std::array<std::uint32_t, first_level_count> second_level_bitmaps{}; /**< Bit N is set if free_lists[first_level][N] is non-empty. */
+        std::array<std::array<block_header *, second_level_count>, first_level_count> free_lists{};
+
+        std::size_t free_bytes{ 0 };              /**< Sum of the size of every block in free_lists. */
+        std::size_t peak_arena_bytes_in_use{ 0 }; /**< Highest size - free_bytes has been. */
+        allocation_counters shared_counters{};    /**< Counts allocations made and freed by threads without a cache. Guarded by allocator_mutex. */
+
+        std::array<tag_usage, max_memory_tags> tag_usages{};
+        std::atomic<memory_budget_exceeded_callback> budget_exceeded_callback{ nullptr }; /**< Reports tags going over budget. Logs a warning if nullptr. */
+
+        std::array<thread_cache *, max_thread_caches> thread_caches{}; /**< Caches are never destroyed so blocks can always find their way back to their owner. */
+        std::vector<std::uint16_t> unused_thread_caches{};             /**< Caches of threads that have exited, ready to be reused. */
+        std::size_t thread_cache_count{ 0 };
+
+        static thread_local thread_cache_handle local_thread_cache;
+
         std::recursive_mutex allocator_mutex{};
 
         //FUNCTIONS
@@ -59,24 +189,116 @@ namespace ember::inline memory {
 
         static global_allocator &get();
 
-        std::byte *alloc(std::size_t const bytes, std::size_t const alignment);
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment, memory_tag const tag);
         std::byte *realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment);
         void free(std::byte *&memory);
 
         inline std::size_t get_size() const;
 
+        memory_statistics get_statistics();
+
+        void set_tag_budget(memory_tag const tag, std::size_t const budget);
+        std::size_t get_tag_budget(memory_tag const tag) const;
+        void set_budget_exceeded_callback(memory_budget_exceeded_callback const callback);
+
     private:
+        /**
+         * @brief Allocates a block from the arenas. allocator_mutex must be held.
+         */
+        std::byte *alloc_block(std::size_t const bytes, std::size_t const alignment);
+        /**
+         * @brief Returns a block to the arenas. allocator_mutex must be held.
+         */
+        void free_block(block_header *header);
+
+        /**
+         * @brief Pushes a block onto it's arena's deferred free list to be returned later without taking the lock.
+         */
+        void defer_free(block_header *const header);
+        /**
+         * @brief Returns every block in the arenas' deferred free lists. allocator_mutex must be held.
+         */
+        void drain_deferred_frees();
+
+        /**
+         * @brief Attempts to resize a block without moving it, either by taking over the next block if it is free or
+         * by splitting off the unused tail. Returns false if the block could not be resized. allocator_mutex must be held.
+         */
+        bool resize_block_in_place(block_header *const header, std::size_t const bytes);
+        /**
+         * @brief Shrinks header to bytes, returning the remaining space to the free list if it's large enough to be a block.
+         */
+        void split_block(block_header *const header, std::size_t const bytes);
+
+        /**
+         * @brief Tags the allocation at memory with tag and counts it.
+         */
+        void record_alloc(std::byte *const memory, std::size_t const bytes, memory_tag const tag);
+        void record_free(block_header *const header);
+        void record_resize(block_header *const header, std::size_t const previous_size);
+
+        /**
+         * @brief Adds bytes to the usage of tag in counters, adding it to tag_usages once enough has built up.
+         */
+        void update_tag_usage(allocation_counters &counters, memory_tag const tag, std::int64_t const bytes);
+        /**
+         * @brief Adds bytes to the shared usage of tag, updating it's peak and reporting if it went over budget.
+         */
+        void flush_tag_usage(memory_tag const tag, std::int64_t const bytes);
+        inline void update_peak_usage();
+
+        thread_cache *get_thread_cache();
+        void release_thread_cache(thread_cache *const cache);
+
+        std::byte *alloc_from_thread_cache(thread_cache &cache, std::uint8_t const cache_class);
+        void free_to_thread_cache(block_header *const header);
+        void refill_cache_bin(thread_cache &cache, std::uint8_t const cache_class);
+        void drain_cache_bin(cache_bin &bin, std::uint32_t const count);
+        void drain_returned_blocks(thread_cache &cache);
+        /**
+         * @brief Frees everything in a cache's returned_blocks back to the arenas. Must hold allocator_mutex.
+         */
+        void free_returned_blocks(thread_cache &cache);
+
         void apply_padding_to_header(block_header *&header, std::uint8_t const padding);
         void reset_header_padding(block_header *&header);
 
         block_header *get_header_from_memory(std::byte *const memory);
 
         block_header *create_new_block(std::size_t const arena, std::size_t const offset, std::size_t const bytes);
-        void return_block_to_freelist(block_header *block);
+        /**
+         * @brief Merges block with it's free neighbours and inserts it into the free list. Returns the merged block.
+         */
+        block_header *return_block_to_freelist(block_header *block);
+        /**
+         * @brief Hands the pages of free_block that were covered by the freed range back to the OS so the
+         * process' resident memory shrinks after a spike. Pages are recommitted on demand when reused.
+         */
+        void release_free_pages(block_header *const free_block, std::byte *const freed_begin, std::byte *const freed_end);
+
+        /**
+         * @brief Finds a free block that can hold at least bytes. Returns nullptr if no block is big enough.
+         */
+        block_header *find_free_block(std::size_t const bytes);
+        void insert_block_into_free_list(block_header *const block);
         void remove_block_from_free_list(block_header *const block);
 
         void create_new_arena(std::size_t const bytes);
+
+        static inline std::size_t align_block_size(std::size_t const bytes);
+        static inline free_list_node &get_free_list_node(block_header *const block);
+        static inline arena_header &get_arena_header(block_header *const block);
+        static inline void get_size_class(std::size_t const bytes, std::size_t &first_level, std::size_t &second_level);
+        static inline std::size_t round_up_to_size_class(std::size_t const bytes);
+
+        static inline std::size_t get_usable_size(block_header const *const header);
+        template<typename counter_t>
+        static inline void add_to_counter(std::atomic<counter_t> &counter, counter_t const amount);
+
+        static inline std::uint8_t get_cache_class(std::size_t const bytes);
+        static inline std::size_t get_cache_class_size(std::uint8_t const cache_class);
+        static inline std::uint32_t get_cache_batch_count(std::uint8_t const cache_class);
     };
 }
 
-#include "global_allocator.inl"
\ No newline at end of file
+#include "global_allocator.inl"
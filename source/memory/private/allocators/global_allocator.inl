@@ -1,5 +1,77 @@
+#include <algorithm>
+#include <bit>
+#include <ember/memory/memory.hpp>
+
 namespace ember::inline memory {
     std::size_t global_allocator::get_size() const {
         return size;
     }
-}
\ No newline at end of file
+
+    std::size_t global_allocator::align_block_size(std::size_t const bytes) {
+        return (bytes + (block_alignment - 1)) & ~(block_alignment - 1);
+    }
+
+    global_allocator::free_list_node &global_allocator::get_free_list_node(block_header *const block) {
+        return *reinterpret_cast<free_list_node *>(reinterpret_cast<std::byte *>(block) + sizeof(block_header));
+    }
+
+    global_allocator::arena_header &global_allocator::get_arena_header(block_header *const block) {
+        return *reinterpret_cast<arena_header *>(reinterpret_cast<std::byte *>(block) - block->offset);
+    }
+
+    void global_allocator::get_size_class(std::size_t const bytes, std::size_t &first_level, std::size_t &second_level) {
+        if(bytes < small_block_size) {
+            first_level  = 0;
+            second_level = bytes / (small_block_size / second_level_count);
+        } else {
+            std::size_t const most_significant_bit{ static_cast<std::size_t>(std::bit_width(bytes)) - 1 };
+
+            first_level  = most_significant_bit - (first_level_shift - 1);
+            second_level = (bytes >> (most_significant_bit - second_level_count_log2)) ^ second_level_count;
+        }
+    }
+
+    std::size_t global_allocator::round_up_to_size_class(std::size_t const bytes) {
+        if(bytes < small_block_size) {
+            return bytes;
+        }
+
+        //Rounding up to the next second level boundary guarantees any block in the found class is large enough.
+        std::size_t const most_significant_bit{ static_cast<std::size_t>(std::bit_width(bytes)) - 1 };
+        std::size_t const round{ (std::size_t{ 1 } << (most_significant_bit - second_level_count_log2)) - 1 };
+
+        return bytes + round;
+    }
+
+    void global_allocator::update_peak_usage() {
+        peak_arena_bytes_in_use = std::max(peak_arena_bytes_in_use, size - free_bytes);
+    }
+
+    std::size_t global_allocator::get_usable_size(block_header const *const header) {
+        if(header->cache_class != no_cache_class) {
+            return get_cache_class_size(header->cache_class);
+        } else {
+            return header->size - header->padding;
+        }
+    }
+
+    template<typename counter_t>
+    void global_allocator::add_to_counter(std::atomic<counter_t> &counter, counter_t const amount) {
+        //Counters only ever have a single writer so a plain load and store is enough.
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    std::uint8_t global_allocator::get_cache_class(std::size_t const bytes) {
+        std::size_t const class_size{ std::bit_ceil(std::max(bytes, std::size_t{ 1 } << min_cache_class_size_log2)) };
+        return static_cast<std::uint8_t>(std::bit_width(class_size) - 1 - min_cache_class_size_log2);
+    }
+
+    std::size_t global_allocator::get_cache_class_size(std::uint8_t const cache_class) {
+        return std::size_t{ 1 } << (cache_class + min_cache_class_size_log2);
+    }
+
+    std::uint32_t global_allocator::get_cache_batch_count(std::uint8_t const cache_class) {
+        //Move roughly 4KB between the cache and the arenas at a time.
+        return static_cast<std::uint32_t>(std::clamp<std::size_t>(EMBER_KB(4) / get_cache_class_size(cache_class), 4, 64));
+    }
+}
@@ -0,0 +1,93 @@
+#include "allocators/virtual_memory.hpp"
+
+#include "ember/memory/memory.hpp"
+
+#include <cstdlib>
+#include <ember/core/log.hpp>
+
+#if EMBER_MEMORY_USE_VIRTUAL_MEMORY_ARENAS && EMBER_PLATFORM_LINUX
+    #include <sys/mman.h>
+    #include <unistd.h>
+#elif EMBER_PLATFORM_WIN32
+    #include <malloc.h>
+#endif
+
+EMBER_LOG_CATEGORY(EmberVirtualMemory)
+
+namespace {
+    std::size_t constexpr huge_page_size{ EMBER_MB(2) };
+
+#if EMBER_MEMORY_USE_VIRTUAL_MEMORY_ARENAS && EMBER_PLATFORM_LINUX
+    std::size_t get_page_size() {
+        static std::size_t const page_size{ static_cast<std::size_t>(sysconf(_SC_PAGESIZE)) };
+        return page_size;
+    }
+#endif
+}
+
+namespace ember::inline memory::internal {
+    std::size_t get_reservation_granularity() {
+#if EMBER_MEMORY_USE_VIRTUAL_MEMORY_ARENAS && EMBER_PLATFORM_LINUX
+    #if EMBER_MEMORY_EXPLICIT_HUGE_PAGES
+        return huge_page_size;
+    #else
+        return get_page_size();
+    #endif
+#else
+        //Arena headers are cache line aligned and aligned allocations need to be a multiple of their alignment.
+        return cache_line_size;
+#endif
+    }
+
+    std::size_t get_release_granularity() {
+#if EMBER_MEMORY_USE_VIRTUAL_MEMORY_ARENAS && EMBER_PLATFORM_LINUX
+    #if EMBER_MEMORY_EXPLICIT_HUGE_PAGES || EMBER_MEMORY_TRANSPARENT_HUGE_PAGES
+        //Releasing part of a huge page would split it back into small pages.
+        return huge_page_size;
+    #else
+        return get_page_size();
+    #endif
+#else
+        return 0;
+#endif
+    }
+
+    std::byte *reserve_virtual_memory(std::size_t const bytes) {
+#if EMBER_MEMORY_USE_VIRTUAL_MEMORY_ARENAS && EMBER_PLATFORM_LINUX
+        int constexpr protection{ PROT_READ | PROT_WRITE };
+        int constexpr flags{ MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE };
+
+        void *memory{ MAP_FAILED };
+    #if EMBER_MEMORY_EXPLICIT_HUGE_PAGES
+        memory = mmap(nullptr, bytes, protection, flags | MAP_HUGETLB, -1, 0);
+        if(memory == MAP_FAILED) {
+            EMBER_LOG(EmberVirtualMemory, log_level::warn, "Could not reserve {0} bytes of explicit huge pages. Falling back to regular pages. Check /proc/sys/vm/nr_hugepages.", bytes);
+        }
+    #endif
+        if(memory == MAP_FAILED) {
+            memory = mmap(nullptr, bytes, protection, flags, -1, 0);
+            if(memory == MAP_FAILED) {
+                return nullptr;
+            }
+
+    #if EMBER_MEMORY_TRANSPARENT_HUGE_PAGES
+            if(madvise(memory, bytes, MADV_HUGEPAGE) != 0) {
+                EMBER_LOG(EmberVirtualMemory, log_level::warn, "Transparent huge pages are not available for {0} bytes. Memory will be backed by regular pages.", bytes);
+            }
+    #endif
+        }
+
+        return reinterpret_cast<std::byte *>(memory);
+#elif EMBER_PLATFORM_WIN32
+        return reinterpret_cast<std::byte *>(_aligned_malloc(bytes, cache_line_size));
+#else
+        return reinterpret_cast<std::byte *>(std::aligned_alloc(cache_line_size, bytes));
+#endif
+    }
+
+    void release_physical_memory(std::byte *const memory, std::size_t const bytes) {
+#if EMBER_MEMORY_USE_VIRTUAL_MEMORY_ARENAS && EMBER_PLATFORM_LINUX
+        madvise(memory, bytes, MADV_DONTNEED);
+#endif
+    }
+}
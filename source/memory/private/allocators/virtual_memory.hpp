@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+
+namespace ember::inline memory::internal {
+    /**
+     * @brief Returns the size that reservations made with reserve_virtual_memory should be a multiple of.
+     * @return 
+     */
+    std::size_t get_reservation_granularity();
+    /**
+     * @brief Returns the smallest range of memory that can be handed back to the OS with release_physical_memory.
+     * @return 
+     */
+    std::size_t get_release_granularity();
+
+    /**
+     * @brief Reserves a range of address space. Physical memory is only committed once a page is first touched.
+     * @details On platforms without virtual memory support this falls back to a cache line aligned heap allocation.
+     * @param bytes Size of the reservation. Must be a multiple of get_reservation_granularity().
+     * @return Pointer to the start of the reservation or nullptr if it failed.
+     */
+    std::byte *reserve_virtual_memory(std::size_t const bytes);
+    /**
+     * @brief Hands the physical memory backing a range back to the OS. The range stays reserved and will be
+     * committed again (zeroed) the next time it is touched.
+     * @param memory Start of the range. Must be aligned to get_release_granularity().
+     * @param bytes Size of the range. Must be a multiple of get_release_granularity().
+     */
+    void release_physical_memory(std::byte *const memory, std::size_t const bytes);
+}
@@ -0,0 +1,125 @@
+#include "ember/memory/linear_allocator.hpp"
+
+#include "ember/memory/exception.hpp"
+#include "ember/memory/memory.hpp"
+
+#include <algorithm>
+#include <new>
+
+namespace ember::inline memory {
+    linear_allocator::linear_allocator()
+        : linear_allocator{ EMBER_KB(64) } {
+    }
+
+    linear_allocator::linear_allocator(std::size_t const page_size)
+        : page_size{ page_size } {
+    }
+
+    linear_allocator::linear_allocator(linear_allocator &&other) noexcept
+        : page_size{ other.page_size }
+        , first_page{ other.first_page }
+        , last_page{ other.last_page }
+        , current_page{ other.current_page }
+        , current{ other.current }
+        , end{ other.end } {
+        other.first_page   = nullptr;
+        other.last_page    = nullptr;
+        other.current_page = nullptr;
+        other.current      = nullptr;
+        other.end          = nullptr;
+    }
+
+    linear_allocator &linear_allocator::operator=(linear_allocator &&other) noexcept {
+        if(this != &other) {
+            release_pages();
+
+            page_size    = other.page_size;
+            first_page   = other.first_page;
+            last_page    = other.last_page;
+            current_page = other.current_page;
+            current      = other.current;
+            end          = other.end;
+
+            other.first_page   = nullptr;
+            other.last_page    = nullptr;
+            other.current_page = nullptr;
+            other.current      = nullptr;
+            other.end          = nullptr;
+        }
+
+        return *this;
+    }
+
+    linear_allocator::~linear_allocator() {
+        release_pages();
+    }
+
+    void linear_allocator::reset_to_marker(marker const &marker) {
+        if(marker.page == nullptr) {
+            reset();
+            return;
+        }
+
+        current_page = marker.page;
+        current      = marker.position;
+        end          = get_page_memory(current_page) + current_page->size;
+    }
+
+    void linear_allocator::reset() {
+        current_page = first_page;
+        current      = first_page != nullptr ? get_page_memory(first_page) : nullptr;
+        end          = first_page != nullptr ? current + first_page->size : nullptr;
+    }
+
+    std::byte *linear_allocator::alloc_from_next_page(std::size_t const bytes, std::size_t const alignment) {
+        std::size_t const required_size{ bytes + alignment };
+
+        //Reuse any pages we have left over from before a reset, skipping any that are too small.
+        page_header *page{ current_page != nullptr ? current_page->next : first_page };
+        while(page != nullptr && page->size < required_size) {
+            page = page->next;
+        }
+
+        if(page == nullptr) {
+            std::size_t const new_page_size{ std::max(page_size, required_size) };
+            std::byte *const page_memory{ memory::alloc(sizeof(page_header) + new_page_size, alignof(std::max_align_t)) };
+            EMBER_THROW_IF_FAILED(page_memory != nullptr, memory_exception{ "Failed to allocate new page for linear_allocator." });
+
+            page = new(page_memory) page_header{
+                .next = nullptr,
+                .size = new_page_size,
+            };
+
+            if(last_page != nullptr) {
+                last_page->next = page;
+            } else {
+                first_page = page;
+            }
+            last_page = page;
+        }
+
+        current_page = page;
+        current      = get_page_memory(page);
+        end          = current + page->size;
+
+        return alloc(bytes, alignment);
+    }
+
+    void linear_allocator::release_pages() {
+        page_header *page{ first_page };
+        while(page != nullptr) {
+            page_header *const next{ page->next };
+
+            auto *page_memory{ reinterpret_cast<std::byte *>(page) };
+            memory::free(page_memory);
+
+            page = next;
+        }
+
+        first_page   = nullptr;
+        last_page    = nullptr;
+        current_page = nullptr;
+        current      = nullptr;
+        end          = nullptr;
+    }
+}
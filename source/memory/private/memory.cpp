@@ -1,26 +1,64 @@
 #include "ember/memory/memory.hpp"
 
+#include "ember/memory/allocator.hpp"
+#include "ember/memory/memory_tag.hpp"
+#include "ember/memory/statistics.hpp"
+
 #include "allocators/global_allocator.hpp"
 
+#include <ember/core/profiling.hpp>
+
+namespace {
+    class global_memory_resource final : public ember::memory_resource {
+        //FUNCTIONS
+    public:
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment) override {
+            return ember::memory::alloc(bytes, alignment);
+        }
+
+        void free(std::byte *&memory) override {
+            ember::memory::free(memory);
+        }
+    };
+}
+
 namespace ember::inline memory {
     std::byte *alloc(std::size_t const bytes, std::size_t const alignment) {
+        return alloc(bytes, alignment, get_current_memory_tag());
+    }
+
+    std::byte *alloc(std::size_t const bytes, std::size_t const alignment, memory_tag const tag) {
 #if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
-        return global_allocator::get().alloc(bytes, alignment);
+        std::byte *const memory{ global_allocator::get().alloc(bytes, alignment, tag) };
 #else
-        return reinterpret_cast<std::byte *>(std::malloc(bytes));
+        auto *const memory{ reinterpret_cast<std::byte *>(std::malloc(bytes)) };
 #endif
+        EMBER_PROFILE_ALLOC(memory, bytes);
+
+        return memory;
     }
 
     std::byte *realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) {
+        if(original != nullptr) {
+            EMBER_PROFILE_FREE(original);
+        }
+
 #if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
-        return global_allocator::get().realloc(original, bytes, alignment);
+        std::byte *const memory{ global_allocator::get().realloc(original, bytes, alignment) };
 #else
-        return reinterpret_cast<std::byte *>(std::realloc(original, bytes));
+        auto *const memory{ reinterpret_cast<std::byte *>(std::realloc(original, bytes)) };
         original = nullptr;
 #endif
+        EMBER_PROFILE_ALLOC(memory, bytes);
+
+        return memory;
     }
 
     void free(std::byte *&memory) {
+        if(memory != nullptr) {
+            EMBER_PROFILE_FREE(memory);
+        }
+
 #if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
         global_allocator::get().free(memory);
 #else
@@ -28,4 +66,38 @@ namespace ember::inline memory {
         memory = nullptr;
 #endif
     }
+
+    memory_statistics get_memory_statistics() {
+#if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
+        return global_allocator::get().get_statistics();
+#else
+        return {};
+#endif
+    }
+
+    void set_memory_tag_budget(memory_tag const tag, std::size_t const budget) {
+#if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
+        global_allocator::get().set_tag_budget(tag, budget);
+#endif
+    }
+
+    std::size_t get_memory_tag_budget(memory_tag const tag) {
+#if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
+        return global_allocator::get().get_tag_budget(tag);
+#else
+        return 0;
+#endif
+    }
+
+    void set_memory_budget_exceeded_callback(memory_budget_exceeded_callback const callback) {
+#if !EMBER_MEMORY_DISABLE_GLOBAL_ALLOCATOR
+        global_allocator::get().set_budget_exceeded_callback(callback);
+#endif
+    }
+
+    memory_resource &get_global_memory_resource() {
+        //Never destroyed so objects with static lifetimes can still free through it on shutdown.
+        static global_memory_resource *resource{ memory::construct<global_memory_resource>() };
+        return *resource;
+    }
 }
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include "ember/memory/memory_tag.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <ember/core/log.hpp>
+#include <mutex>
+
+EMBER_LOG_CATEGORY(EmberMemoryTag)
+
+namespace {
+    std::size_t constexpr max_tag_depth{ 32 };
+
+    struct tag_registry {
+        std::array<char const *, ember::max_memory_tags> names{ "untagged" };
+        std::size_t count{ 1 };
+
+        std::mutex mutex{};
+    };
+
+    struct tag_stack {
+        std::array<ember::memory_tag, max_tag_depth> tags{};
+        std::size_t depth{ 0 };
+    };
+
+    thread_local tag_stack local_tag_stack{};
+
+    tag_registry &get_registry() {
+        //Tags are usually registered during static initialisation so the registry needs to be constructed on first use.
+        static tag_registry registry{};
+        return registry;
+    }
+}
+
+namespace ember::inline memory {
+    memory_tag register_memory_tag(char const *name) {
+        tag_registry &registry{ get_registry() };
+        std::scoped_lock lock{ registry.mutex };
+
+        for(std::size_t i{ 0 }; i < registry.count; ++i) {
+            if(std::strcmp(registry.names[i], name) == 0) {
+                return static_cast<memory_tag>(i);
+            }
+        }
+
+        if(registry.count >= max_memory_tags) {
+            EMBER_LOG(EmberMemoryTag, log_level::warn, "Could not register memory tag {0}. The maximum of {1} tags has been reached.", name, max_memory_tags);
+            return untagged_memory_tag;
+        }
+
+        registry.names[registry.count] = name;
+        return static_cast<memory_tag>(registry.count++);
+    }
+
+    char const *get_memory_tag_name(memory_tag const tag) {
+        tag_registry &registry{ get_registry() };
+        std::scoped_lock lock{ registry.mutex };
+
+        return tag < registry.count ? registry.names[tag] : "unknown";
+    }
+
+    std::size_t get_memory_tag_count() {
+        tag_registry &registry{ get_registry() };
+        std::scoped_lock lock{ registry.mutex };
+
+        return registry.count;
+    }
+
+    void push_memory_tag(memory_tag const tag) {
+        EMBER_CHECK_MSG(local_tag_stack.depth < max_tag_depth, "Memory tag stack overflowed.");
+        if(local_tag_stack.depth < max_tag_depth) {
+            local_tag_stack.tags[local_tag_stack.depth] = tag;
+        }
+        ++local_tag_stack.depth;
+    }
+
+    void pop_memory_tag() {
+        EMBER_CHECK_MSG(local_tag_stack.depth > 0, "Memory tag stack underflowed.");
+        if(local_tag_stack.depth > 0) {
+            --local_tag_stack.depth;
+        }
+    }
+
+    memory_tag get_current_memory_tag() {
+        std::size_t const depth{ local_tag_stack.depth };
+        if(depth == 0) {
+            return untagged_memory_tag;
+        }
+
+        return local_tag_stack.tags[std::min(depth, max_tag_depth) - 1];
+    }
+}
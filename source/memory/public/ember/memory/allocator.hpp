@@ -0,0 +1,140 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <ember/core/export.hpp>
+
+namespace ember::inline memory {
+    /**
+     * @brief Requirements for a type that containers and unique_ptr can allocate memory through.
+     * @details Allocators are held by value so they should be cheap to copy. Stateless allocators (such as
+     * global_allocator_ref) take up no space and stateful allocators (such as linear_allocator) are referenced
+     * through an allocator_ref. Types that need to choose their allocator at runtime without becoming a template
+     * use a polymorphic_allocator which references any memory_resource. An allocator can optionally provide
+     * realloc, which will be used instead of alloc, copy and free when growing.
+     */
+    template<typename allocator_t>
+    concept allocator = std::copy_constructible<allocator_t> && requires(allocator_t &allocator, std::byte *&memory, std::size_t const bytes, std::size_t const alignment) {
+        { allocator.alloc(bytes, alignment) } -> std::same_as<std::byte *>;
+        allocator.free(memory);
+    };
+
+    /**
+     * @brief An allocator that can resize an allocation itself, potentially without moving it.
+     */
+    template<typename allocator_t>
+    concept reallocating_allocator = requires(allocator_t &allocator, std::byte *&memory, std::size_t const bytes, std::size_t const alignment) {
+        { allocator.realloc(memory, bytes, alignment) } -> std::same_as<std::byte *>;
+    };
+
+    /**
+     * @brief Stateless allocator that allocates from the global memory pool.
+     */
+    struct global_allocator_ref {
+        inline std::byte *alloc(std::size_t const bytes, std::size_t const alignment) const;
+        inline std::byte *realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) const;
+        inline void free(std::byte *&memory) const;
+
+        friend bool operator==(global_allocator_ref const &lhs, global_allocator_ref const &rhs) = default;
+    };
+
+    /**
+     * @brief Allocator that references a stateful allocator, allowing it to be passed around by value.
+     * @details The referenced allocator must outlive anything allocated through the allocator_ref.
+     * @tparam allocator_t Type of the allocator to reference.
+     */
+    template<typename allocator_t>
+    class allocator_ref {
+        //VARIABLES
+    private:
+        allocator_t *referenced_allocator{ nullptr };
+
+        //FUNCTIONS
+    public:
+        allocator_ref() = delete;
+        allocator_ref(allocator_t &referenced_allocator);
+
+        allocator_ref(allocator_ref const &other);
+        allocator_ref(allocator_ref &&other) noexcept;
+
+        allocator_ref &operator=(allocator_ref const &other);
+        allocator_ref &operator=(allocator_ref &&other) noexcept;
+
+        ~allocator_ref();
+
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment) const;
+        std::byte *realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) const requires reallocating_allocator<allocator_t>;
+        void free(std::byte *&memory) const;
+
+        allocator_t &get() const;
+
+        template<typename allocator_t_1>
+        friend bool operator==(allocator_ref<allocator_t_1> const &lhs, allocator_ref<allocator_t_1> const &rhs);
+    };
+
+    /**
+     * @brief Base for allocators that can be used through a polymorphic_allocator.
+     * @details Allocators deriving from memory_resource should be marked final so calls made through
+     * an allocator_ref to the concrete type don't go through the vtable.
+     */
+    class memory_resource {
+        //FUNCTIONS
+    public:
+        virtual ~memory_resource() = default;
+
+        virtual std::byte *alloc(std::size_t const bytes, std::size_t const alignment) = 0;
+        virtual void free(std::byte *&memory)                                         = 0;
+    };
+
+    /**
+     * @brief Allocator that references any memory_resource, allowing the allocator to be chosen at runtime.
+     * @details Default constructs to the global memory pool. The referenced memory_resource must outlive
+     * anything allocated through the polymorphic_allocator.
+     */
+    class polymorphic_allocator {
+        //VARIABLES
+    private:
+        memory_resource *resource{ nullptr };
+
+        //FUNCTIONS
+    public:
+        inline polymorphic_allocator();
+        inline polymorphic_allocator(memory_resource &resource);
+
+        polymorphic_allocator(polymorphic_allocator const &other)     = default;
+        polymorphic_allocator(polymorphic_allocator &&other) noexcept = default;
+
+        polymorphic_allocator &operator=(polymorphic_allocator const &other)     = default;
+        polymorphic_allocator &operator=(polymorphic_allocator &&other) noexcept = default;
+
+        ~polymorphic_allocator() = default;
+
+        inline std::byte *alloc(std::size_t const bytes, std::size_t const alignment) const;
+        inline void free(std::byte *&memory) const;
+
+        inline memory_resource &get_resource() const;
+
+        friend bool operator==(polymorphic_allocator const &lhs, polymorphic_allocator const &rhs) = default;
+    };
+
+    /**
+     * @brief Returns a memory_resource that allocates from the global memory pool.
+     * @return 
+     */
+    EMBER_API memory_resource &get_global_memory_resource();
+
+    /**
+     * @brief Reallocates original through allocator into a new size. Uses the allocator's realloc if it has
+     * one, otherwise allocates new memory, copies old_bytes over and frees the original.
+     * @param allocator Allocator original was allocated from.
+     * @param original Original allocation. Will be set to nullptr.
+     * @param old_bytes How many bytes original has that need to be preserved.
+     * @param new_bytes How many bytes to allocate.
+     * @param alignment How to align the allocation.
+     * @return A pointer to the newly allocated memory.
+     */
+    template<allocator allocator_t>
+    std::byte *reallocate(allocator_t &allocator, std::byte *&original, std::size_t const old_bytes, std::size_t const new_bytes, std::size_t const alignment);
+}
+
+#include "allocator.inl"
@@ -0,0 +1,98 @@
+#include "ember/memory/memory.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ember::inline memory {
+    std::byte *global_allocator_ref::alloc(std::size_t const bytes, std::size_t const alignment) const {
+        return memory::alloc(bytes, alignment);
+    }
+
+    std::byte *global_allocator_ref::realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) const {
+        return memory::realloc(original, bytes, alignment);
+    }
+
+    void global_allocator_ref::free(std::byte *&memory) const {
+        ember::memory::free(memory);
+    }
+
+    template<typename allocator_t>
+    allocator_ref<allocator_t>::allocator_ref(allocator_t &referenced_allocator)
+        : referenced_allocator{ &referenced_allocator } {
+    }
+
+    template<typename allocator_t>
+    allocator_ref<allocator_t>::allocator_ref(allocator_ref const &other) = default;
+
+    template<typename allocator_t>
+    allocator_ref<allocator_t>::allocator_ref(allocator_ref &&other) noexcept = default;
+
+    template<typename allocator_t>
+    allocator_ref<allocator_t> &allocator_ref<allocator_t>::operator=(allocator_ref const &other) = default;
+
+    template<typename allocator_t>
+    allocator_ref<allocator_t> &allocator_ref<allocator_t>::operator=(allocator_ref &&other) noexcept = default;
+
+    template<typename allocator_t>
+    allocator_ref<allocator_t>::~allocator_ref() = default;
+
+    template<typename allocator_t>
+    std::byte *allocator_ref<allocator_t>::alloc(std::size_t const bytes, std::size_t const alignment) const {
+        return referenced_allocator->alloc(bytes, alignment);
+    }
+
+    template<typename allocator_t>
+    std::byte *allocator_ref<allocator_t>::realloc(std::byte *&original, std::size_t const bytes, std::size_t const alignment) const requires reallocating_allocator<allocator_t> {
+        return referenced_allocator->realloc(original, bytes, alignment);
+    }
+
+    template<typename allocator_t>
+    void allocator_ref<allocator_t>::free(std::byte *&memory) const {
+        referenced_allocator->free(memory);
+    }
+
+    template<typename allocator_t>
+    allocator_t &allocator_ref<allocator_t>::get() const {
+        return *referenced_allocator;
+    }
+
+    template<typename allocator_t_1>
+    bool operator==(allocator_ref<allocator_t_1> const &lhs, allocator_ref<allocator_t_1> const &rhs) {
+        return lhs.referenced_allocator == rhs.referenced_allocator;
+    }
+
+    polymorphic_allocator::polymorphic_allocator()
+        : resource{ &get_global_memory_resource() } {
+    }
+
+    polymorphic_allocator::polymorphic_allocator(memory_resource &resource)
+        : resource{ &resource } {
+    }
+
+    std::byte *polymorphic_allocator::alloc(std::size_t const bytes, std::size_t const alignment) const {
+        return resource->alloc(bytes, alignment);
+    }
+
+    void polymorphic_allocator::free(std::byte *&memory) const {
+        resource->free(memory);
+    }
+
+    memory_resource &polymorphic_allocator::get_resource() const {
+        return *resource;
+    }
+
+    template<allocator allocator_t>
+    std::byte *reallocate(allocator_t &allocator, std::byte *&original, std::size_t const old_bytes, std::size_t const new_bytes, std::size_t const alignment) {
+        if constexpr(reallocating_allocator<allocator_t>) {
+            return allocator.realloc(original, new_bytes, alignment);
+        } else {
+            std::byte *const new_memory{ allocator.alloc(new_bytes, alignment) };
+            if(original != nullptr) {
+                std::memcpy(new_memory, original, std::min(old_bytes, new_bytes));
+                allocator.free(original);
+            }
+
+            return new_memory;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "ember/memory/allocator.hpp"
+
+#include <cstddef>
+#include <ember/core/export.hpp>
+
+namespace ember::inline memory {
+    /**
+     * @brief Bump pointer allocator for short lived allocations such as per frame data.
+     * @details Memory is handed out linearly from pages taken from the global memory pool. Individual allocations
+     * are never freed, instead the allocator is reset either completely or back to a previously saved marker.
+     * Pages are kept after a reset so a steady state frame doesn't touch the global memory pool at all.
+     * linear_allocator is not thread safe.
+     */
+    class EMBER_API linear_allocator final : public memory_resource {
+        //TYPES
+    private:
+        struct page_header {
+            page_header *next{ nullptr };
+            std::size_t size{ 0 }; /**< Size of the page's memory (excluding the header). */
+        };
+
+    public:
+        /**
+         * @brief A saved position within a linear_allocator. Resetting to a marker frees everything allocated after it.
+         */
+        struct marker {
+            page_header *page{ nullptr };
+            std::byte *position{ nullptr };
+        };
+
+        /**
+         * @brief Saves the allocator's position when constructed and resets back to it when destroyed.
+         */
+        class scoped_marker {
+            //VARIABLES
+        private:
+            linear_allocator *allocator{ nullptr };
+            marker saved_marker{};
+
+            //FUNCTIONS
+        public:
+            scoped_marker() = delete;
+            inline scoped_marker(linear_allocator &allocator);
+
+            scoped_marker(scoped_marker const &other) = delete;
+            scoped_marker(scoped_marker &&other)      = delete;
+
+            scoped_marker &operator=(scoped_marker const &other) = delete;
+            scoped_marker &operator=(scoped_marker &&other)      = delete;
+
+            inline ~scoped_marker();
+        };
+
+        //VARIABLES
+    private:
+        std::size_t page_size{ 0 }; /**< Default size of each page. Allocations larger than this get their own page. */
+
+        page_header *first_page{ nullptr };
+        page_header *last_page{ nullptr };
+        page_header *current_page{ nullptr };
+
+        std::byte *current{ nullptr }; /**< Next free byte in the current page. */
+        std::byte *end{ nullptr };     /**< End of the current page. */
+
+        //FUNCTIONS
+    public:
+        linear_allocator();
+        explicit linear_allocator(std::size_t const page_size);
+
+        linear_allocator(linear_allocator const &other) = delete;
+        linear_allocator(linear_allocator &&other) noexcept;
+
+        linear_allocator &operator=(linear_allocator const &other) = delete;
+        linear_allocator &operator=(linear_allocator &&other) noexcept;
+
+        ~linear_allocator() override;
+
+        /**
+         * @brief Allocates memory by bumping the current position along.
+         * @param bytes How many bytes to allocate.
+         * @param alignment How to align the allocation.
+         * @return A pointer to the newly allocated memory.
+         */
+        inline std::byte *alloc(std::size_t const bytes, std::size_t const alignment) override;
+        /**
+         * @brief Individual allocations can't be freed so this only nulls memory. Use reset or a marker instead.
+         * @param memory 
+         */
+        inline void free(std::byte *&memory) override;
+
+        /**
+         * @brief Returns the current position of the allocator.
+         * @return 
+         */
+        inline marker get_marker() const;
+        /**
+         * @brief Frees everything allocated after marker was taken.
+         * @param marker 
+         */
+        void reset_to_marker(marker const &marker);
+        /**
+         * @brief Frees all allocations. Keeps hold of any pages for future allocations.
+         */
+        void reset();
+
+    private:
+        std::byte *alloc_from_next_page(std::size_t const bytes, std::size_t const alignment);
+
+        inline static std::byte *get_page_memory(page_header *const page);
+
+        void release_pages();
+    };
+}
+
+#include "linear_allocator.inl"
@@ -0,0 +1,39 @@
+#include <cstdint>
+
+namespace ember::inline memory {
+    linear_allocator::scoped_marker::scoped_marker(linear_allocator &allocator)
+        : allocator{ &allocator }
+        , saved_marker{ allocator.get_marker() } {
+    }
+
+    linear_allocator::scoped_marker::~scoped_marker() {
+        allocator->reset_to_marker(saved_marker);
+    }
+
+    std::byte *linear_allocator::alloc(std::size_t const bytes, std::size_t const alignment) {
+        auto const address{ reinterpret_cast<std::uintptr_t>(current) };
+        std::uintptr_t const aligned_address{ alignment > 1 ? (address + (alignment - 1)) & ~(alignment - 1) : address };
+
+        if(current != nullptr && aligned_address + bytes <= reinterpret_cast<std::uintptr_t>(end)) {
+            current = reinterpret_cast<std::byte *>(aligned_address + bytes);
+            return reinterpret_cast<std::byte *>(aligned_address);
+        }
+
+        return alloc_from_next_page(bytes, alignment);
+    }
+
+    void linear_allocator::free(std::byte *&memory) {
+        memory = nullptr;
+    }
+
+    linear_allocator::marker linear_allocator::get_marker() const {
+        return marker{
+            .page     = current_page,
+            .position = current,
+        };
+    }
+
+    std::byte *linear_allocator::get_page_memory(page_header *const page) {
+        return reinterpret_cast<std::byte *>(page) + sizeof(page_header);
+    }
+}
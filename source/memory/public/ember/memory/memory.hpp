@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ember/memory/memory_tag.hpp"
+
 #include <cinttypes>
 #include <cstddef>
 #include <ember/core/export.hpp>
@@ -9,6 +11,12 @@
 #define EMBER_GB(x) (EMBER_MB(x) * 1024u)
 
 namespace ember::inline memory {
+    /**
+     * @brief Size of a cache line on the platforms ember targets. Data written by different threads should be
+     * at least this far apart to avoid false sharing.
+     */
+    inline std::size_t constexpr cache_line_size{ 64 };
+
     /**
      * @brief Allocates memory from the global memory pool.
      * @param bytes How many bytes to allocate.
@@ -17,7 +25,15 @@ namespace ember::inline memory {
      */
     EMBER_API std::byte *alloc(std::size_t const bytes, std::size_t const alignment);
     /**
-     * @brief Reallocates original into a new size. Copying memory over.
+     * @brief Allocates memory from the global memory pool, counting it against tag instead of the current tag.
+     * @param bytes How many bytes to allocate.
+     * @param alignment How to align the allocation.
+     * @param tag Which tag to count the allocation against.
+     * @return A pointer to the newly allocated memory.
+     */
+    EMBER_API std::byte *alloc(std::size_t const bytes, std::size_t const alignment, memory_tag const tag);
+    /**
+     * @brief Reallocates original into a new size. Copying memory over. The allocation keeps it's memory_tag.
      * @param original Original allocation.
      * @param bytes How many bytes to allocate.
      * @param alignment How to align the allocation.
@@ -1,4 +1,5 @@
 #include <new>
+#include <utility>
 
 namespace ember::inline memory {
     template<typename object_t, typename... arg_t>
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ember/core/export.hpp>
+
+#define EMBER_INTERNAL_MEMORY_TAG_CONCAT(a, b) EMBER_INTERNAL_MEMORY_TAG_CONCAT_2(a, b)
+#define EMBER_INTERNAL_MEMORY_TAG_CONCAT_2(a, b) a##b
+
+/**
+ * @brief Tags every allocation made on this thread until the end of the current scope with tag.
+ */
+#define EMBER_MEMORY_TAG(tag) ::ember::memory::scoped_memory_tag EMBER_INTERNAL_MEMORY_TAG_CONCAT(_ember_memory_tag_, __LINE__) { tag }
+
+namespace ember::inline memory {
+    /**
+     * @brief Identifies which part of the application an allocation belongs to. Allocations are counted against
+     * the tag that is on top of the allocating thread's tag stack.
+     */
+    using memory_tag = std::uint8_t;
+
+    inline std::size_t constexpr max_memory_tags{ 64 };
+    inline memory_tag constexpr untagged_memory_tag{ 0 };
+
+    /**
+     * @brief Called when the bytes in use by a tag grow past it's budget.
+     */
+    using memory_budget_exceeded_callback = void (*)(memory_tag const tag, std::size_t const bytes_in_use, std::size_t const budget);
+
+    /**
+     * @brief Registers a new memory tag. Registering the same name twice returns the same tag.
+     * @param name Name of the tag. Must have static storage duration.
+     * @return The new tag or untagged_memory_tag if max_memory_tags has been reached.
+     */
+    EMBER_API memory_tag register_memory_tag(char const *name);
+    /**
+     * @brief Returns the name a tag was registered with.
+     * @param tag 
+     * @return 
+     */
+    EMBER_API char const *get_memory_tag_name(memory_tag const tag);
+    /**
+     * @brief Returns how many tags have been registered, including untagged_memory_tag.
+     * @return 
+     */
+    EMBER_API std::size_t get_memory_tag_count();
+
+    /**
+     * @brief Sets how many bytes allocations made with tag are expected to stay under. Going over budget
+     * doesn't fail any allocations, it is only reported through the memory_budget_exceeded_callback.
+     * @details Usage is checked against the budget in batches of a few KB per thread so small overruns
+     * may be reported late.
+     * @param tag 
+     * @param budget Budget in bytes or 0 to remove the budget.
+     */
+    EMBER_API void set_memory_tag_budget(memory_tag const tag, std::size_t const budget);
+    /**
+     * @brief Returns the budget of tag or 0 if it doesn't have one.
+     * @param tag 
+     * @return 
+     */
+    EMBER_API std::size_t get_memory_tag_budget(memory_tag const tag);
+    /**
+     * @brief Sets the function called when a tag goes over it's budget. It is called on the thread that made the
+     * allocation and is allowed to allocate.
+     * @param callback Callback to use or nullptr to log a warning instead.
+     */
+    EMBER_API void set_memory_budget_exceeded_callback(memory_budget_exceeded_callback const callback);
+
+    /**
+     * @brief Pushes tag onto this thread's tag stack.
+     * @param tag 
+     */
+    EMBER_API void push_memory_tag(memory_tag const tag);
+    /**
+     * @brief Pops the top tag off of this thread's tag stack.
+     */
+    EMBER_API void pop_memory_tag();
+    /**
+     * @brief Returns the tag on top of this thread's tag stack.
+     * @return 
+     */
+    EMBER_API memory_tag get_current_memory_tag();
+
+    /**
+     * @brief Pushes a tag when constructed and pops it when destroyed.
+     */
+    class scoped_memory_tag {
+        //FUNCTIONS
+    public:
+        scoped_memory_tag() = delete;
+        inline scoped_memory_tag(memory_tag const tag);
+
+        scoped_memory_tag(scoped_memory_tag const &other) = delete;
+        scoped_memory_tag(scoped_memory_tag &&other)      = delete;
+
+        scoped_memory_tag &operator=(scoped_memory_tag const &other) = delete;
+        scoped_memory_tag &operator=(scoped_memory_tag &&other)      = delete;
+
+        inline ~scoped_memory_tag();
+    };
+}
+
+#include "memory_tag.inl"
@@ -0,0 +1,9 @@
+namespace ember::inline memory {
+    scoped_memory_tag::scoped_memory_tag(memory_tag const tag) {
+        push_memory_tag(tag);
+    }
+
+    scoped_memory_tag::~scoped_memory_tag() {
+        pop_memory_tag();
+    }
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "ember/memory/unique_ptr.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <type_traits>
+
+namespace ember::inline memory::internal {
+    struct null_mutex {
+        void lock() {}
+        void unlock() {}
+    };
+}
+
+namespace ember::inline memory {
+    /**
+     * @brief Allocates fixed size slots for objects of type_t.
+     * @details Slots are carved out of slabs of block_count objects which are allocated from the global memory pool
+     * as the pool grows. Free slots are kept in an intrusive free list so allocating and freeing are a single pointer
+     * swap and objects carry no per allocation header. Slabs are only returned when the pool is destroyed.
+     * @tparam type_t Type of object this pool allocates.
+     * @tparam block_count How many objects each slab can hold.
+     * @tparam thread_safe If true, alloc and free are guarded by a mutex so the pool can be shared between threads.
+     */
+    template<typename type_t, std::size_t block_count = 64, bool thread_safe = false>
+    class pool_allocator {
+        static_assert(block_count > 0, "pool_allocator needs to hold at least 1 object per slab.");
+
+        //TYPES
+    private:
+        union slot {
+            slot *next;
+            alignas(type_t) std::byte storage[sizeof(type_t)];
+        };
+
+        struct slab_header {
+            slab_header *next{ nullptr };
+        };
+
+        using mutex_type = std::conditional_t<thread_safe, std::mutex, internal::null_mutex>;
+
+        static std::size_t constexpr slots_offset{ (sizeof(slab_header) + alignof(slot) - 1) & ~(alignof(slot) - 1) };
+        static std::size_t constexpr slab_size{ slots_offset + sizeof(slot) * block_count };
+
+        //VARIABLES
+    private:
+        slot *free_list{ nullptr };
+        slab_header *slabs{ nullptr };
+        std::size_t slab_count{ 0 };
+
+        [[no_unique_address]] mutex_type mutex{};
+
+        //FUNCTIONS
+    public:
+        pool_allocator();
+
+        pool_allocator(pool_allocator const &other)     = delete;
+        pool_allocator(pool_allocator &&other) noexcept = delete;
+
+        pool_allocator &operator=(pool_allocator const &other)     = delete;
+        pool_allocator &operator=(pool_allocator &&other) noexcept = delete;
+
+        ~pool_allocator();
+
+        /**
+         * @brief Allocates a single slot. bytes and alignment must fit within type_t.
+         * @param bytes 
+         * @param alignment 
+         * @return 
+         */
+        std::byte *alloc(std::size_t const bytes, std::size_t const alignment);
+        /**
+         * @brief Returns a slot back to the pool.
+         * @param memory 
+         */
+        void free(std::byte *&memory);
+
+        /**
+         * @brief Allocates a slot and constructs a type_t inside of it.
+         * @param args 
+         * @return 
+         */
+        template<typename... args_t>
+        type_t *construct(args_t &&...args);
+        /**
+         * @brief Destructs object and returns it's slot to the pool.
+         * @param object 
+         */
+        void destruct(type_t *&object);
+
+        /**
+         * @brief Returns how many slabs this pool has allocated.
+         * @return 
+         */
+        std::size_t get_slab_count() const;
+
+    private:
+        void allocate_slab();
+    };
+
+    /**
+     * @brief Deleter for objects made with make_pooled. Returns them to the pool of their most derived type
+     * which allows a pooled unique_ptr to be converted into a unique_ptr to one of it's bases.
+     */
+    struct pooled_deleter {
+        void (*release)(void *object){ nullptr };
+
+        template<typename type_t>
+        void operator()(type_t *object) const;
+    };
+
+    template<typename type_t>
+    using pooled_ptr = unique_ptr<type_t, pooled_deleter>;
+
+    /**
+     * @brief Makes a unique_ptr to type_t, allocating it from a thread safe pool shared by all objects of type_t.
+     * @tparam type_t Type the unique_ptr will point to
+     * @tparam arg_t 
+     * @param args 
+     * @return 
+     */
+    template<typename type_t, typename... args_t>
+    pooled_ptr<type_t> make_pooled(args_t &&...args);
+}
+
+#include "pool_allocator.inl"
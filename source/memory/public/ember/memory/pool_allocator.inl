@@ -0,0 +1,126 @@
+#include "ember/memory/exception.hpp"
+#include "ember/memory/memory.hpp"
+
+#include <new>
+#include <utility>
+
+namespace ember::inline memory {
+    namespace internal {
+        template<typename type_t>
+        pool_allocator<type_t, 64, true> &get_shared_pool() {
+            //Shared pools are never destroyed so pooled objects owned by other statics can still be safely released on shutdown.
+            static pool_allocator<type_t, 64, true> *pool{ memory::construct<pool_allocator<type_t, 64, true>>() };
+            return *pool;
+        }
+
+        template<typename type_t>
+        void release_to_shared_pool(void *object) {
+            auto *typed_object{ static_cast<type_t *>(object) };
+            get_shared_pool<type_t>().destruct(typed_object);
+        }
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    pool_allocator<type_t, block_count, thread_safe>::pool_allocator() = default;
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    pool_allocator<type_t, block_count, thread_safe>::~pool_allocator() {
+        slab_header *slab{ slabs };
+        while(slab != nullptr) {
+            slab_header *const next{ slab->next };
+
+            auto *slab_memory{ reinterpret_cast<std::byte *>(slab) };
+            memory::free(slab_memory);
+
+            slab = next;
+        }
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    std::byte *pool_allocator<type_t, block_count, thread_safe>::alloc(std::size_t const bytes, std::size_t const alignment) {
+        EMBER_THROW_IF_FAILED(bytes <= sizeof(slot) && alignment <= alignof(slot), memory_exception{ "Allocation is too large for pool_allocator's slots." });
+
+        std::scoped_lock lock{ mutex };
+
+        if(free_list == nullptr) {
+            allocate_slab();
+        }
+
+        slot *const free_slot{ free_list };
+        free_list = free_slot->next;
+
+        return free_slot->storage;
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    void pool_allocator<type_t, block_count, thread_safe>::free(std::byte *&memory) {
+        if(memory == nullptr) {
+            return;
+        }
+
+        auto *const freed_slot{ reinterpret_cast<slot *>(memory) };
+        {
+            std::scoped_lock lock{ mutex };
+
+            freed_slot->next = free_list;
+            free_list        = freed_slot;
+        }
+
+        memory = nullptr;
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    template<typename... args_t>
+    type_t *pool_allocator<type_t, block_count, thread_safe>::construct(args_t &&...args) {
+        std::byte *const memory{ alloc(sizeof(type_t), alignof(type_t)) };
+        return new(memory) type_t{ std::forward<args_t>(args)... };
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    void pool_allocator<type_t, block_count, thread_safe>::destruct(type_t *&object) {
+        object->~type_t();
+
+        auto *memory{ reinterpret_cast<std::byte *>(object) };
+        free(memory);
+
+        object = nullptr;
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    std::size_t pool_allocator<type_t, block_count, thread_safe>::get_slab_count() const {
+        return slab_count;
+    }
+
+    template<typename type_t, std::size_t block_count, bool thread_safe>
+    void pool_allocator<type_t, block_count, thread_safe>::allocate_slab() {
+        std::byte *const slab_memory{ memory::alloc(slab_size, alignof(slot) > alignof(slab_header) ? alignof(slot) : alignof(slab_header)) };
+        EMBER_THROW_IF_FAILED(slab_memory != nullptr, memory_exception{ "Failed to allocate new slab for pool_allocator." });
+
+        auto *const slab{ new(slab_memory) slab_header{ .next = slabs } };
+        slabs = slab;
+        ++slab_count;
+
+        //Push the slots in reverse so they are handed out in address order.
+        auto *const slots{ reinterpret_cast<slot *>(slab_memory + slots_offset) };
+        for(std::size_t i{ block_count }; i > 0; --i) {
+            slots[i - 1].next = free_list;
+            free_list         = &slots[i - 1];
+        }
+    }
+
+    template<typename type_t>
+    void pooled_deleter::operator()(type_t *object) const {
+        //Pooled objects are released to the pool of their most derived type so we need that object's address.
+        if constexpr(std::is_polymorphic_v<type_t>) {
+            release(dynamic_cast<void *>(object));
+        } else {
+            release(object);
+        }
+    }
+
+    template<typename type_t, typename... args_t>
+    pooled_ptr<type_t> make_pooled(args_t &&...args) {
+        type_t *const object{ internal::get_shared_pool<type_t>().construct(std::forward<args_t>(args)...) };
+        return pooled_ptr<type_t>{ object, pooled_deleter{ .release = &internal::release_to_shared_pool<type_t> } };
+    }
+}
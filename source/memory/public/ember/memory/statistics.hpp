@@ -0,0 +1,57 @@
+#pragma once
+
+#include "ember/memory/memory_tag.hpp"
+
+#include <array>
+#include <cstddef>
+#include <ember/core/export.hpp>
+
+namespace ember::inline memory {
+    inline std::size_t constexpr size_histogram_bucket_count{ 17 }; /**< Buckets hold sizes up to 16, 32, 64 ... 512KB and then anything larger. */
+
+    /**
+     * @brief Usage of a single memory_tag.
+     */
+    struct tag_statistics {
+        std::size_t bytes_in_use{ 0 };
+        std::size_t peak_bytes_in_use{ 0 }; /**< High-water mark of bytes_in_use. Can lag behind by a few KB per thread. */
+        std::size_t allocation_count{ 0 };  /**< How many allocations made with this tag are still live. */
+        std::size_t budget{ 0 };            /**< The tag's budget or 0 if it doesn't have one. */
+    };
+
+    /**
+     * @brief A snapshot of the global memory pool.
+     */
+    struct memory_statistics {
+        std::size_t bytes_in_use{ 0 };     /**< Bytes held by live allocations. */
+        std::size_t allocation_count{ 0 }; /**< How many allocations are live. */
+
+        std::size_t arena_bytes_in_use{ 0 };      /**< Bytes taken out of the arenas. Includes block headers and blocks waiting in thread caches. */
+        std::size_t peak_arena_bytes_in_use{ 0 }; /**< The most arena_bytes_in_use has ever been. */
+
+        std::size_t reserved_bytes{ 0 }; /**< Total size of all arenas. */
+        std::size_t arena_count{ 0 };
+
+        std::size_t free_bytes{ 0 };         /**< Bytes sitting in the arenas' free lists. */
+        std::size_t largest_free_block{ 0 }; /**< Largest single allocation that can be made without growing the pool. */
+        float fragmentation{ 0.0f };         /**< 0 when all free memory is in a single block, approaching 1 as it gets split into smaller blocks. */
+
+        std::array<std::size_t, size_histogram_bucket_count> size_histogram{}; /**< How many allocations have ever been made, bucketed by requested size. */
+        std::array<tag_statistics, max_memory_tags> tags{};                   /**< Usage of each memory_tag. */
+    };
+
+    /**
+     * @brief Returns the current statistics of the global memory pool.
+     * @details Gathering statistics takes the global allocator's lock so shouldn't be done every allocation.
+     * @return 
+     */
+    EMBER_API memory_statistics get_memory_statistics();
+    /**
+     * @brief Returns which bucket of memory_statistics::size_histogram an allocation of bytes is counted in.
+     * @param bytes 
+     * @return 
+     */
+    inline std::size_t get_size_histogram_bucket(std::size_t const bytes);
+}
+
+#include "statistics.inl"
@@ -0,0 +1,11 @@
+#include <algorithm>
+#include <bit>
+
+namespace ember::inline memory {
+    std::size_t get_size_histogram_bucket(std::size_t const bytes) {
+        std::size_t constexpr first_bucket_size_log2{ 4 };
+
+        std::size_t const size_log2{ bytes <= 1 ? 0 : static_cast<std::size_t>(std::bit_width(bytes - 1)) };
+        return std::min(size_log2 > first_bucket_size_log2 ? size_log2 - first_bucket_size_log2 : 0, size_histogram_bucket_count - 1);
+    }
+}
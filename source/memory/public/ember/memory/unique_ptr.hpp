@@ -1,5 +1,7 @@
 #pragma once
 
+#include "ember/memory/allocator.hpp"
+
 #include <concepts>
 #include <cstddef>
 
@@ -9,6 +11,17 @@ namespace ember::inline memory {
             template<typename type_t>
             void operator()(type_t *object);
         };
+
+        /**
+         * @brief Destructs objects and returns their memory to the allocator they were allocated from.
+         */
+        template<allocator allocator_t>
+        struct allocator_deleter {
+            allocator_t allocator;
+
+            template<typename type_t>
+            void operator()(type_t *object);
+        };
     }
 
     /**
@@ -21,7 +34,7 @@ namespace ember::inline memory {
      */
     template<typename type_t, typename deleter_t = internal::default_deleter>
     class unique_ptr {
-        template<typename other_type_t, typename deleter_t>
+        template<typename other_type_t, typename other_deleter_t>
         friend class unique_ptr;
 
         //VARIABLES
@@ -58,10 +71,10 @@ namespace ember::inline memory {
         auto &operator*() requires(!std::is_void_v<type_t>);
         auto const &operator*() const requires(!std::is_void_v<type_t>);
 
-        template<typename type_t_1, typename deleter_t>
-        friend bool operator==(unique_ptr<type_t_1, deleter_t> const &lhs, std::nullptr_t);
-        template<typename type_t_1, typename deleter_t>
-        friend bool operator!=(unique_ptr<type_t_1, deleter_t> const &lhs, std::nullptr_t);
+        template<typename type_t_1, typename deleter_t_1>
+        friend bool operator==(unique_ptr<type_t_1, deleter_t_1> const &lhs, std::nullptr_t);
+        template<typename type_t_1, typename deleter_t_1>
+        friend bool operator!=(unique_ptr<type_t_1, deleter_t_1> const &lhs, std::nullptr_t);
     };
 }
 
@@ -75,6 +88,19 @@ namespace ember::inline memory {
      */
     template<typename type_t, typename... args_t>
     unique_ptr<type_t> make_unique(args_t &&...args);
+
+    /**
+     * @brief Makes a unique_ptr to type_t, allocating it from allocator. The unique_ptr
+     * will return the memory to the same allocator.
+     * @tparam type_t Type the unique_ptr will point to
+     * @tparam allocator_t 
+     * @tparam arg_t 
+     * @param allocator 
+     * @param args 
+     * @return 
+     */
+    template<typename type_t, allocator allocator_t, typename... args_t>
+    unique_ptr<type_t, internal::allocator_deleter<allocator_t>> allocate_unique(allocator_t allocator, args_t &&...args);
 }
 
 #include "unique_ptr.inl"
\ No newline at end of file
@@ -1,11 +1,23 @@
 #include "ember/memory/memory.hpp"
 
+#include <new>
+#include <utility>
+
 namespace ember::inline memory {
     namespace internal {
         template<typename type_t>
         void default_deleter::operator()(type_t *object) {
             destruct(object);
         }
+
+        template<allocator allocator_t>
+        template<typename type_t>
+        void allocator_deleter<allocator_t>::operator()(type_t *object) {
+            object->~type_t();
+
+            auto *memory{ reinterpret_cast<std::byte *>(object) };
+            allocator.free(memory);
+        }
     }
 
     template<typename type_t, typename deleter_t>
@@ -27,23 +39,17 @@ namespace ember::inline memory {
     }
 
     template<typename type_t, typename deleter_t>
-    unique_ptr<type_t, deleter_t>::unique_ptr(unique_ptr<type_t, deleter_t> &&other) noexcept {
-        reset();
-
-        ptr     = other.ptr;
-        deleter = other.deleter;
-
+    unique_ptr<type_t, deleter_t>::unique_ptr(unique_ptr<type_t, deleter_t> &&other) noexcept
+        : ptr{ other.ptr }
+        , deleter{ std::move(other.deleter) } {
         other.ptr = nullptr;
     }
 
     template<typename type_t, typename deleter_t>
     template<typename other_type_t>
-    unique_ptr<type_t, deleter_t>::unique_ptr(unique_ptr<other_type_t, deleter_t> &&other) requires std::is_base_of_v<type_t, other_type_t> {
-        reset();
-
-        ptr     = other.ptr;
-        deleter = other.deleter;
-
+    unique_ptr<type_t, deleter_t>::unique_ptr(unique_ptr<other_type_t, deleter_t> &&other) requires std::is_base_of_v<type_t, other_type_t>
+        : ptr{ other.ptr }
+        , deleter{ std::move(other.deleter) } {
         other.ptr = nullptr;
     }
 
@@ -66,7 +72,7 @@ namespace ember::inline memory {
 
     template<typename type_t, typename deleter_t>
     bool unique_ptr<type_t, deleter_t>::is_valid() const {
-        ptr != nullptr;
+        return ptr != nullptr;
     }
 
     template<typename type_t, typename deleter_t>
@@ -116,4 +122,12 @@ namespace ember::inline memory {
     unique_ptr<type_t> make_unique(args_t &&...args) {
         return unique_ptr{ construct<type_t>(std::forward<args_t>(args)...) };
     }
+
+    template<typename type_t, allocator allocator_t, typename... args_t>
+    unique_ptr<type_t, internal::allocator_deleter<allocator_t>> allocate_unique(allocator_t allocator, args_t &&...args) {
+        std::byte *const memory{ allocator.alloc(sizeof(type_t), alignof(type_t)) };
+        type_t *object{ new(memory) type_t{ std::forward<args_t>(args)... } };
+
+        return unique_ptr<type_t, internal::allocator_deleter<allocator_t>>{ object, internal::allocator_deleter<allocator_t>{ std::move(allocator) } };
+    }
 }
\ No newline at end of file
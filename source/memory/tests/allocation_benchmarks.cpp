@@ -0,0 +1,93 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ember/memory/memory.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr operations_per_run{ 100000 };
+
+    std::size_t random_allocation_size(std::minstd_rand &generator) {
+        std::uniform_int_distribution<std::size_t> distribution{ 8, 512 };
+        return distribution(generator);
+    }
+}
+
+TEST(allocation_benchmarks, alloc_free_latency_is_flat_across_live_allocation_counts) {
+    std::printf("%12s %16s\n", "live allocs", "ns / alloc+free");
+
+    for(std::size_t const live_count : { 1000u, 10000u, 100000u, 1000000u }) {
+        std::minstd_rand generator{ 1234 };
+
+        std::vector<std::byte *> allocations(live_count);
+        for(auto *&allocation : allocations) {
+            allocation = memory::alloc(random_allocation_size(generator), alignof(std::max_align_t));
+            ASSERT_NE(allocation, nullptr);
+        }
+
+        //Randomly replace live allocations so the free lists are fragmented the same way a long running application's would be.
+        std::uniform_int_distribution<std::size_t> index_distribution{ 0, live_count - 1 };
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::size_t i{ 0 }; i < operations_per_run; ++i) {
+            std::byte *&allocation{ allocations[index_distribution(generator)] };
+
+            memory::free(allocation);
+            allocation = memory::alloc(random_allocation_size(generator), alignof(std::max_align_t));
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        for(auto *allocation : allocations) {
+            EXPECT_NE(allocation, nullptr);
+            memory::free(allocation);
+        }
+
+        auto const nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() };
+        std::printf("%12zu %16.1f\n", live_count, static_cast<double>(nanoseconds) / operations_per_run);
+    }
+}
+
+TEST(allocation_benchmarks, resident_memory_shrinks_after_a_load_spike) {
+    auto const get_resident_bytes{ []() -> std::size_t {
+        std::size_t resident_pages{ 0 };
+        if(std::FILE *const statm{ std::fopen("/proc/self/statm", "r") }; statm != nullptr) {
+            std::size_t total_pages{ 0 };
+            if(std::fscanf(statm, "%zu %zu", &total_pages, &resident_pages) != 2) {
+                resident_pages = 0;
+            }
+            std::fclose(statm);
+        }
+        return resident_pages * 4096;
+    } };
+
+    std::size_t constexpr spike_allocations{ 256 };
+    std::size_t constexpr spike_allocation_size{ EMBER_KB(256) };
+
+    std::size_t const before{ get_resident_bytes() };
+    if(before == 0) {
+        GTEST_SKIP() << "Resident memory can't be queried on this platform.";
+    }
+
+    std::vector<std::byte *> allocations(spike_allocations);
+    for(auto *&allocation : allocations) {
+        allocation = memory::alloc(spike_allocation_size, alignof(std::max_align_t));
+        ASSERT_NE(allocation, nullptr);
+        std::memset(allocation, 1, spike_allocation_size);
+    }
+
+    std::size_t const during{ get_resident_bytes() };
+
+    for(auto *&allocation : allocations) {
+        memory::free(allocation);
+    }
+
+    std::size_t const after{ get_resident_bytes() };
+
+    std::printf("%16s %16s %16s\n", "before (MB)", "spike (MB)", "after (MB)");
+    std::printf("%16.1f %16.1f %16.1f\n", before / (1024.0 * 1024.0), during / (1024.0 * 1024.0), after / (1024.0 * 1024.0));
+}
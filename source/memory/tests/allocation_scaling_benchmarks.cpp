@@ -0,0 +1,145 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ember/memory/memory.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr operations_per_thread{ 200000 };
+    std::size_t constexpr live_allocations_per_thread{ 256 };
+
+    void run_small_allocation_workload(std::uint32_t const seed) {
+        std::minstd_rand generator{ seed };
+        std::uniform_int_distribution<std::size_t> size_distribution{ 8, 256 };
+        std::uniform_int_distribution<std::size_t> index_distribution{ 0, live_allocations_per_thread - 1 };
+
+        std::vector<std::byte *> allocations(live_allocations_per_thread, nullptr);
+        for(std::size_t i{ 0 }; i < operations_per_thread; ++i) {
+            std::byte *&allocation{ allocations[index_distribution(generator)] };
+
+            memory::free(allocation);
+            allocation = memory::alloc(size_distribution(generator), alignof(std::max_align_t));
+        }
+
+        for(auto *allocation : allocations) {
+            memory::free(allocation);
+        }
+    }
+}
+
+TEST(allocation_scaling_benchmarks, small_allocations_scale_with_thread_count) {
+    std::printf("%8s %16s %20s\n", "threads", "total ms", "M ops / second");
+
+    for(std::uint32_t const thread_count : { 1u, 2u, 4u, 8u, 16u, 32u }) {
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count);
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::uint32_t i{ 0 }; i < thread_count; ++i) {
+            threads.emplace_back(run_small_allocation_workload, i);
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        double const milliseconds{ std::chrono::duration<double, std::milli>(end - start).count() };
+        double const operations{ static_cast<double>(operations_per_thread) * thread_count };
+        std::printf("%8u %16.1f %20.2f\n", thread_count, milliseconds, (operations / 1000000.0) / (milliseconds / 1000.0));
+    }
+}
+
+TEST(allocation_scaling_benchmarks, cross_thread_frees_scale_with_thread_count) {
+    std::printf("%8s %16s %20s\n", "threads", "total ms", "M ops / second");
+
+    for(std::uint32_t const thread_count : { 2u, 4u, 8u, 16u, 32u }) {
+        std::size_t constexpr allocations_per_thread{ 50000 };
+
+        //Each thread allocates a batch then frees the batch its neighbour allocated.
+        std::vector<std::vector<std::byte *>> batches(thread_count, std::vector<std::byte *>(allocations_per_thread, nullptr));
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count);
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::uint32_t i{ 0 }; i < thread_count; ++i) {
+            threads.emplace_back([&batches, i]() {
+                for(auto *&allocation : batches[i]) {
+                    allocation = memory::alloc(64, alignof(std::max_align_t));
+                }
+            });
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+
+        for(std::uint32_t i{ 0 }; i < thread_count; ++i) {
+            threads.emplace_back([&batches, i, thread_count]() {
+                for(auto *&allocation : batches[(i + 1) % thread_count]) {
+                    memory::free(allocation);
+                }
+            });
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        for(auto const &batch : batches) {
+            for(auto *allocation : batch) {
+                EXPECT_EQ(allocation, nullptr);
+            }
+        }
+
+        double const milliseconds{ std::chrono::duration<double, std::milli>(end - start).count() };
+        double const operations{ static_cast<double>(allocations_per_thread) * thread_count * 2 };
+        std::printf("%8u %16.1f %20.2f\n", thread_count, milliseconds, (operations / 1000000.0) / (milliseconds / 1000.0));
+    }
+}
+
+TEST(allocation_scaling_benchmarks, cross_thread_large_frees_scale_with_thread_count) {
+    std::printf("%8s %16s %20s\n", "threads", "total ms", "M ops / second");
+
+    for(std::uint32_t const thread_count : { 2u, 4u, 8u, 16u, 32u }) {
+        std::size_t constexpr allocations_per_thread{ 5000 };
+
+        //Same as above but with blocks too large for the thread caches so frees go to the arenas.
+        std::vector<std::vector<std::byte *>> batches(thread_count, std::vector<std::byte *>(allocations_per_thread, nullptr));
+        std::vector<std::thread> threads{};
+        threads.reserve(thread_count);
+
+        auto const start{ std::chrono::steady_clock::now() };
+        for(std::uint32_t i{ 0 }; i < thread_count; ++i) {
+            threads.emplace_back([&batches, i]() {
+                for(auto *&allocation : batches[i]) {
+                    allocation = memory::alloc(4096, alignof(std::max_align_t));
+                }
+            });
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+
+        for(std::uint32_t i{ 0 }; i < thread_count; ++i) {
+            threads.emplace_back([&batches, i, thread_count]() {
+                for(auto *&allocation : batches[(i + 1) % thread_count]) {
+                    memory::free(allocation);
+                }
+            });
+        }
+        for(auto &thread : threads) {
+            thread.join();
+        }
+        auto const end{ std::chrono::steady_clock::now() };
+
+        double const milliseconds{ std::chrono::duration<double, std::milli>(end - start).count() };
+        double const operations{ static_cast<double>(allocations_per_thread) * thread_count * 2 };
+        std::printf("%8u %16.1f %20.2f\n", thread_count, milliseconds, (operations / 1000000.0) / (milliseconds / 1000.0));
+    }
+}
@@ -1,7 +1,10 @@
 #include <cstddef>
 #include <ember/memory/memory.hpp>
+#include <ember/memory/statistics.hpp>
 #include <gtest/gtest.h>
 #include <new>
+#include <thread>
+#include <vector>
 
 using namespace ember;
 
@@ -107,6 +110,32 @@ TEST(allocation_tests, can_reallocate_memory) {
     //TODO: allocate twice so it can't extend to next block
 }
 
+TEST(allocation_tests, can_reallocate_memory_in_place) {
+    std::size_t constexpr large_size{ EMBER_KB(16) };
+    std::size_t constexpr small_size{ EMBER_KB(4) };
+
+    auto *mem_1{ memory::alloc(large_size, alignof(std::uint32_t)) };
+    auto *const original{ mem_1 };
+
+    for(std::size_t i{ 0 }; i < small_size / sizeof(std::uint32_t); ++i) {
+        reinterpret_cast<std::uint32_t *>(mem_1)[i] = static_cast<std::uint32_t>(i);
+    }
+
+    //Shrinking always splits the tail off so the allocation shouldn't move.
+    mem_1 = memory::realloc(mem_1, small_size, alignof(std::uint32_t));
+    ASSERT_EQ(mem_1, original);
+
+    //The tail that was returned is now free so growing back should be able to reclaim it.
+    mem_1 = memory::realloc(mem_1, large_size, alignof(std::uint32_t));
+    ASSERT_EQ(mem_1, original);
+
+    for(std::size_t i{ 0 }; i < small_size / sizeof(std::uint32_t); ++i) {
+        EXPECT_EQ(reinterpret_cast<std::uint32_t *>(mem_1)[i], static_cast<std::uint32_t>(i));
+    }
+
+    memory::free(mem_1);
+}
+
 TEST(allocation_tests, can_make_many_allocations) {
     std::uint32_t const num_allocs{ 25000 };
 
@@ -124,6 +153,86 @@ TEST(allocation_tests, can_make_many_allocations) {
     }
 }
 
+TEST(allocation_tests, can_free_memory_from_another_thread) {
+    std::uint32_t const num_allocs{ 1000 };
+
+    std::vector<std::byte *> mems(num_allocs);
+    std::thread allocating_thread{ [&]() {
+        for(auto *&memory : mems) {
+            memory = memory::alloc(32, alignof(std::uint32_t));
+            *reinterpret_cast<std::uint32_t *>(memory) = 1;
+        }
+    } };
+    allocating_thread.join();
+
+    for(auto *&memory : mems) {
+        EXPECT_EQ(*reinterpret_cast<std::uint32_t *>(memory), 1);
+        memory::free(memory);
+        EXPECT_EQ(memory, nullptr);
+    }
+
+    //Blocks returned to an exited thread's cache should be reusable by a new thread.
+    std::thread reusing_thread{ [&]() {
+        for(auto *&memory : mems) {
+            memory = memory::alloc(32, alignof(std::uint32_t));
+            EXPECT_NE(memory, nullptr);
+        }
+        for(auto *&memory : mems) {
+            memory::free(memory);
+        }
+    } };
+    reusing_thread.join();
+}
+
+TEST(allocation_tests, memory_freed_after_its_thread_exits_returns_to_the_arenas) {
+    std::size_t const bytes_in_use_before{ get_memory_statistics().arena_bytes_in_use };
+
+    std::vector<std::byte *> small_mems(1000);
+    std::vector<std::byte *> large_mems(64);
+    std::thread{ [&]() {
+        for(auto *&memory : small_mems) {
+            memory = memory::alloc(32, alignof(std::uint32_t));
+        }
+        for(auto *&memory : large_mems) {
+            memory = memory::alloc(EMBER_KB(4), alignof(std::max_align_t));
+        }
+    } }.join();
+
+    //Nothing will adopt the exited thread's cache so these can't wait for a new owner to pick them up.
+    for(auto *&memory : small_mems) {
+        memory::free(memory);
+    }
+    for(auto *&memory : large_mems) {
+        memory::free(memory);
+    }
+
+    EXPECT_EQ(get_memory_statistics().arena_bytes_in_use, bytes_in_use_before);
+}
+
+TEST(allocation_tests, can_free_large_memory_from_another_thread) {
+    std::uint32_t const num_allocs{ 256 };
+
+    std::size_t const bytes_in_use_before{ get_memory_statistics().arena_bytes_in_use };
+
+    std::vector<std::byte *> mems(num_allocs);
+    for(auto *&memory : mems) {
+        memory = memory::alloc(EMBER_KB(4), alignof(std::max_align_t));
+        EXPECT_NE(memory, nullptr);
+    }
+
+    //Frees from a thread that didn't allocate the blocks are deferred until the allocator next takes it's lock.
+    std::thread freeing_thread{ [&]() {
+        for(auto *&memory : mems) {
+            memory::free(memory);
+            EXPECT_EQ(memory, nullptr);
+        }
+    } };
+    freeing_thread.join();
+
+    EXPECT_EQ(get_memory_statistics().arena_bytes_in_use, bytes_in_use_before);
+
+}
+
 TEST(allocation_tests, can_allocate_large_amounts_of_memory) {
     {
         std::byte *large_1{ memory::alloc(EMBER_MB(500), 0) };
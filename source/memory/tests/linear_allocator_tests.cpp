@@ -0,0 +1,137 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ember/memory/linear_allocator.hpp>
+#include <ember/memory/unique_ptr.hpp>
+#include <gtest/gtest.h>
+
+using namespace ember;
+
+namespace {
+    bool is_aligned(void const *const ptr, std::size_t alignment) {
+        auto const iptr{ reinterpret_cast<std::uintptr_t>(ptr) };
+        return (iptr % alignment) == 0;
+    }
+}
+
+TEST(linear_allocator_tests, can_allocate_memory) {
+    linear_allocator allocator{ EMBER_KB(1) };
+
+    auto *mem_1{ allocator.alloc(sizeof(float), alignof(float)) };
+    auto *mem_2{ allocator.alloc(sizeof(float), alignof(float)) };
+
+    ASSERT_NE(mem_1, nullptr);
+    ASSERT_NE(mem_2, nullptr);
+    EXPECT_NE(mem_1, mem_2);
+
+    *reinterpret_cast<float *>(mem_1) = 1.0f;
+    *reinterpret_cast<float *>(mem_2) = 2.0f;
+
+    EXPECT_EQ(*reinterpret_cast<float *>(mem_1), 1.0f);
+    EXPECT_EQ(*reinterpret_cast<float *>(mem_2), 2.0f);
+}
+
+TEST(linear_allocator_tests, pointers_have_correct_alignment) {
+    linear_allocator allocator{ EMBER_KB(1) };
+
+    auto *const mem_1{ allocator.alloc(1, 1) };
+    auto *const mem_2{ allocator.alloc(sizeof(double), alignof(double)) };
+    auto *const mem_3{ allocator.alloc(1, 1) };
+    auto *const mem_4{ allocator.alloc(64, 64) };
+
+    EXPECT_TRUE(is_aligned(mem_1, 1));
+    EXPECT_TRUE(is_aligned(mem_2, alignof(double)));
+    EXPECT_TRUE(is_aligned(mem_3, 1));
+    EXPECT_TRUE(is_aligned(mem_4, 64));
+}
+
+TEST(linear_allocator_tests, can_allocate_more_than_a_page) {
+    linear_allocator allocator{ 64 };
+
+    auto *const small{ allocator.alloc(48, 1) };
+    auto *const large{ allocator.alloc(EMBER_KB(4), 16) };
+    auto *const after{ allocator.alloc(48, 1) };
+
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    ASSERT_NE(after, nullptr);
+
+    std::memset(large, 1, EMBER_KB(4));
+    EXPECT_TRUE(is_aligned(large, 16));
+}
+
+TEST(linear_allocator_tests, reset_reuses_memory) {
+    linear_allocator allocator{ 64 };
+
+    auto *const first_frame_1{ allocator.alloc(32, 1) };
+    auto *const first_frame_2{ allocator.alloc(32, 1) };
+    auto *const first_frame_3{ allocator.alloc(32, 1) };
+
+    allocator.reset();
+
+    EXPECT_EQ(allocator.alloc(32, 1), first_frame_1);
+    EXPECT_EQ(allocator.alloc(32, 1), first_frame_2);
+    EXPECT_EQ(allocator.alloc(32, 1), first_frame_3);
+}
+
+TEST(linear_allocator_tests, can_reset_to_marker) {
+    linear_allocator allocator{ 64 };
+
+    allocator.alloc(16, 1);
+    linear_allocator::marker const marker{ allocator.get_marker() };
+
+    auto *const mem_1{ allocator.alloc(40, 1) };
+    allocator.alloc(40, 1);
+
+    allocator.reset_to_marker(marker);
+
+    EXPECT_EQ(allocator.alloc(40, 1), mem_1);
+}
+
+TEST(linear_allocator_tests, scoped_marker_resets_on_destruction) {
+    linear_allocator allocator{ EMBER_KB(1) };
+
+    std::byte *scoped_mem{ nullptr };
+    {
+        linear_allocator::scoped_marker const scope{ allocator };
+        scoped_mem = allocator.alloc(128, 1);
+    }
+
+    EXPECT_EQ(allocator.alloc(128, 1), scoped_mem);
+}
+
+TEST(linear_allocator_tests, can_allocate_unique_from_linear_allocator) {
+    struct test_type {
+        bool &dtor_called;
+
+        test_type(bool &dtor_called)
+            : dtor_called{ dtor_called } {
+        }
+        ~test_type() {
+            dtor_called = true;
+        }
+    };
+
+    linear_allocator allocator{ EMBER_KB(1) };
+    bool dtor_called{ false };
+
+    {
+        auto ptr{ allocate_unique<test_type>(allocator_ref{ allocator }, dtor_called) };
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_FALSE(dtor_called);
+    }
+
+    EXPECT_TRUE(dtor_called);
+}
+
+TEST(linear_allocator_tests, can_allocate_through_polymorphic_allocator) {
+    linear_allocator allocator{ EMBER_KB(1) };
+    polymorphic_allocator polymorphic{ allocator };
+
+    auto *const mem_1{ polymorphic.alloc(sizeof(float), alignof(float)) };
+    auto *const mem_2{ allocator.alloc(sizeof(float), alignof(float)) };
+
+    ASSERT_NE(mem_1, nullptr);
+    EXPECT_EQ(mem_1 + sizeof(float), mem_2);
+    EXPECT_EQ(&polymorphic.get_resource(), &allocator);
+}
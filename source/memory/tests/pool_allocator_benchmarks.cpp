@@ -0,0 +1,56 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ember/memory/pool_allocator.hpp>
+#include <ember/memory/unique_ptr.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    std::size_t constexpr live_count{ 100000 };
+    std::size_t constexpr operations_per_run{ 1000000 };
+
+    struct small_object {
+        float values[12]{};
+    };
+
+    template<typename ptr_t, typename make_function_t>
+    void run_benchmark(char const *const name, make_function_t make_object) {
+        std::minstd_rand generator{ 1234 };
+        std::uniform_int_distribution<std::size_t> index_distribution{ 0, live_count - 1 };
+
+        std::vector<ptr_t> objects{};
+        objects.reserve(live_count);
+        for(std::size_t i{ 0 }; i < live_count; ++i) {
+            objects.push_back(make_object());
+        }
+
+        auto const churn_start{ std::chrono::steady_clock::now() };
+        for(std::size_t i{ 0 }; i < operations_per_run; ++i) {
+            objects[index_distribution(generator)] = make_object();
+        }
+        auto const churn_end{ std::chrono::steady_clock::now() };
+
+        float sum{ 0.0f };
+        auto const traverse_start{ std::chrono::steady_clock::now() };
+        for(auto const &object : objects) {
+            sum += object->values[0];
+        }
+        auto const traverse_end{ std::chrono::steady_clock::now() };
+        EXPECT_EQ(sum, 0.0f);
+
+        auto const churn_nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(churn_end - churn_start).count() };
+        auto const traverse_nanoseconds{ std::chrono::duration_cast<std::chrono::nanoseconds>(traverse_end - traverse_start).count() };
+        std::printf("%12s %20.1f %20.2f\n", name, static_cast<double>(churn_nanoseconds) / operations_per_run, static_cast<double>(traverse_nanoseconds) / live_count);
+    }
+}
+
+TEST(pool_allocator_benchmarks, pooled_objects_are_cheaper_to_churn_and_traverse) {
+    std::printf("%12s %20s %20s\n", "allocator", "ns / replace", "ns / traversed obj");
+
+    run_benchmark<unique_ptr<small_object>>("make_unique", []() { return make_unique<small_object>(); });
+    run_benchmark<pooled_ptr<small_object>>("make_pooled", []() { return make_pooled<small_object>(); });
+}
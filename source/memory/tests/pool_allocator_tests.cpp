@@ -0,0 +1,176 @@
+#include <cstddef>
+#include <cstdint>
+#include <ember/memory/allocator.hpp>
+#include <ember/memory/pool_allocator.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+namespace {
+    struct base {
+        virtual ~base() = default;
+    };
+
+    struct tracked : public base {
+        int *destruct_count{ nullptr };
+        float value{ 0.0f };
+
+        tracked(int *destruct_count, float value)
+            : destruct_count{ destruct_count }
+            , value{ value } {
+        }
+
+        ~tracked() override {
+            ++(*destruct_count);
+        }
+    };
+
+    struct alignas(32) over_aligned {
+        std::byte data[40];
+    };
+
+    bool is_aligned(void const *const ptr, std::size_t alignment) {
+        auto const iptr{ reinterpret_cast<std::uintptr_t>(ptr) };
+        return (iptr % alignment) == 0;
+    }
+}
+
+static_assert(allocator<allocator_ref<pool_allocator<float>>>);
+
+TEST(pool_allocator_tests, can_allocate_memory) {
+    pool_allocator<float> pool{};
+
+    auto *mem_1{ pool.alloc(sizeof(float), alignof(float)) };
+    auto *mem_2{ pool.alloc(sizeof(float), alignof(float)) };
+
+    ASSERT_NE(mem_1, nullptr);
+    ASSERT_NE(mem_2, nullptr);
+    EXPECT_NE(mem_1, mem_2);
+
+    *reinterpret_cast<float *>(mem_1) = 1.0f;
+    *reinterpret_cast<float *>(mem_2) = 2.0f;
+
+    EXPECT_EQ(*reinterpret_cast<float *>(mem_1), 1.0f);
+    EXPECT_EQ(*reinterpret_cast<float *>(mem_2), 2.0f);
+
+    pool.free(mem_1);
+    pool.free(mem_2);
+
+    EXPECT_EQ(mem_1, nullptr);
+    EXPECT_EQ(mem_2, nullptr);
+}
+
+TEST(pool_allocator_tests, freed_slots_are_reused) {
+    pool_allocator<float> pool{};
+
+    auto *mem_1{ pool.alloc(sizeof(float), alignof(float)) };
+    auto *const first_address{ mem_1 };
+    pool.free(mem_1);
+
+    auto *mem_2{ pool.alloc(sizeof(float), alignof(float)) };
+    EXPECT_EQ(mem_2, first_address);
+
+    pool.free(mem_2);
+}
+
+TEST(pool_allocator_tests, slots_have_correct_alignment) {
+    pool_allocator<over_aligned, 8> pool{};
+
+    std::vector<over_aligned *> objects{};
+    for(std::size_t i{ 0 }; i < 20; ++i) {
+        objects.push_back(pool.construct());
+        EXPECT_TRUE(is_aligned(objects.back(), alignof(over_aligned)));
+    }
+
+    for(auto *object : objects) {
+        pool.destruct(object);
+    }
+}
+
+TEST(pool_allocator_tests, grows_by_adding_slabs) {
+    pool_allocator<std::uint64_t, 4> pool{};
+
+    std::vector<std::uint64_t *> objects{};
+    for(std::size_t i{ 0 }; i < 4; ++i) {
+        objects.push_back(pool.construct(i));
+    }
+    EXPECT_EQ(pool.get_slab_count(), 1);
+
+    objects.push_back(pool.construct(4u));
+    EXPECT_EQ(pool.get_slab_count(), 2);
+
+    for(std::size_t i{ 0 }; i < objects.size(); ++i) {
+        EXPECT_EQ(*objects[i], i);
+    }
+
+    for(auto *object : objects) {
+        pool.destruct(object);
+    }
+    EXPECT_EQ(pool.get_slab_count(), 2);
+}
+
+TEST(pool_allocator_tests, can_allocate_from_multiple_threads) {
+    pool_allocator<std::uint64_t, 16, true> pool{};
+
+    std::size_t constexpr thread_count{ 4 };
+    std::size_t constexpr allocations{ 1000 };
+
+    std::vector<std::thread> threads{};
+    for(std::size_t t{ 0 }; t < thread_count; ++t) {
+        threads.emplace_back([&pool, t]() {
+            std::vector<std::uint64_t *> objects{};
+            for(std::size_t i{ 0 }; i < allocations; ++i) {
+                objects.push_back(pool.construct(t * allocations + i));
+            }
+            for(std::size_t i{ 0 }; i < allocations; ++i) {
+                EXPECT_EQ(*objects[i], t * allocations + i);
+                pool.destruct(objects[i]);
+            }
+        });
+    }
+
+    for(auto &thread : threads) {
+        thread.join();
+    }
+}
+
+TEST(pool_allocator_tests, can_use_as_unique_ptr_allocator) {
+    pool_allocator<float> pool{};
+
+    {
+        auto ptr{ allocate_unique<float>(allocator_ref{ pool }, 5.0f) };
+        EXPECT_EQ(*ptr, 5.0f);
+    }
+
+    EXPECT_EQ(pool.get_slab_count(), 1);
+}
+
+TEST(pool_allocator_tests, make_pooled_destructs_object) {
+    int destruct_count{ 0 };
+
+    {
+        pooled_ptr<tracked> ptr{ make_pooled<tracked>(&destruct_count, 3.0f) };
+        ASSERT_TRUE(ptr.is_valid());
+        EXPECT_EQ(ptr->value, 3.0f);
+    }
+
+    EXPECT_EQ(destruct_count, 1);
+}
+
+TEST(pool_allocator_tests, make_pooled_can_convert_to_base) {
+    int destruct_count{ 0 };
+
+    {
+        pooled_ptr<base> ptr{ make_pooled<tracked>(&destruct_count, 3.0f) };
+        ASSERT_TRUE(ptr.is_valid());
+    }
+
+    EXPECT_EQ(destruct_count, 1);
+
+    //The slot should have been returned to tracked's pool.
+    auto *const first_address{ make_pooled<tracked>(&destruct_count, 1.0f).get() };
+    pooled_ptr<tracked> ptr{ make_pooled<tracked>(&destruct_count, 2.0f) };
+    EXPECT_EQ(ptr.get(), first_address);
+}
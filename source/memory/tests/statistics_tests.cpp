@@ -0,0 +1,176 @@
+#include <cstddef>
+#include <ember/memory/memory.hpp>
+#include <ember/memory/memory_tag.hpp>
+#include <ember/memory/statistics.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+TEST(statistics_tests, can_register_memory_tags) {
+    memory_tag const tag_1{ register_memory_tag("statistics_tests_tag_1") };
+    memory_tag const tag_2{ register_memory_tag("statistics_tests_tag_2") };
+
+    EXPECT_NE(tag_1, untagged_memory_tag);
+    EXPECT_NE(tag_1, tag_2);
+    EXPECT_EQ(register_memory_tag("statistics_tests_tag_1"), tag_1);
+    EXPECT_STREQ(get_memory_tag_name(tag_2), "statistics_tests_tag_2");
+}
+
+TEST(statistics_tests, tags_are_scoped) {
+    memory_tag const outer{ register_memory_tag("statistics_tests_outer") };
+    memory_tag const inner{ register_memory_tag("statistics_tests_inner") };
+
+    EXPECT_EQ(get_current_memory_tag(), untagged_memory_tag);
+    {
+        EMBER_MEMORY_TAG(outer);
+        EXPECT_EQ(get_current_memory_tag(), outer);
+        {
+            EMBER_MEMORY_TAG(inner);
+            EXPECT_EQ(get_current_memory_tag(), inner);
+        }
+        EXPECT_EQ(get_current_memory_tag(), outer);
+
+        //Tag stacks are per thread.
+        std::thread{ []() { EXPECT_EQ(get_current_memory_tag(), untagged_memory_tag); } }.join();
+    }
+    EXPECT_EQ(get_current_memory_tag(), untagged_memory_tag);
+}
+
+TEST(statistics_tests, counts_tagged_allocations) {
+    std::size_t constexpr allocation_count{ 10 };
+    std::size_t constexpr allocation_size{ 100 };
+
+    memory_tag const tag{ register_memory_tag("statistics_tests_counted") };
+    std::vector<std::byte *> allocations{};
+
+    {
+        EMBER_MEMORY_TAG(tag);
+        for(std::size_t i{ 0 }; i < allocation_count; ++i) {
+            allocations.push_back(memory::alloc(allocation_size, alignof(std::max_align_t)));
+        }
+    }
+
+    memory_statistics const allocated{ get_memory_statistics() };
+    EXPECT_EQ(allocated.tags[tag].allocation_count, allocation_count);
+    EXPECT_GE(allocated.tags[tag].bytes_in_use, allocation_count * allocation_size);
+    EXPECT_GE(allocated.bytes_in_use, allocated.tags[tag].bytes_in_use);
+    EXPECT_GE(allocated.size_histogram[get_size_histogram_bucket(allocation_size)], allocation_count);
+
+    //Memory is counted against the tag it was allocated with, even when freed from another thread.
+    std::thread{ [&allocations]() {
+        for(auto *&allocation : allocations) {
+            memory::free(allocation);
+        }
+    } }.join();
+
+    memory_statistics const freed{ get_memory_statistics() };
+    EXPECT_EQ(freed.tags[tag].allocation_count, 0);
+    EXPECT_EQ(freed.tags[tag].bytes_in_use, 0);
+}
+
+TEST(statistics_tests, reports_state_of_the_pool) {
+    std::byte *large_allocation{ memory::alloc(EMBER_MB(4), 0) };
+
+    memory_statistics const statistics{ get_memory_statistics() };
+
+    EXPECT_GE(statistics.arena_count, 1);
+    EXPECT_GE(statistics.reserved_bytes, EMBER_MB(4));
+    EXPECT_EQ(statistics.reserved_bytes, statistics.arena_bytes_in_use + statistics.free_bytes);
+    EXPECT_GE(statistics.arena_bytes_in_use, EMBER_MB(4));
+    EXPECT_GE(statistics.peak_arena_bytes_in_use, statistics.arena_bytes_in_use);
+    EXPECT_LE(statistics.largest_free_block, statistics.free_bytes);
+    EXPECT_GE(statistics.fragmentation, 0.0f);
+    EXPECT_LE(statistics.fragmentation, 1.0f);
+
+    memory::free(large_allocation);
+}
+
+TEST(statistics_tests, histogram_buckets_are_powers_of_two) {
+    EXPECT_EQ(get_size_histogram_bucket(0), 0);
+    EXPECT_EQ(get_size_histogram_bucket(16), 0);
+    EXPECT_EQ(get_size_histogram_bucket(17), 1);
+    EXPECT_EQ(get_size_histogram_bucket(32), 1);
+    EXPECT_EQ(get_size_histogram_bucket(EMBER_KB(512)), size_histogram_bucket_count - 2);
+    EXPECT_EQ(get_size_histogram_bucket(EMBER_KB(512) + 1), size_histogram_bucket_count - 1);
+    EXPECT_EQ(get_size_histogram_bucket(EMBER_GB(1)), size_histogram_bucket_count - 1);
+}
+
+TEST(statistics_tests, can_allocate_with_explicit_tag) {
+    memory_tag const scoped{ register_memory_tag("statistics_tests_scoped") };
+    memory_tag const explicit_tag{ register_memory_tag("statistics_tests_explicit") };
+
+    std::byte *allocation{ nullptr };
+    {
+        EMBER_MEMORY_TAG(scoped);
+        allocation = memory::alloc(64, alignof(std::max_align_t), explicit_tag);
+    }
+
+    memory_statistics const allocated{ get_memory_statistics() };
+    EXPECT_EQ(allocated.tags[explicit_tag].allocation_count, 1);
+    EXPECT_EQ(allocated.tags[scoped].allocation_count, 0);
+
+    //Reallocations keep their original tag.
+    allocation = memory::realloc(allocation, EMBER_KB(4), alignof(std::max_align_t));
+
+    memory_statistics const reallocated{ get_memory_statistics() };
+    EXPECT_EQ(reallocated.tags[explicit_tag].allocation_count, 1);
+    EXPECT_GE(reallocated.tags[explicit_tag].bytes_in_use, EMBER_KB(4));
+
+    memory::free(allocation);
+}
+
+TEST(statistics_tests, tracks_peak_usage_of_tags) {
+    memory_tag const tag{ register_memory_tag("statistics_tests_peak") };
+
+    std::byte *allocation{ memory::alloc(EMBER_MB(1), 0, tag) };
+    memory::free(allocation);
+
+    memory_statistics const statistics{ get_memory_statistics() };
+    EXPECT_EQ(statistics.tags[tag].bytes_in_use, 0);
+    EXPECT_GE(statistics.tags[tag].peak_bytes_in_use, EMBER_MB(1));
+}
+
+namespace {
+    memory_tag reported_tag{ untagged_memory_tag };
+    std::size_t reported_bytes_in_use{ 0 };
+    std::size_t reported_budget{ 0 };
+    std::size_t report_count{ 0 };
+}
+
+TEST(statistics_tests, reports_tags_exceeding_their_budget) {
+    memory_tag const tag{ register_memory_tag("statistics_tests_budget") };
+
+    set_memory_tag_budget(tag, EMBER_KB(256));
+    EXPECT_EQ(get_memory_tag_budget(tag), EMBER_KB(256));
+
+    set_memory_budget_exceeded_callback([](memory_tag const tag, std::size_t const bytes_in_use, std::size_t const budget) {
+        reported_tag          = tag;
+        reported_bytes_in_use = bytes_in_use;
+        reported_budget       = budget;
+        ++report_count;
+    });
+
+    std::byte *within_budget{ memory::alloc(EMBER_KB(128), 0, tag) };
+    EXPECT_EQ(report_count, 0);
+
+    std::byte *over_budget{ memory::alloc(EMBER_KB(256), 0, tag) };
+    EXPECT_EQ(report_count, 1);
+    EXPECT_EQ(reported_tag, tag);
+    EXPECT_GT(reported_bytes_in_use, EMBER_KB(256));
+    EXPECT_EQ(reported_budget, EMBER_KB(256));
+
+    //Staying over budget only reports once.
+    std::byte *still_over_budget{ memory::alloc(EMBER_KB(64), 0, tag) };
+    EXPECT_EQ(report_count, 1);
+
+    EXPECT_EQ(get_memory_statistics().tags[tag].budget, EMBER_KB(256));
+
+    memory::free(within_budget);
+    memory::free(over_budget);
+    memory::free(still_over_budget);
+
+    set_memory_budget_exceeded_callback(nullptr);
+    set_memory_tag_budget(tag, 0);
+}
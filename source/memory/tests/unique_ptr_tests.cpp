@@ -132,4 +132,27 @@ TEST(unique_ptr_tests, can_use_custom_deleter) {
 
     EXPECT_TRUE(deleter_called_a);
     EXPECT_TRUE(deleter_called_b);
+}
+
+TEST(unique_ptr_tests, can_allocate_from_allocator) {
+    struct test_type {
+        bool &dtor_called;
+
+        test_type(bool &dtor_called)
+            : dtor_called{ dtor_called } {
+        }
+        ~test_type() {
+            dtor_called = true;
+        }
+    };
+
+    bool dtor_called{ false };
+    {
+        auto ptr{ allocate_unique<test_type>(global_allocator_ref{}, dtor_called) };
+
+        ASSERT_NE(ptr, nullptr);
+        EXPECT_FALSE(dtor_called);
+    }
+
+    EXPECT_TRUE(dtor_called);
 }
\ No newline at end of file
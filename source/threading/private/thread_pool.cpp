@@ -0,0 +1,153 @@
+#include "ember/threading/thread_pool.hpp"
+
+#include <limits>
+
+namespace ember::inline threading {
+    namespace {
+        std::size_t constexpr npos{ std::numeric_limits<std::size_t>::max() };
+
+        thread_local thread_pool const *current_pool{ nullptr };
+        thread_local std::size_t current_worker_index{ npos };
+    }
+
+    thread_pool::thread_pool(std::size_t const thread_count) {
+        workers.reserve(thread_count);
+        for(std::size_t i{ 0 }; i < thread_count; ++i) {
+            workers.emplace_back(make_unique<worker>());
+        }
+
+        //Only start the threads once every worker exists as they steal from each other straight away
+        for(std::size_t i{ 0 }; i < thread_count; ++i) {
+            workers[i]->thread = std::thread{ [this, i]() { run_worker(i); } };
+        }
+    }
+
+    thread_pool::~thread_pool() {
+        stopping.store(true, std::memory_order_release);
+        work_epoch.fetch_add(1, std::memory_order_release);
+        work_epoch.notify_all();
+
+        for(auto &worker : workers) {
+            worker->thread.join();
+        }
+    }
+
+    std::size_t thread_pool::get_default_thread_count() {
+        std::size_t const hardware_threads{ std::thread::hardware_concurrency() };
+        return hardware_threads > 1 ? hardware_threads - 1 : 0;
+    }
+
+    std::size_t thread_pool::get_thread_count() const {
+        return workers.size();
+    }
+
+    void thread_pool::submit(job *const jobs, std::size_t const count) {
+        std::size_t const worker_index{ get_current_worker_index() };
+
+        for(std::size_t i{ 0 }; i < count; ++i) {
+            job *const job{ &jobs[i] };
+
+            if(worker_index != npos && workers[worker_index]->jobs.try_push(job)) {
+                continue;
+            }
+            if(workers.size() > 0 && shared_jobs.try_push(job)) {
+                continue;
+            }
+
+            //Everything is full so do it now rather than block
+            execute(*job);
+        }
+
+        wake_workers();
+    }
+
+    void thread_pool::wait(std::atomic<std::size_t> const &remaining) {
+        std::size_t const worker_index{ get_current_worker_index() };
+
+        while(remaining.load(std::memory_order_acquire) > 0) {
+            if(job *const job{ find_job(worker_index) }) {
+                execute(*job);
+            } else {
+                //The remaining jobs are running on other threads
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    void thread_pool::run_worker(std::size_t const worker_index) {
+        current_pool         = this;
+        current_worker_index = worker_index;
+
+        while(!stopping.load(std::memory_order_acquire)) {
+            if(job *const job{ find_job(worker_index) }) {
+                execute(*job);
+                continue;
+            }
+
+            //Announce we are going to sleep before checking for work one last time. Anything submitted after the
+            //epoch is read will change it and wake us back up.
+            sleeping_count.fetch_add(1, std::memory_order_seq_cst);
+            std::uint32_t const epoch{ work_epoch.load(std::memory_order_seq_cst) };
+
+            if(job *const job{ find_job(worker_index) }) {
+                sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+                execute(*job);
+                continue;
+            }
+
+            if(!stopping.load(std::memory_order_acquire)) {
+                work_epoch.wait(epoch, std::memory_order_acquire);
+            }
+            sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        current_pool         = nullptr;
+        current_worker_index = npos;
+    }
+
+    job *thread_pool::find_job(std::size_t const worker_index) {
+        if(worker_index != npos) {
+            if(auto const job{ workers[worker_index]->jobs.try_pop() }) {
+                return *job;
+            }
+        }
+
+        if(auto const job{ shared_jobs.try_pop() }) {
+            return *job;
+        }
+
+        //Start stealing from the next worker along so thieves spread out rather than all hitting the first worker
+        std::size_t const start{ worker_index != npos ? worker_index + 1 : 0 };
+        for(std::size_t i{ 0 }; i < workers.size(); ++i) {
+            std::size_t const victim{ (start + i) % workers.size() };
+            if(victim == worker_index) {
+                continue;
+            }
+
+            if(auto const job{ workers[victim]->jobs.try_steal() }) {
+                return *job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    std::size_t thread_pool::get_current_worker_index() const {
+        return current_pool == this ? current_worker_index : npos;
+    }
+
+    void thread_pool::wake_workers() {
+        work_epoch.fetch_add(1, std::memory_order_seq_cst);
+        if(sleeping_count.load(std::memory_order_seq_cst) > 0) {
+            work_epoch.notify_all();
+        }
+    }
+
+    void thread_pool::execute(job &job) {
+        //Read remaining first as job might not be valid once remaining is decremented
+        std::atomic<std::size_t> *const remaining{ job.remaining };
+
+        job.function(job.context, job.index);
+        remaining->fetch_sub(1, std::memory_order_release);
+    }
+}
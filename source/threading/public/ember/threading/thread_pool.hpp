@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ember/containers/array.hpp>
+#include <ember/containers/mpmc_queue.hpp>
+#include <ember/containers/work_stealing_deque.hpp>
+#include <ember/core/export.hpp>
+#include <ember/memory/memory.hpp>
+#include <ember/memory/unique_ptr.hpp>
+#include <thread>
+
+namespace ember::inline threading {
+    /**
+     * @brief A single piece of work for a thread_pool.
+     * @details Jobs are not owned by the pool. Whoever submits a job keeps it alive until remaining reaches 0.
+     */
+    struct job {
+        void (*function)(void *context, std::size_t const index){ nullptr };
+        void *context{ nullptr };
+        std::size_t index{ 0 };                         /**< Passed to function so one context can be shared by many jobs. */
+        std::atomic<std::size_t> *remaining{ nullptr }; /**< Decremented after function has returned. */
+    };
+
+    /**
+     * @brief Runs jobs on a fixed set of worker threads.
+     * @details Each worker has it's own work_stealing_deque. Workers run their own jobs newest first and steal the
+     * oldest jobs from each other when they run out. Jobs submitted from outside the pool go through a shared
+     * queue. Threads that wait on jobs run other jobs while they wait, so waiting inside of a job is safe and the
+     * calling thread always contributes. Idle workers sleep until more jobs are submitted.
+     */
+    class EMBER_API thread_pool {
+        //TYPES
+    private:
+        struct worker {
+            work_stealing_deque<job *> jobs{ local_queue_capacity };
+            std::thread thread{};
+        };
+
+        //VARIABLES
+    public:
+        static std::size_t constexpr local_queue_capacity{ 4096 };  /**< Jobs each worker can hold before submissions spill into the shared queue. */
+        static std::size_t constexpr shared_queue_capacity{ 4096 }; /**< Jobs that can be waiting in the shared queue. Any more are run by the submitting thread. */
+
+    private:
+        array<unique_ptr<worker>> workers{};
+        mpmc_queue<job *> shared_jobs{ shared_queue_capacity }; /**< Jobs submitted by threads outside of the pool. */
+
+        std::atomic<bool> stopping{ false };
+        alignas(cache_line_size) std::atomic<std::uint32_t> work_epoch{ 0 }; /**< Bumped on every submission. Sleeping workers wait for it to change. */
+        alignas(cache_line_size) std::atomic<std::uint32_t> sleeping_count{ 0 };
+
+        //FUNCTIONS
+    public:
+        /**
+         * @brief Creates a pool with thread_count workers. The thread using the pool also runs jobs while it
+         * waits, so a pool with no workers is valid and runs everything on the calling thread.
+         * @param thread_count
+         */
+        explicit thread_pool(std::size_t const thread_count = get_default_thread_count());
+
+        thread_pool(thread_pool const &other) = delete;
+        thread_pool(thread_pool &&other)      = delete;
+
+        thread_pool &operator=(thread_pool const &other) = delete;
+        thread_pool &operator=(thread_pool &&other)      = delete;
+
+        ~thread_pool();
+
+        /**
+         * @brief Returns one less than the number of hardware threads, leaving room for the thread that uses the pool.
+         * @return
+         */
+        static std::size_t get_default_thread_count();
+
+        /**
+         * @brief Returns how many worker threads the pool has.
+         * @return
+         */
+        std::size_t get_thread_count() const;
+
+        /**
+         * @brief Splits [0, count) into batches of batch_size and calls function(begin, end) for each batch
+         * across the pool. Returns once every batch has finished.
+         * @tparam function_t Called concurrently so is only ever called through a const reference.
+         * @param count
+         * @param batch_size
+         * @param function
+         */
+        template<typename function_t>
+        void parallel_for(std::size_t const count, std::size_t const batch_size, function_t const &function);
+
+        /**
+         * @brief Queues jobs to run. Can be called from any thread, including from inside a running job.
+         * @param jobs Must stay alive until each job's remaining counter has been decremented.
+         * @param count
+         */
+        void submit(job *const jobs, std::size_t const count);
+
+        /**
+         * @brief Runs jobs until remaining reaches 0.
+         * @param remaining
+         */
+        void wait(std::atomic<std::size_t> const &remaining);
+
+    private:
+        void run_worker(std::size_t const worker_index);
+
+        /**
+         * @brief Finds a job from the worker's own deque, then the shared queue and then by stealing from other
+         * workers. Threads outside the pool pass npos.
+         * @return Returns nullptr if there was no work.
+         */
+        job *find_job(std::size_t const worker_index);
+        std::size_t get_current_worker_index() const;
+
+        void wake_workers();
+
+        static void execute(job &job);
+    };
+}
+
+#include "thread_pool.inl"
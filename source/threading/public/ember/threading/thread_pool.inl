@@ -0,0 +1,43 @@
+#include <algorithm>
+
+namespace ember::inline threading {
+    template<typename function_t>
+    void thread_pool::parallel_for(std::size_t const count, std::size_t const batch_size, function_t const &function) {
+        std::size_t const batch{ std::max<std::size_t>(batch_size, 1) };
+        std::size_t const job_count{ (count + batch - 1) / batch };
+
+        //Not worth waking any workers if there is only one batch
+        if(job_count <= 1 || workers.empty()) {
+            if(count > 0) {
+                function(std::size_t{ 0 }, count);
+            }
+            return;
+        }
+
+        struct batch_context {
+            function_t const *function;
+            std::size_t count;
+            std::size_t batch;
+        } context{ &function, count, batch };
+
+        std::atomic<std::size_t> remaining{ job_count };
+
+        array<job> jobs(job_count);
+        for(std::size_t i{ 0 }; i < job_count; ++i) {
+            jobs[i] = job{
+                .function = [](void *context, std::size_t const index) {
+                    auto const &batch{ *static_cast<batch_context *>(context) };
+
+                    std::size_t const begin{ index * batch.batch };
+                    (*batch.function)(begin, std::min(begin + batch.batch, batch.count));
+                },
+                .context   = &context,
+                .index     = i,
+                .remaining = &remaining,
+            };
+        }
+
+        submit(jobs.data(), jobs.size());
+        wait(remaining);
+    }
+}
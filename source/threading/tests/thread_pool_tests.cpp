@@ -0,0 +1,100 @@
+#include <atomic>
+#include <cstddef>
+#include <ember/threading/thread_pool.hpp>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+using namespace ember;
+
+TEST(thread_pool_tests, parallel_for_visits_every_index_once) {
+    thread_pool pool{ 3 };
+
+    std::size_t constexpr count{ 10000 };
+    std::vector<std::atomic<std::uint32_t>> visits(count);
+
+    pool.parallel_for(count, 64, [&](std::size_t const begin, std::size_t const end) {
+        for(std::size_t i{ begin }; i < end; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    for(auto const &visit : visits) {
+        EXPECT_EQ(visit.load(), 1);
+    }
+}
+
+TEST(thread_pool_tests, parallel_for_splits_into_batches) {
+    thread_pool pool{ 2 };
+
+    std::atomic<std::size_t> batch_count{ 0 };
+    std::atomic<std::size_t> largest_batch{ 0 };
+
+    pool.parallel_for(100, 30, [&](std::size_t const begin, std::size_t const end) {
+        batch_count.fetch_add(1);
+
+        std::size_t size{ end - begin };
+        std::size_t largest{ largest_batch.load() };
+        while(size > largest && !largest_batch.compare_exchange_weak(largest, size)) {
+        }
+    });
+
+    EXPECT_EQ(batch_count.load(), 4);
+    EXPECT_EQ(largest_batch.load(), 30);
+}
+
+TEST(thread_pool_tests, parallel_for_can_be_nested) {
+    thread_pool pool{ 3 };
+
+    std::size_t constexpr outer_count{ 32 };
+    std::size_t constexpr inner_count{ 256 };
+    std::atomic<std::size_t> total{ 0 };
+
+    pool.parallel_for(outer_count, 1, [&](std::size_t const, std::size_t const) {
+        pool.parallel_for(inner_count, 16, [&](std::size_t const begin, std::size_t const end) {
+            total.fetch_add(end - begin);
+        });
+    });
+
+    EXPECT_EQ(total.load(), outer_count * inner_count);
+}
+
+TEST(thread_pool_tests, runs_on_calling_thread_without_workers) {
+    thread_pool pool{ 0 };
+    EXPECT_EQ(pool.get_thread_count(), 0);
+
+    std::thread::id const caller{ std::this_thread::get_id() };
+    std::size_t total{ 0 };
+
+    pool.parallel_for(1000, 10, [&](std::size_t const begin, std::size_t const end) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        total += end - begin;
+    });
+
+    EXPECT_EQ(total, 1000);
+}
+
+TEST(thread_pool_tests, submitted_jobs_are_all_executed) {
+    thread_pool pool{ 2 };
+
+    std::size_t constexpr job_count{ 5000 }; //More than the shared queue can hold
+    std::vector<std::atomic<std::uint32_t>> visits(job_count);
+    std::atomic<std::size_t> remaining{ job_count };
+
+    std::vector<job> jobs(job_count);
+    for(std::size_t i{ 0 }; i < job_count; ++i) {
+        jobs[i] = job{
+            .function  = [](void *context, std::size_t const index) { (*static_cast<std::vector<std::atomic<std::uint32_t>> *>(context))[index].fetch_add(1); },
+            .context   = &visits,
+            .index     = i,
+            .remaining = &remaining,
+        };
+    }
+
+    pool.submit(jobs.data(), jobs.size());
+    pool.wait(remaining);
+
+    for(auto const &visit : visits) {
+        EXPECT_EQ(visit.load(), 1);
+    }
+}